@@ -0,0 +1,92 @@
+# Converts the solar system and stargate tables of the EVE static data
+# export (CSV, as published by Fuzzwork) into the plain text lists bundled
+# as :/solarsystems.txt and :/stargates.txt.
+#
+# Usage: cmake -DSYSTEMS_CSV=mapSolarSystems.csv
+#              -DJUMPS_CSV=mapSolarSystemJumps.csv
+#              -DOUTPUT_DIR=<dir> -P GenerateMapData.cmake
+
+foreach(var SYSTEMS_CSV JUMPS_CSV OUTPUT_DIR)
+    if(NOT DEFINED ${var})
+        message(FATAL_ERROR "GenerateMapData: ${var} is not set")
+    endif()
+endforeach()
+
+# Known space and wormhole systems; IDs from 32000000 on are abyssal and
+# other instanced systems nobody reports in intel
+set(LAST_SYSTEM_ID 31999999)
+
+# Index of a column in a CSV header line, -1 if missing
+function(csv_column header name out)
+    string(REPLACE "\"" "" header "${header}")
+    string(REPLACE "," ";" columns "${header}")
+    list(FIND columns "${name}" index)
+    set(${out} ${index} PARENT_SCOPE)
+endfunction()
+
+# Splits a CSV line into a list. System names hold no commas or quotes, so
+# quotes are simply dropped.
+macro(csv_fields line out)
+    string(REPLACE "\"" "" _fields "${line}")
+    string(REPLACE ";" "" _fields "${_fields}")
+    string(REPLACE "," ";" ${out} "${_fields}")
+endmacro()
+
+file(STRINGS "${SYSTEMS_CSV}" system_lines ENCODING UTF-8)
+list(POP_FRONT system_lines header)
+csv_column("${header}" solarSystemID id_column)
+csv_column("${header}" solarSystemName name_column)
+if(id_column LESS 0 OR name_column LESS 0)
+    message(FATAL_ERROR "GenerateMapData: unexpected header in ${SYSTEMS_CSV}")
+endif()
+
+set(names "")
+foreach(line IN LISTS system_lines)
+    csv_fields("${line}" fields)
+    list(GET fields ${id_column} id)
+    list(GET fields ${name_column} name)
+    if(id GREATER LAST_SYSTEM_ID)
+        continue()
+    endif()
+    set(system_${id} "${name}")
+    list(APPEND names "${name}")
+endforeach()
+list(SORT names)
+
+file(STRINGS "${JUMPS_CSV}" jump_lines ENCODING UTF-8)
+list(POP_FRONT jump_lines header)
+csv_column("${header}" fromSolarSystemID from_column)
+csv_column("${header}" toSolarSystemID to_column)
+if(from_column LESS 0 OR to_column LESS 0)
+    message(FATAL_ERROR "GenerateMapData: unexpected header in ${JUMPS_CSV}")
+endif()
+
+# The export lists every gate in both directions; keep one of them
+set(gates "")
+foreach(line IN LISTS jump_lines)
+    csv_fields("${line}" fields)
+    list(GET fields ${from_column} from)
+    list(GET fields ${to_column} to)
+    if(from LESS to AND DEFINED system_${from} AND DEFINED system_${to})
+        list(APPEND gates "${system_${from}},${system_${to}}")
+    endif()
+endforeach()
+
+list(LENGTH names system_count)
+list(LENGTH gates gate_count)
+if(system_count EQUAL 0 OR gate_count EQUAL 0)
+    message(FATAL_ERROR "GenerateMapData: no systems or gates found")
+endif()
+
+string(REPLACE ";" "\n" names "${names}")
+string(REPLACE ";" "\n" gates "${gates}")
+file(WRITE "${OUTPUT_DIR}/solarsystems.txt"
+    "# Solar system names matched in intel channels, one per line.\n"
+    "# Generated from mapSolarSystems of the EVE static data export.\n"
+    "${names}\n")
+file(WRITE "${OUTPUT_DIR}/stargates.txt"
+    "# Stargate connections, one \"System A,System B\" pair per line.\n"
+    "# Generated from mapSolarSystemJumps of the EVE static data export.\n"
+    "${gates}\n")
+
+message(STATUS "Map data: ${system_count} systems, ${gate_count} gates")
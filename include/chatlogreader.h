@@ -1,7 +1,17 @@
 #ifndef CHATLOGREADER_H
 #define CHATLOGREADER_H
 
+#include "combatdamagetracker.h"
+#include "logalertmatcher.h"
+#include "logfilediscovery.h"
+#include "loglineclassifier.h"
+#include "logpipelinestats.h"
+#include "logpollschedule.h"
+#include "logprefilter.h"
+#include "solarsystemmatcher.h"
 #include <QDir>
+#include <QElapsedTimer>
+#include <QFile>
 #include <QFileSystemWatcher>
 #include <QHash>
 #include <QMutex>
@@ -10,7 +20,10 @@
 #include <QSet>
 #include <QString>
 #include <QThread>
+#include <QThreadPool>
 #include <QTimer>
+#include <functional>
+#include <memory>
 
 struct CharacterLocation {
   QString characterName;
@@ -22,105 +35,182 @@ struct CharacterLocation {
       : characterName(name), systemName(system), lastUpdate(time) {}
 };
 
+/// Event detected by a worker, delivered to the GUI thread in batches
+struct LogEvent {
+  enum Type { SystemChange, CombatEvent };
+
+  Type type;
+  QString characterName;
+  QString eventType; // Combat event type, empty for system changes
+  QString text;      // System name or combat event text
+  qint64 timestamp;  // Time of the log line in ms since epoch (UTC)
+  bool live = true;  // false for initial states and catch-up reads
+};
+
+using LogEventBatch = QVector<LogEvent>;
+Q_DECLARE_METATYPE(LogEventBatch)
+
 /// State for a single log file being monitored via polling
 struct LogFileState {
   QString filePath;
   QString characterName;
+  QString intelChannel;     // Set for intel channel logs, which have no owner
   qint64 position;          // Current read position in file
   qint64 lastSize;          // Last known file size
-  qint64 lastModified;      // Last modified timestamp in ms since epoch
-  QString partialLine;      // Incomplete line from previous read
+  qint64 lastModified;      // Last seen growth in ms since epoch
   bool isChatLog;           // true for chatlog, false for gamelog
   bool hadActivityLastPoll; // Had new data in last poll
+  std::unique_ptr<QFile> file; // Long-lived read handle, reopened on truncation
+  QByteArray readBuffer;     // Read data, consumed up to readOffset
+  qsizetype readOffset = 0;  // Start of the incomplete line in readBuffer
+  qsizetype searchedBytes = 0; // Bytes after readOffset without a newline
+  quint64 nextPollTick = 0;    // Poll wheel tick at which to check next
+  int idlePolls = 0;           // Consecutive checks that found no new data
+  bool clientRunning = true; // Character has a client open; always for intel
+  bool notificationsSeen = false; // Change notifications arrive for this file
+  bool catchingUp = true; // Next read may hold lines written before it opened
 };
 
 class ChatLogWorker : public QObject {
   Q_OBJECT
 
 public:
-  explicit ChatLogWorker(QObject *parent = nullptr);
+  explicit ChatLogWorker(LogPipelineStats &stats, QObject *parent = nullptr);
   ~ChatLogWorker();
 
   void setCharacterNames(const QStringList &characters);
-  void setLogDirectory(const QString &directory);
-  void setGameLogDirectory(const QString &directory);
   void setEnableChatLogMonitoring(bool enabled);
   void setEnableGameLogMonitoring(bool enabled);
+  void setEventDrivenMonitoring(bool enabled);
+  void setBatchedDelivery(bool enabled);
+  void setCombatDamageTracking(bool enabled);
+  void setLogAlertRules(const QVector<LogAlertRule> &rules);
+  void setMaxEventAge(int seconds);
+  void setDataDirectory(const QString &directory);
+  void setMiningTimeout(int seconds);
+  void setCustomNames(const QHash<QString, QString> &customNames);
 
 signals:
-  void systemChanged(const QString &characterName, const QString &systemName);
+  void systemChanged(const QString &characterName, const QString &systemName,
+                     qint64 timestamp);
   void characterLoggedIn(const QString &characterName);
   void characterLoggedOut(const QString &characterName);
   void combatEventDetected(const QString &characterName,
-                           const QString &eventType, const QString &eventText);
+                           const QString &eventType, const QString &eventText,
+                           qint64 timestamp);
   void combatDetected(const QString &characterName, const QString &combatData);
+  void eventsBatched(const LogEventBatch &events);
+  void intelReported(const QString &channel, const QString &systemName,
+                     const QString &text, qint64 timestamp);
+  void combatStatsUpdated(const CombatDamageStatsList &stats);
 
 public slots:
   void startMonitoring();
   void stopMonitoring();
   void refreshMonitoring();
   void pollLogFiles();
-  void checkForNewFiles();
-  void onDirectoryChanged(const QString &path);
-  QHash<QString, QString> buildListenerToFileMap(const QDir &dir,
-                                                 const QStringList &filters,
-                                                 int maxAgeHours = 24);
+  void onLogFileChanged(const QString &path);
+  void publishCombatStats();
+
+  /// Files of this worker's characters (and intel channels, if any) found
+  /// by the reader's LogFileDiscovery; attaches and detaches logs to match
+  void assignLogFiles(const LogFileAssignment &files);
 
 private:
-  QString findLogFileForCharacter(const QString &characterName);
-  QString findChatLogFileForCharacter(const QString &characterName);
-  QString findGameLogFileForCharacter(const QString &characterName);
-  QString extractSystemFromLine(const QString &logLine);
   QString sanitizeSystemName(const QString &system);
-  QString extractCharacterFromLogFile(const QString &filePath);
-  void parseLogLine(const QString &line, const QString &characterName);
-  void scanExistingLogs();
+  void parseLogLine(const QString &line, const QString &characterName,
+                    qint64 lineTime);
+  void handleClassifiedLine(LogLineKind kind,
+                            const QRegularExpressionMatch &match,
+                            const QString &characterName, qint64 lineTime);
+  void parseIntelLine(const QString &line, const QString &channel,
+                      qint64 lineTime);
+  void matchAlertRules(const QString &line, const QString &characterName,
+                       bool isChatLog, qint64 lineTime);
+  bool isLiveRead() const;
+  bool isStale(qint64 timestamp) const;
+  static QByteArrayView pendingData(const LogFileState *state);
+  qint64 newestLineTime(const LogFileState *state) const;
+  void attachIntelLogs(QSet<QString> &monitoredFiles);
+  void attachLogFiles();
   void handleMiningEvent(const QString &characterName, const QString &ore);
   void onMiningTimeout(const QString &characterName);
-  void updateCustomNameCache();
 
   // Polling-based monitoring methods
   bool readNewLines(LogFileState *state);
-  bool shouldParseLine(const QString &line, bool isChatLog);
-  void updatePollingRate(bool hadActivity);
+  void schedulePoll(LogFileState *state);
   void readInitialState(LogFileState *state);
+  QString findLastMatchingLine(
+      QFile &file, qint64 fileSize, bool isChatLog,
+      const std::function<bool(const QString &)> &matches);
+  bool openLogFile(LogFileState *state);
+  void updateFileWatches();
+
+  // Event delivery; batched events are emitted once per poll by flushEvents()
+  void queueSystemChanged(const QString &characterName,
+                          const QString &systemName, qint64 timestamp);
+  void queueCombatEvent(const QString &characterName, const QString &eventType,
+                        const QString &eventText, qint64 timestamp);
+  void flushEvents();
+
+  void countEmittedEvent();
+
+  LogPipelineStats &m_stats; // Shared by all workers of the reader
+  quint64 m_eventsEmitted = 0; // This worker's share of m_stats.eventsEmitted
 
-  QString m_logDirectory;
-  QString m_gameLogDirectory;
   QStringList m_characterNames;
+  LogFileAssignment m_assignedFiles; // Latest files handed in by the reader
 
   // Polling-based monitoring state
   QHash<QString, LogFileState *> m_logFiles; // filePath -> state
+  QVector<LogPrefilter::LineRange> m_candidateLines; // Reused per read
+  LogLineClassifier m_lineClassifier;
+  std::unique_ptr<SolarSystemMatcher> m_systemMatcher; // Built on first use
+  QVector<SolarSystemMatcher::Match> m_intelMatches;   // Reused per line
+  LogAlertMatcher m_alertMatcher; // All user alert rules in one automaton
+  QVector<int> m_alertMatches;    // Reused per line
   QTimer *m_pollTimer;
-  QTimer *m_scanTimer;
-  QFileSystemWatcher *m_directoryWatcher; // Watch directories for new files
-  int m_currentPollInterval;
-  int m_activeFilesLastPoll;
+  QFileSystemWatcher *m_fileWatcher; // Watch monitored files (event mode)
+
+  // Hashed timing wheel of file paths; each poll tick checks only the files
+  // in its slot and reschedules them according to their own activity
+  QVector<QVector<QString>> m_pollWheel;
+  quint64 m_pollTick;
 
   // Character tracking
   QHash<QString, CharacterLocation> m_characterLocations;
   QHash<QString, QString> m_cachedCustomNames;
-  QHash<QString, QPair<QString, qint64>> m_fileToCharacterCache;
 
   QMutex m_mutex;
   bool m_running;
   bool m_enableChatLogMonitoring;
   bool m_enableGameLogMonitoring;
-  QDateTime m_lastChatDirScanTime;
-  QDateTime m_lastGameDirScanTime;
-  QHash<QString, QString> m_cachedChatListenerMap;
-  QHash<QString, QString> m_cachedGameListenerMap;
+  bool m_eventDrivenMonitoring;
+  bool m_batchedDelivery;
+  bool m_combatDamageTracking;
+  CombatDamageTracker m_damageTracker;
+  QElapsedTimer m_combatLogClock; // Since the newest combat line was read
+  QTimer *m_combatStatsTimer; // Throttles combatStatsUpdated
+  qint64 m_maxEventAgeMs; // Older alerts are dropped, 0 keeps everything
+  qint64 m_staleBefore = 0; // Alert cutoff of the current catch-up read
+  bool m_readingInitialState = false; // Queued events are not live
+  bool m_readingCatchUp = false;      // Nor are those of a catch-up read
+  QString m_dataDirectory; // May hold the user's system dictionary
+  int m_miningTimeoutMs;
+  LogEventBatch m_pendingEvents;
+  QHash<QString, int> m_pendingSystemChanges; // Character -> pending index
   QHash<QString, QTimer *> m_miningTimers;
   QHash<QString, bool> m_miningActiveState;
-  QSet<QString> m_knownChatLogFiles;
-  QSet<QString> m_knownGameLogFiles;
 
   // Polling rate constants
-  static constexpr int FAST_POLL_MS =
-      500; // Poll every 500ms when files are active
-  static constexpr int SLOW_POLL_MS = 1000; // Poll every 1000ms when idle
-  static constexpr int SCAN_INTERVAL_MS =
-      300000; // Scan for new files every 5 min
+  static constexpr int POLL_TICK_MS =
+      LogPollSchedule::TICK_MS; // Active files are checked every tick
+  static constexpr int POLL_WHEEL_SLOTS =
+      32; // Must exceed the longest delay in ticks
+  static constexpr qint64 MAP_THRESHOLD_BYTES =
+      1024 * 1024; // Initial scans at least this large use QFile::map
+  static constexpr int COMBAT_STATS_INTERVAL_MS =
+      1000; // Rolling DPS is published at most once per second
 };
 
 class ChatLogReader : public QObject {
@@ -135,33 +225,133 @@ public:
   void setGameLogDirectory(const QString &directory);
   void setEnableChatLogMonitoring(bool enabled);
   void setEnableGameLogMonitoring(bool enabled);
+  void setEventDrivenMonitoring(bool enabled);
+  void setWorkerCount(int count);
+  int workerCount() const;
+  void setBatchedDelivery(bool enabled);
+
+  /// Directory for the listener index and stats dumps, and for a user
+  /// system dictionary; nothing is persisted while it is empty
+  void setDataDirectory(const QString &directory);
+
+  /// Chat channels (by name, e.g. "Delve.Intel") whose lines are searched
+  /// for solar system names and reported via intelReported().
+  void setIntelChannels(const QStringList &channels);
+
+  /// Parses "(combat)" gamelog lines into rolling per-character damage
+  /// rates, published via combatStatsUpdated() about once per second.
+  void setCombatDamageTracking(bool enabled);
+
+  /// User rules checked against every line of the matching log type and
+  /// reported as combat events of type LogAlertRule::eventType().
+  void setLogAlertRules(const QVector<LogAlertRule> &rules);
+
+  /// Alerts (combat events and intel) read while catching up on a log, in
+  /// the first read after it was truncated or could not be opened when it
+  /// was attached, are dropped when their line is older than the newest
+  /// line of that read by more than this. Live reads are never checked, and
+  /// log times are only compared with each other, not with the local clock.
+  /// System changes are always delivered. 0 disables the check.
+  void setMaxEventAge(int seconds);
+
+  /// Seconds without a mining line before mining_stopped is reported
+  void setMiningTimeout(int seconds);
+
+  /// Thumbnail names shown instead of character names in fleet messages
+  void setCustomNames(const QHash<QString, QString> &customNames);
+
   void start();
   void stop();
   void refreshMonitoring();
 
   QString getSystemForCharacter(const QString &characterName) const;
   bool isMonitoring() const;
+  int guiWakeupsPerSecond() const;
+  LogPipelineStatsSnapshot statsSnapshot() const;
+  /// Adds a profile switch to the stats, so switch latency is written to
+  /// the same file as the reader's own timings
+  void recordProfileSwitch(qint64 micros);
+
+  /// Appends a statsSnapshot() row to a rotating CSV file in the profiles
+  /// directory every given number of seconds; 0 disables the dump.
+  void setStatsDumpInterval(int seconds);
 
 signals:
-  void systemChanged(const QString &characterName, const QString &systemName);
+  void systemChanged(const QString &characterName, const QString &systemName,
+                     qint64 timestamp);
   void characterLoggedIn(const QString &characterName);
   void characterLoggedOut(const QString &characterName);
   void combatEventDetected(const QString &characterName,
-                           const QString &eventType, const QString &eventText);
+                           const QString &eventType, const QString &eventText,
+                           qint64 timestamp);
+  void eventsBatched(const LogEventBatch &events);
+  void intelReported(const QString &channel, const QString &systemName,
+                     const QString &text, qint64 timestamp);
+  void combatStatsUpdated(const CombatDamageStatsList &stats);
   void monitoringStarted();
   void monitoringStopped();
 
 private slots:
   void handleSystemChanged(const QString &characterName,
-                           const QString &systemName);
+                           const QString &systemName, qint64 timestamp);
+  void handleCombatEventDetected(const QString &characterName,
+                                 const QString &eventType,
+                                 const QString &eventText, qint64 timestamp);
+  void handleEventsBatched(const LogEventBatch &events);
+  void handleLogFilesChanged(const LogFileAssignment &files);
+  void dumpStats();
 
 private:
-  QThread *m_workerThread;
-  ChatLogWorker *m_worker;
+  /// One worker with its own thread, timers and file state. Characters and
+  /// their log files are assigned to shards by a stable hash of their name;
+  /// the files themselves are found once for all shards by m_discovery.
+  struct Shard {
+    QThread *thread;
+    ChatLogWorker *worker;
+  };
+
+  void createShards(int count);
+  void destroyShards();
+  int shardFor(const QString &characterName) const;
+  void distributeCharacters();
+  void distributeLogFiles();
+  void recordGuiWakeup();
+  void recordDeliveryDelay(qint64 timestamp);
+  static void writeStatsRow(const QString &basePath, const QString &row);
+
+  LogPipelineStats m_stats;
+  QTimer *m_statsDumpTimer;
+  QThreadPool m_statsPool; // One thread, so rows reach the file in order
+  QVector<Shard> m_shards;
+  QThread *m_discoveryThread;
+  LogFileDiscovery *m_discovery;
+  LogFileAssignment m_logFileAssignment; // Latest result of m_discovery
+  QStringList m_characterNames;
+  QString m_logDirectory;
+  QString m_gameLogDirectory;
+  bool m_enableChatLogMonitoring;
+  bool m_enableGameLogMonitoring;
+  bool m_eventDrivenMonitoring;
+  bool m_batchedDelivery;
+  QStringList m_intelChannels;
+  bool m_combatDamageTracking;
+  QVector<LogAlertRule> m_logAlertRules;
+  int m_maxEventAgeSeconds;
+  QString m_dataDirectory;
+  int m_miningTimeoutSeconds;
+  QHash<QString, QString> m_customNames;
   mutable QMutex m_locationMutex;
   QHash<QString, QString> m_characterSystems;
   bool m_monitoring;
   QSet<QString> m_lastCharacterSet;
+
+  // Queued deliveries into the GUI thread, counted per one second window
+  QElapsedTimer m_wakeupWindow;
+  int m_wakeupsInWindow;
+  int m_guiWakeupsPerSecond;
+
+  static constexpr qint64 STATS_FILE_MAX_BYTES = 1024 * 1024;
+  static constexpr int STATS_FILE_KEEP = 2; // Rotated files besides current
 };
 
 #endif
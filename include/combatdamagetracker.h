@@ -0,0 +1,76 @@
+#ifndef COMBATDAMAGETRACKER_H
+#define COMBATDAMAGETRACKER_H
+
+#include <QHash>
+#include <QMetaType>
+#include <QString>
+#include <QStringView>
+#include <QVector>
+#include <array>
+
+/// Damage of one "(combat)" gamelog line
+struct CombatHit {
+  int damage = 0;
+  bool outgoing = false; // Dealt by the character rather than received
+};
+
+/// Rolling damage rates of one character
+struct CombatDamageStats {
+  QString characterName;
+  double dpsOutShort = 0.0; // Over the last 5 s
+  double dpsInShort = 0.0;
+  double dpsOutLong = 0.0; // Over the last 60 s
+  double dpsInLong = 0.0;
+
+  bool isIdle() const { return dpsOutLong == 0.0 && dpsInLong == 0.0; }
+};
+
+using CombatDamageStatsList = QVector<CombatDamageStats>;
+Q_DECLARE_METATYPE(CombatDamageStatsList)
+
+/// Per-character damage dealt and received in one-second buckets. Each
+/// character has a fixed ring covering the long window, so recording a hit
+/// and reading the rates never allocate once the character is known.
+class CombatDamageTracker {
+public:
+  static constexpr int SHORT_WINDOW_SECONDS = 5;
+  static constexpr int LONG_WINDOW_SECONDS = 60;
+
+  /// Extracts the damage of a "(combat)" line without regular expressions,
+  /// e.g. "[ ... ] (combat) <color=..><b>523</b> <font ..>to</font> ...".
+  /// Misses and other combat notices without a damage figure are rejected.
+  static bool parseLine(QStringView line, CombatHit &hit);
+
+  void record(const QString &characterName, qint64 timestampMs,
+              const CombatHit &hit);
+
+  /// Rates of every tracked character at nowMs, a time on the log clock
+  /// (see newestTimestamp()). A character without damage in the long
+  /// window is reported idle once and then forgotten.
+  CombatDamageStatsList takeStats(qint64 nowMs);
+
+  /// Newest line time recorded, in ms since epoch. Buckets are keyed by
+  /// log time, so callers move the window from here rather than from the
+  /// local wall clock, which may differ from the client's by seconds.
+  qint64 newestTimestamp() const { return m_newestTimestampMs; }
+
+  bool isEmpty() const { return m_windows.isEmpty(); }
+  void clear() {
+    m_windows.clear();
+    m_newestTimestampMs = 0;
+  }
+
+private:
+  struct Window {
+    std::array<quint32, LONG_WINDOW_SECONDS> dealt{};
+    std::array<quint32, LONG_WINDOW_SECONDS> received{};
+    qint64 headSecond = 0; // Newest second with a bucket
+
+    void advance(qint64 second);
+  };
+
+  QHash<QString, Window> m_windows;
+  qint64 m_newestTimestampMs = 0;
+};
+
+#endif
@@ -2,6 +2,9 @@
 #define CONFIG_H
 
 #include "borderstyle.h"
+#include "configschema.h"
+#include "logalertmatcher.h"
+#include "settingsmap.h"
 #include <QColor>
 #include <QFont>
 #include <QHash>
@@ -9,13 +12,81 @@
 #include <QPair>
 #include <QPoint>
 #include <QRect>
+#include <QSet>
 #include <QSettings>
+#include <QSize>
 #include <QString>
 #include <QStringList>
 #include <QVector>
+#include <atomic>
+#include <limits>
 #include <memory>
 
 struct HotkeyBinding;
+class ProfilePreloader;
+class SettingsWriter;
+
+/// All per-character settings of the current profile. Unset values keep
+/// their defaults: invalid colours and sizes, a null rect, an empty custom
+/// name and (-1, -1) as position.
+struct CharacterRecord {
+  QString name;
+  QPoint thumbnailPosition{-1, -1};
+  QSize thumbnailSize{-1, -1};
+  QRect clientWindowRect;
+  QColor borderColor;
+  QColor inactiveBorderColor;
+  QString customName;
+};
+
+/// Immutable copy of the settings read while painting thumbnails and
+/// dispatching hotkeys. Config publishes a new one whenever one of them
+/// changes. Readers take one with Config::snapshot() per paint or per
+/// hotkey, so they never see half of an update, from any thread.
+struct ConfigSnapshot {
+  struct CharacterColors {
+    QColor border; // Invalid when the character has no own colour
+    QColor inactiveBorder;
+  };
+
+  struct CombatBorder {
+    QColor color;
+    BorderStyle style;
+  };
+
+  bool highlightActive = false;
+  QColor highlightColor;
+  int highlightBorderWidth = 0;
+  BorderStyle activeBorderStyle = BorderStyle::Solid;
+
+  bool showInactiveBorders = false;
+  QColor inactiveBorderColor;
+  int inactiveBorderWidth = 0;
+  BorderStyle inactiveBorderStyle = BorderStyle::Solid;
+
+  bool configDialogOpen = false;
+  bool hotkeysOnlyWhenEVEFocused = false;
+  QStringList processNames; // Of EVE clients, for the focus check
+
+  QVector<CharacterColors> characterColors; // By Config::characterId()
+  QHash<QString, CombatBorder> combatBorders; // Event types with a border
+
+  CharacterColors colorsOf(int characterId) const {
+    return characterId >= 0 && characterId < characterColors.size()
+               ? characterColors[characterId]
+               : CharacterColors();
+  }
+};
+
+/// What has to be applied again when switching from one profile to another,
+/// as found by Config::diffProfiles()
+struct ProfileDiff {
+  bool hotkeys = false;       // Bindings, cycle groups and hotkey options
+  bool layout = false;        // Thumbnail size, opacity, placement, visibility
+  bool overlays = false;      // Overlay text, borders and combat messages
+  bool logMonitoring = false; // Log directories and reader options
+  QSet<QString> thumbnails;   // Lower-case names with own changes
+};
 
 class Config {
 public:
@@ -31,6 +102,7 @@ public:
   void setHideThumbnailsWhenEVENotFocused(bool enabled);
 
   int eveFocusDebounceInterval() const;
+  void setEveFocusDebounceInterval(int interval);
 
   QColor highlightColor() const;
   void setHighlightColor(const QColor &color);
@@ -127,6 +199,19 @@ public:
   bool preserveLogoutPositions() const;
   void setPreserveLogoutPositions(bool enabled);
 
+  /// Current settings snapshot; safe to call from any thread
+  std::shared_ptr<const ConfigSnapshot> snapshot() const {
+    return m_snapshot.load(std::memory_order_acquire);
+  }
+
+  /// Dense id of a character, registered on first use. Ids stay the same
+  /// for the whole session, across profile switches, so widgets can look
+  /// up their character without hashing its name.
+  int characterId(const QString &characterName) const;
+  /// Copy of the record of a characterId(), or an empty record for a
+  /// negative id. A copy, because registering a character moves the table.
+  CharacterRecord characterRecord(int id) const;
+
   QPoint getThumbnailPosition(const QString &characterName) const;
   void setThumbnailPosition(const QString &characterName, const QPoint &pos);
 
@@ -254,6 +339,35 @@ public:
       const; // Returns path without variable expansion (for UI)
   void setGameLogDirectory(const QString &directory);
 
+  bool eventDrivenLogMonitoring() const;
+  void setEventDrivenLogMonitoring(bool enabled);
+
+  int logWorkerCount() const;
+  void setLogWorkerCount(int count);
+
+  bool batchedLogEventDelivery() const;
+  void setBatchedLogEventDelivery(bool enabled);
+
+  int logStatsDumpIntervalSeconds() const;
+  void setLogStatsDumpIntervalSeconds(int seconds);
+
+  QStringList intelChannels() const;
+  void setIntelChannels(const QStringList &channels);
+
+  int intelAlertJumps() const;
+  void setIntelAlertJumps(int jumps);
+
+  bool combatDamageTracking() const;
+  void setCombatDamageTracking(bool enabled);
+
+  int logMaxEventAgeSeconds() const;
+  void setLogMaxEventAgeSeconds(int seconds);
+
+  /// Alert rules on log lines; matches are shown as combat events of type
+  /// LogAlertRule::eventType() in the rule's colour
+  QVector<LogAlertRule> logAlertRules() const;
+  void setLogAlertRules(const QVector<LogAlertRule> &rules);
+
   static QString getDefaultChatLogDirectory();
   static QString getDefaultGameLogDirectory();
 
@@ -291,6 +405,11 @@ public:
   bool suppressCombatWhenFocused() const;
   void setSuppressCombatWhenFocused(bool enabled);
 
+  /// Treat the same event on several characters within a short window as
+  /// one fleet-wide event: one sound, one shared message lifetime
+  bool correlateFleetEvents() const;
+  void setCorrelateFleetEvents(bool enabled);
+
   bool combatEventSoundEnabled(const QString &eventType) const;
   void setCombatEventSoundEnabled(const QString &eventType, bool enabled);
 
@@ -309,8 +428,34 @@ public:
 
   QString configFilePath() const;
 
+  /// Keys of the schema settings whose value in the given profile differs
+  /// from the current one
+  QStringList changedSettings(const SettingsMap &values) const;
+
+  /// Parses every profile on a background thread, so that loadProfile()
+  /// and profileValues() find them in memory
+  void preloadProfiles();
+  /// The profile as stored, from memory unless its file changed since it
+  /// was preloaded; for the current profile, currentProfileValues()
+  SettingsMap profileValues(const QString &profileName);
+  /// The current profile with every change made since it was loaded,
+  /// including those still waiting to be written
+  const SettingsMap &currentProfileValues() const { return m_values; }
+
+  /// Sets or removes a key of the current profile that has no accessor of
+  /// its own, such as the bindings HotkeyManager stores in its own format
+  void writeValue(const QString &key, const QVariant &value);
+  void removeValue(const QString &key);
+  static ProfileDiff diffProfiles(const SettingsMap &from,
+                                  const SettingsMap &to);
+
+  /// Writes every pending change to the profile file before returning;
+  /// setters otherwise reach the file a moment later on a background thread
   void save();
 
+  /// Folder of the profile files; also holds the log index and the
+  /// user's own star map and system list
+  QString getProfilesDirectory() const;
   QStringList listProfiles() const;
   QString getCurrentProfileName() const;
   bool loadProfile(const QString &profileName);
@@ -358,6 +503,8 @@ public:
   static constexpr int DEFAULT_UI_INACTIVE_BORDER_WIDTH = 2;
   static constexpr int DEFAULT_INACTIVE_BORDER_STYLE =
       static_cast<int>(BorderStyle::Solid);
+  static constexpr int BORDER_STYLE_MIN = static_cast<int>(BorderStyle::Solid);
+  static constexpr int BORDER_STYLE_MAX = static_cast<int>(BorderStyle::Zigzag);
 
   static constexpr int DEFAULT_THUMBNAIL_WIDTH = 240;
   static constexpr int DEFAULT_THUMBNAIL_HEIGHT = 135;
@@ -405,6 +552,15 @@ public:
 
   static constexpr bool DEFAULT_CHATLOG_ENABLE_MONITORING = false;
   static constexpr bool DEFAULT_GAMELOG_ENABLE_MONITORING = false;
+  static constexpr bool DEFAULT_LOG_EVENT_DRIVEN_MONITORING = false;
+  static constexpr int DEFAULT_LOG_WORKER_COUNT = 1;
+  static constexpr int LOG_WORKER_COUNT_MIN = 1;
+  static constexpr int LOG_WORKER_COUNT_MAX = 8;
+  static constexpr bool DEFAULT_LOG_BATCHED_DELIVERY = true;
+  static constexpr int DEFAULT_LOG_STATS_DUMP_INTERVAL_SECONDS = 0; // Off
+  static constexpr int DEFAULT_INTEL_ALERT_JUMPS = 0; // Same system only
+  static constexpr bool DEFAULT_COMBAT_DAMAGE_TRACKING = false;
+  static constexpr int DEFAULT_LOG_MAX_EVENT_AGE_SECONDS = 60;
 
   static constexpr bool DEFAULT_COMBAT_MESSAGES_ENABLED = false;
   static constexpr int DEFAULT_COMBAT_MESSAGE_DURATION = 5000;
@@ -415,6 +571,7 @@ public:
   static constexpr int DEFAULT_MINING_TIMEOUT_SECONDS = 30;
   static constexpr bool DEFAULT_COMBAT_EVENT_BORDER_HIGHLIGHT = false;
   static constexpr bool DEFAULT_COMBAT_SUPPRESS_FOCUSED = true;
+  static constexpr bool DEFAULT_COMBAT_CORRELATE_FLEET_EVENTS = false;
   static constexpr int DEFAULT_COMBAT_BORDER_STYLE =
       static_cast<int>(BorderStyle::Dashed);
   static constexpr bool DEFAULT_COMBAT_SOUND_ENABLED = false;
@@ -429,100 +586,61 @@ private:
   Config();
   ~Config();
 
-  std::unique_ptr<QSettings> m_settings;
+  SettingsMap m_values; // The profile as loaded plus the changes since
+  // Destroyed after the writer, whose thread may still be preloading
+  std::unique_ptr<ProfilePreloader> m_preloader;
+  std::unique_ptr<SettingsWriter> m_writer; // Setters write through this
+
+  // Cache of the schema settings, m_cached<Name> for each entry
+#define CONFIG_BOOL_CACHE(getter, setter, name, ...)                           \
+  mutable bool m_cached##name;
+#define CONFIG_INT_CACHE(getter, setter, name, ...)                            \
+  mutable int m_cached##name;
+#define CONFIG_COLOR_CACHE(getter, setter, name, ...)                          \
+  mutable QColor m_cached##name;
+#define CONFIG_STYLE_CACHE(getter, setter, name, ...)                          \
+  mutable BorderStyle m_cached##name;
+  CONFIG_BOOL_SETTINGS(CONFIG_BOOL_CACHE)
+  CONFIG_INT_SETTINGS(CONFIG_INT_CACHE)
+  CONFIG_COLOR_SETTINGS(CONFIG_COLOR_CACHE)
+  CONFIG_STYLE_SETTINGS(CONFIG_STYLE_CACHE)
+#undef CONFIG_BOOL_CACHE
+#undef CONFIG_INT_CACHE
+#undef CONFIG_COLOR_CACHE
+#undef CONFIG_STYLE_CACHE
 
-  mutable bool m_cachedHighlightActive;
-  mutable bool m_cachedHideActiveThumbnail;
-  mutable bool m_cachedHideThumbnailsWhenEVENotFocused;
-  mutable int m_cachedEveFocusDebounceInterval;
-  mutable QColor m_cachedHighlightColor;
-  mutable int m_cachedHighlightBorderWidth;
-  mutable BorderStyle m_cachedActiveBorderStyle;
-
-  mutable bool m_cachedShowInactiveBorders;
-  mutable QColor m_cachedInactiveBorderColor;
-  mutable int m_cachedInactiveBorderWidth;
-  mutable BorderStyle m_cachedInactiveBorderStyle;
-
-  mutable int m_cachedThumbnailWidth;
-  mutable int m_cachedThumbnailHeight;
-  mutable int m_cachedThumbnailOpacity;
-
-  mutable bool m_cachedShowNotLoggedIn;
-  mutable int m_cachedNotLoggedInStackMode;
   mutable QPoint m_cachedNotLoggedInReferencePosition;
-  mutable bool m_cachedShowNotLoggedInOverlay;
-  mutable bool m_cachedShowNonEVEOverlay;
-
   mutable QStringList m_cachedProcessNames;
-
-  mutable bool m_cachedAlwaysOnTop;
-  mutable bool m_cachedSwitchOnMouseDown;
-  mutable bool m_cachedDragWithRightClick;
-  mutable bool m_cachedMinimizeInactive;
-  mutable int m_cachedMinimizeDelay;
   mutable QStringList m_cachedNeverMinimizeCharacters;
   mutable QStringList m_cachedNeverCloseCharacters;
   mutable QStringList m_cachedHiddenCharacters;
-  mutable bool m_cachedSaveClientLocation;
-
-  mutable bool m_cachedRememberPositions;
-  mutable bool m_cachedPreserveLogoutPositions;
-  mutable bool m_cachedEnableSnapping;
-  mutable int m_cachedSnapDistance;
-  mutable bool m_cachedLockPositions;
 
-  mutable bool m_cachedWildcardHotkeys;
-  mutable bool m_cachedHotkeysOnlyWhenEVEFocused;
-  mutable bool m_cachedResetGroupIndexOnNonGroupFocus;
-
-  mutable bool m_cachedShowCharacterName;
-  mutable QColor m_cachedCharacterNameColor;
-  mutable int m_cachedCharacterNamePosition;
   mutable QFont m_cachedCharacterNameFont;
-  mutable int m_cachedCharacterNameOffsetX;
-  mutable int m_cachedCharacterNameOffsetY;
-  mutable bool m_cachedShowSystemName;
-  mutable bool m_cachedUniqueSystemNameColors;
-  mutable QColor m_cachedSystemNameColor;
-  mutable int m_cachedSystemNamePosition;
   mutable QFont m_cachedSystemNameFont;
-  mutable int m_cachedSystemNameOffsetX;
-  mutable int m_cachedSystemNameOffsetY;
-  mutable bool m_cachedShowOverlayBackground;
-  mutable QColor m_cachedOverlayBackgroundColor;
-  mutable int m_cachedOverlayBackgroundOpacity;
   mutable QFont m_cachedOverlayFont;
 
-  mutable bool m_cachedEnableChatLogMonitoring;
   mutable QString m_cachedChatLogDirectory;
-  mutable bool m_cachedEnableGameLogMonitoring;
   mutable QString m_cachedGameLogDirectory;
+  mutable QStringList m_cachedIntelChannels;
+  mutable QVector<LogAlertRule> m_cachedLogAlertRules;
+  mutable QHash<QString, QColor> m_cachedLogAlertColors; // By event type
 
-  mutable bool m_cachedShowCombatMessages;
-  mutable int m_cachedCombatMessagePosition;
   mutable QFont m_cachedCombatMessageFont;
-  mutable int m_cachedCombatMessageOffsetX;
-  mutable int m_cachedCombatMessageOffsetY;
   mutable QMap<QString, QColor> m_cachedCombatEventColors;
   mutable QMap<QString, int> m_cachedCombatEventDurations;
   mutable QMap<QString, bool> m_cachedCombatEventBorderHighlights;
   mutable QMap<QString, bool> m_cachedCombatEventSuppressFocused;
-  mutable bool m_cachedSuppressCombatWhenFocused;
   mutable QMap<QString, BorderStyle> m_cachedCombatBorderStyles;
   mutable QStringList m_cachedEnabledCombatEventTypes;
-  mutable int m_cachedMiningTimeoutSeconds;
   mutable QMap<QString, bool> m_cachedCombatEventSoundsEnabled;
   mutable QMap<QString, QString> m_cachedCombatEventSoundFiles;
   mutable QMap<QString, int> m_cachedCombatEventSoundVolumes;
 
-  mutable QHash<QString, QColor> m_cachedCharacterBorderColors;
-  mutable QHash<QString, QColor> m_cachedCharacterInactiveBorderColors;
-  mutable QHash<QString, QPoint> m_cachedThumbnailPositions;
-  mutable QHash<QString, QSize> m_cachedThumbnailSizes;
+  std::atomic<std::shared_ptr<const ConfigSnapshot>> m_snapshot;
+
+  mutable QHash<QString, int> m_characterIds;   // Name to index below
+  mutable QVector<CharacterRecord> m_characters; // Indexed by characterId()
   mutable QHash<QString, QSize> m_cachedProcessThumbnailSizes;
-  mutable QHash<QString, QString> m_cachedCustomThumbnailNames;
-  mutable QHash<QString, QRect> m_cachedClientWindowRects;
   mutable QHash<QString, QColor> m_cachedSystemNameColors;
 
   bool m_configDialogOpen = false;
@@ -530,146 +648,114 @@ private:
   QString m_currentProfileName;
   std::unique_ptr<QSettings> m_globalSettings;
 
-  void loadCacheFromSettings();
+  void loadCacheFromSettings(const SettingsMap &values);
+  void publishSnapshot();
+
+  // Tables of the schema settings, generated from configschema.h. They
+  // drive loading, the defaults of new profiles, changedSettings() and the
+  // setters. Strings, paths, fonts, lists and per-character or per-event
+  // groups need their own parsing and keep hand-written code.
+  static constexpr int NO_MINIMUM = std::numeric_limits<int>::min();
+  static constexpr int NO_MAXIMUM = std::numeric_limits<int>::max();
+
+  struct BoolSetting {
+    const char *key;
+    bool defaultValue;
+    bool Config::*cache;
+    bool inSnapshot;
+  };
+  struct IntSetting {
+    const char *key;
+    int defaultValue;
+    int Config::*cache;
+    bool inSnapshot;
+    int minimum;
+    int maximum;
+  };
+  struct ColorSetting {
+    const char *key;
+    const char *defaultValue;
+    QColor Config::*cache;
+    bool inSnapshot;
+  };
+  struct StyleSetting {
+    const char *key;
+    int defaultValue;
+    BorderStyle Config::*cache;
+    bool inSnapshot;
+    int minimum = BORDER_STYLE_MIN;
+    int maximum = BORDER_STYLE_MAX;
+  };
+
+  // Index of each entry in its table, <Name>Setting
+#define CONFIG_SETTING_INDEX(getter, setter, name, ...) name##Setting,
+  enum BoolSettingIndex { CONFIG_BOOL_SETTINGS(CONFIG_SETTING_INDEX) };
+  enum IntSettingIndex { CONFIG_INT_SETTINGS(CONFIG_SETTING_INDEX) };
+  enum ColorSettingIndex { CONFIG_COLOR_SETTINGS(CONFIG_SETTING_INDEX) };
+  enum StyleSettingIndex { CONFIG_STYLE_SETTINGS(CONFIG_SETTING_INDEX) };
+#undef CONFIG_SETTING_INDEX
+
+  static const BoolSetting BOOL_SETTINGS[];
+  static const IntSetting INT_SETTINGS[];
+  static const ColorSetting COLOR_SETTINGS[];
+  static const StyleSetting STYLE_SETTINGS[];
+
+  // The setters of all schema settings: write the key, keep the value in
+  // range, cache it and publish a snapshot if one holds it
+  void setSetting(const BoolSetting &setting, bool value);
+  void setSetting(const IntSetting &setting, int value);
+  void setSetting(const ColorSetting &setting, const QColor &color);
+  void setSetting(const StyleSetting &setting, BorderStyle style);
+
+  void loadSchemaSettings(const SettingsMap &values);
+  static void writeSchemaDefaults(QSettings &settings);
+
+  CharacterRecord findCharacter(const QString &characterName) const;
+  CharacterRecord &characterForUpdate(const QString &characterName);
 
-  QString getProfilesDirectory() const;
   QString getProfileFilePath(const QString &profileName) const;
   QString getGlobalSettingsPath() const;
   void ensureProfilesDirectoryExists() const;
   void migrateToProfileSystem();
-  void migrateLegacyCombatKeys();
+  void migrateLegacyCombatKeys(SettingsMap &values);
   void initializeDefaultProfile();
+  void openProfileSettings(const QString &profilePath);
   void loadGlobalSettings();
   void saveGlobalSettings();
 
   static constexpr const char *KEY_CONFIG_VERSION = "config/version";
 
-  static constexpr const char *KEY_UI_HIGHLIGHT_ACTIVE =
-      "ui/highlightActiveWindow";
-  static constexpr const char *KEY_UI_HIGHLIGHT_COLOR = "ui/highlightColor";
-  static constexpr const char *KEY_UI_HIGHLIGHT_BORDER_WIDTH =
-      "ui/highlightBorderWidth";
-  static constexpr const char *KEY_UI_ACTIVE_BORDER_STYLE =
-      "ui/activeBorderStyle";
-
-  static constexpr const char *KEY_UI_SHOW_INACTIVE_BORDERS =
-      "ui/showInactiveBorders";
-  static constexpr const char *KEY_UI_INACTIVE_BORDER_COLOR =
-      "ui/inactiveBorderColor";
-  static constexpr const char *KEY_UI_INACTIVE_BORDER_WIDTH =
-      "ui/inactiveBorderWidth";
-  static constexpr const char *KEY_UI_INACTIVE_BORDER_STYLE =
-      "ui/inactiveBorderStyle";
-
-  static constexpr const char *KEY_THUMBNAIL_WIDTH = "thumbnail/width";
-  static constexpr const char *KEY_THUMBNAIL_HEIGHT = "thumbnail/height";
-  static constexpr const char *KEY_UI_HIDE_ACTIVE_THUMBNAIL =
-      "ui/hideActiveClientThumbnail";
-  static constexpr const char *KEY_UI_HIDE_THUMBNAILS_WHEN_EVE_NOT_FOCUSED =
-      "ui/hideThumbnailsWhenEVENotFocused";
-  static constexpr const char *KEY_UI_EVE_FOCUS_DEBOUNCE_INTERVAL =
-      "ui/eveFocusDebounceInterval";
-  static constexpr const char *KEY_THUMBNAIL_OPACITY = "thumbnail/opacity";
   static constexpr const char *KEY_THUMBNAIL_PROCESS_NAMES =
       "thumbnail/processNames";
   static constexpr const char *KEY_THUMBNAIL_PROCESS_SIZES =
       "thumbnail/processSizes";
-  static constexpr const char *KEY_THUMBNAIL_SHOW_NOT_LOGGED_IN =
-      "thumbnail/showNotLoggedInClients";
-  static constexpr const char *KEY_THUMBNAIL_NOT_LOGGED_IN_STACK_MODE =
-      "thumbnail/notLoggedInStackMode";
   static constexpr const char *KEY_THUMBNAIL_NOT_LOGGED_IN_REF_POSITION =
       "thumbnail/notLoggedInReferencePosition";
-  static constexpr const char *KEY_THUMBNAIL_SHOW_NOT_LOGGED_IN_OVERLAY =
-      "thumbnail/showNotLoggedInOverlay";
-  static constexpr const char *KEY_THUMBNAIL_SHOW_NON_EVE_OVERLAY =
-      "thumbnail/showNonEVEOverlay";
-
-  static constexpr const char *KEY_WINDOW_ALWAYS_ON_TOP = "window/alwaysOnTop";
-  static constexpr const char *KEY_WINDOW_MINIMIZE_INACTIVE =
-      "window/minimizeInactiveClients";
-  static constexpr const char *KEY_WINDOW_MINIMIZE_DELAY =
-      "window/minimizeDelay";
+
   static constexpr const char *KEY_WINDOW_NEVER_MINIMIZE_CHARACTERS =
       "window/neverMinimizeCharacters";
   static constexpr const char *KEY_WINDOW_NEVER_CLOSE_CHARACTERS =
       "window/neverCloseCharacters";
   static constexpr const char *KEY_THUMBNAIL_HIDDEN_CHARACTERS =
       "thumbnail/hiddenCharacters";
-  static constexpr const char *KEY_WINDOW_SAVE_CLIENT_LOCATION =
-      "window/saveClientLocation";
-  static constexpr const char *KEY_WINDOW_SWITCH_ON_MOUSE_DOWN =
-      "window/switchOnMouseDown";
-  static constexpr const char *KEY_WINDOW_DRAG_WITH_RIGHT_CLICK =
-      "window/dragWithRightClick";
-
-  static constexpr const char *KEY_POSITION_REMEMBER =
-      "position/rememberPositions";
-  static constexpr const char *KEY_POSITION_PRESERVE_LOGOUT =
-      "position/preserveLogoutPositions";
-  static constexpr const char *KEY_POSITION_ENABLE_SNAPPING =
-      "position/enableSnapping";
-  static constexpr const char *KEY_POSITION_SNAP_DISTANCE =
-      "position/snapDistance";
-  static constexpr const char *KEY_POSITION_LOCK = "position/lockPositions";
-
-  static constexpr const char *KEY_HOTKEY_WILDCARD = "hotkey/wildcardMode";
-  static constexpr const char *KEY_HOTKEY_ONLY_WHEN_EVE_FOCUSED =
-      "hotkey/onlyWhenEVEFocused";
-  static constexpr const char *KEY_HOTKEY_RESET_GROUP_INDEX_ON_NON_GROUP_FOCUS =
-      "hotkey/resetGroupIndexOnNonGroupFocus";
-
-  static constexpr const char *KEY_OVERLAY_SHOW_CHARACTER =
-      "overlay/showCharacterName";
-  static constexpr const char *KEY_OVERLAY_CHARACTER_COLOR =
-      "overlay/characterNameColor";
-  static constexpr const char *KEY_OVERLAY_CHARACTER_POSITION =
-      "overlay/characterNamePosition";
+
   static constexpr const char *KEY_OVERLAY_CHARACTER_FONT =
       "overlay/characterNameFont";
-  static constexpr const char *KEY_OVERLAY_CHARACTER_OFFSET_X =
-      "overlay/characterNameOffsetX";
-  static constexpr const char *KEY_OVERLAY_CHARACTER_OFFSET_Y =
-      "overlay/characterNameOffsetY";
-  static constexpr const char *KEY_OVERLAY_SHOW_SYSTEM =
-      "overlay/showSystemName";
-  static constexpr const char *KEY_OVERLAY_UNIQUE_SYSTEM_COLORS =
-      "overlay/uniqueSystemNameColors";
-  static constexpr const char *KEY_OVERLAY_SYSTEM_COLOR =
-      "overlay/systemNameColor";
-  static constexpr const char *KEY_OVERLAY_SYSTEM_POSITION =
-      "overlay/systemNamePosition";
   static constexpr const char *KEY_OVERLAY_SYSTEM_FONT =
       "overlay/systemNameFont";
-  static constexpr const char *KEY_OVERLAY_SYSTEM_OFFSET_X =
-      "overlay/systemNameOffsetX";
-  static constexpr const char *KEY_OVERLAY_SYSTEM_OFFSET_Y =
-      "overlay/systemNameOffsetY";
-  static constexpr const char *KEY_OVERLAY_SHOW_BACKGROUND =
-      "overlay/showBackground";
-  static constexpr const char *KEY_OVERLAY_BACKGROUND_COLOR =
-      "overlay/backgroundColor";
-  static constexpr const char *KEY_OVERLAY_BACKGROUND_OPACITY =
-      "overlay/backgroundOpacity";
   static constexpr const char *KEY_OVERLAY_FONT = "overlay/font";
 
-  static constexpr const char *KEY_CHATLOG_ENABLE_MONITORING =
-      "chatlog/enableMonitoring";
   static constexpr const char *KEY_CHATLOG_DIRECTORY = "chatlog/directory";
 
-  static constexpr const char *KEY_GAMELOG_ENABLE_MONITORING =
-      "gamelog/enableMonitoring";
   static constexpr const char *KEY_GAMELOG_DIRECTORY = "gamelog/directory";
 
-  static constexpr const char *KEY_COMBAT_ENABLED = "combatMessages/enabled";
+  static constexpr const char *KEY_LOG_INTEL_CHANNELS =
+      "logMonitoring/intelChannels";
+  static constexpr const char *KEY_LOG_ALERT_RULES = "logAlertRules";
+
   static constexpr const char *KEY_COMBAT_DURATION = "combatMessages/duration";
-  static constexpr const char *KEY_COMBAT_POSITION = "combatMessages/position";
   static constexpr const char *KEY_COMBAT_COLOR = "combatMessages/color";
   static constexpr const char *KEY_COMBAT_FONT = "combatMessages/font";
-  static constexpr const char *KEY_COMBAT_OFFSET_X = "combatMessages/offsetX";
-  static constexpr const char *KEY_COMBAT_OFFSET_Y = "combatMessages/offsetY";
-  static constexpr const char *KEY_COMBAT_SUPPRESS_FOCUSED =
-      "combatMessages/suppressWhenFocused";
   static constexpr const char *KEY_COMBAT_ENABLED_EVENT_TYPES =
       "combatMessages/enabledEventTypes";
 
@@ -705,11 +791,10 @@ private:
         {"fleet_invite", "#4A9EFF"},   {"follow_warp", "#FFD700"},
         {"regroup", "#FF8C42"},        {"compression", "#7FFF00"},
         {"decloak", "#FFFFFF"},        {"crystal_broke", "#008080"},
-        {"mining_stopped", "#FF6B6B"}, {"convo_request", "#FFAAFF"}};
+        {"mining_stopped", "#FF6B6B"}, {"convo_request", "#FFAAFF"},
+        {"intel", "#FF4040"},          {"damage", "#FFA040"}};
   }
 
-  static constexpr const char *KEY_MINING_TIMEOUT_SECONDS =
-      "miningMode/timeoutSeconds";
 };
 
 #endif
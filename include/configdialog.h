@@ -1,6 +1,7 @@
 #ifndef CONFIGDIALOG_H
 #define CONFIGDIALOG_H
 
+#include "logalertmatcher.h"
 #include "settingbinding.h"
 #include <QCheckBox>
 #include <QComboBox>
@@ -86,6 +87,7 @@ private slots:
   void onResetProcessThumbnailSizesToDefault();
   void onBrowseChatLogDirectory();
   void onBrowseGameLogDirectory();
+  void onAddLogAlertRule();
   void onSetNotLoggedInPosition();
   void onSetClientLocations();
   void onCheckForUpdates();
@@ -151,6 +153,8 @@ private:
   void updateHiddenCharactersScrollHeight();
   QWidget *createProcessNamesFormRow(const QString &processName = "");
   void updateProcessNamesScrollHeight();
+  QWidget *createLogAlertRuleFormRow(const LogAlertRule &rule = LogAlertRule());
+  void updateLogAlertRulesScrollHeight();
 
   void parseLegacySettingsFile(const QString &filePath);
   void parseEVEXPreviewFile(const QVariantMap &rootMap);
@@ -366,8 +370,26 @@ private:
   QLineEdit *m_gameLogDirectoryEdit;
   QPushButton *m_gameLogBrowseButton;
   QLabel *m_gameLogDirectoryLabel;
+  QCheckBox *m_eventDrivenLogMonitoringCheck;
+  QCheckBox *m_batchedLogEventDeliveryCheck;
+  QCheckBox *m_combatDamageTrackingCheck;
+  QLabel *m_logWorkerCountLabel;
+  QSpinBox *m_logWorkerCountSpin;
+  QLabel *m_logStatsDumpLabel;
+  QSpinBox *m_logStatsDumpSpin;
+  QLabel *m_intelChannelsLabel;
+  QLineEdit *m_intelChannelsEdit;
+  QLabel *m_intelAlertJumpsLabel;
+  QSpinBox *m_intelAlertJumpsSpin;
+  QLabel *m_logMaxEventAgeLabel;
+  QSpinBox *m_logMaxEventAgeSpin;
+  QScrollArea *m_logAlertRulesScrollArea;
+  QWidget *m_logAlertRulesContainer;
+  QVBoxLayout *m_logAlertRulesLayout;
+  QPushButton *m_addLogAlertRuleButton;
 
   QCheckBox *m_showCombatMessagesCheck;
+  QCheckBox *m_correlateFleetEventsCheck;
   QComboBox *m_combatMessagePositionCombo;
   QLabel *m_combatMessagePositionLabel;
   QPushButton *m_combatMessageFontButton;
@@ -0,0 +1,183 @@
+#ifndef CONFIGSCHEMA_H
+#define CONFIGSCHEMA_H
+
+// The plain settings of a profile, one entry each: getter, setter, cache
+// member (m_cached<Name>), INI key, default and whether ConfigSnapshot holds
+// the value. Int entries give their accepted range before that flag; border
+// styles are bounded by the BorderStyle enum. Config expands these lists
+// into its cache members, the schema tables and the getter and setter
+// definitions, so a new setting needs an entry here and the declarations of
+// its getter and setter in config.h.
+//
+// The lists are expanded inside Config, so defaults and bounds name its
+// constants.
+
+#define CONFIG_BOOL_SETTINGS(X)                                                \
+  X(highlightActiveWindow, setHighlightActiveWindow, HighlightActive,          \
+    "ui/highlightActiveWindow", DEFAULT_UI_HIGHLIGHT_ACTIVE, true)             \
+  X(hideActiveClientThumbnail, setHideActiveClientThumbnail,                   \
+    HideActiveThumbnail, "ui/hideActiveClientThumbnail",                       \
+    DEFAULT_UI_HIDE_ACTIVE_THUMBNAIL, false)                                   \
+  X(hideThumbnailsWhenEVENotFocused, setHideThumbnailsWhenEVENotFocused,       \
+    HideThumbnailsWhenEVENotFocused, "ui/hideThumbnailsWhenEVENotFocused",     \
+    DEFAULT_UI_HIDE_THUMBNAILS_WHEN_EVE_NOT_FOCUSED, false)                    \
+  X(showInactiveBorders, setShowInactiveBorders, ShowInactiveBorders,          \
+    "ui/showInactiveBorders", DEFAULT_UI_SHOW_INACTIVE_BORDERS, true)          \
+  X(showNotLoggedInClients, setShowNotLoggedInClients, ShowNotLoggedIn,        \
+    "thumbnail/showNotLoggedInClients", DEFAULT_THUMBNAIL_SHOW_NOT_LOGGED_IN,  \
+    false)                                                                     \
+  X(showNotLoggedInOverlay, setShowNotLoggedInOverlay, ShowNotLoggedInOverlay, \
+    "thumbnail/showNotLoggedInOverlay",                                        \
+    DEFAULT_THUMBNAIL_SHOW_NOT_LOGGED_IN_OVERLAY, false)                       \
+  X(showNonEVEOverlay, setShowNonEVEOverlay, ShowNonEVEOverlay,                \
+    "thumbnail/showNonEVEOverlay", DEFAULT_THUMBNAIL_SHOW_NON_EVE_OVERLAY,     \
+    false)                                                                     \
+  X(alwaysOnTop, setAlwaysOnTop, AlwaysOnTop, "window/alwaysOnTop",            \
+    DEFAULT_WINDOW_ALWAYS_ON_TOP, false)                                       \
+  X(switchOnMouseDown, setSwitchOnMouseDown, SwitchOnMouseDown,                \
+    "window/switchOnMouseDown", DEFAULT_WINDOW_SWITCH_ON_MOUSE_DOWN, false)    \
+  X(useDragWithRightClick, setUseDragWithRightClick, DragWithRightClick,       \
+    "window/dragWithRightClick", DEFAULT_WINDOW_DRAG_WITH_RIGHT_CLICK, false)  \
+  X(minimizeInactiveClients, setMinimizeInactiveClients, MinimizeInactive,     \
+    "window/minimizeInactiveClients", DEFAULT_WINDOW_MINIMIZE_INACTIVE, false) \
+  X(saveClientLocation, setSaveClientLocation, SaveClientLocation,             \
+    "window/saveClientLocation", DEFAULT_WINDOW_SAVE_CLIENT_LOCATION, false)   \
+  X(rememberPositions, setRememberPositions, RememberPositions,                \
+    "position/rememberPositions", DEFAULT_POSITION_REMEMBER, false)            \
+  X(preserveLogoutPositions, setPreserveLogoutPositions,                       \
+    PreserveLogoutPositions, "position/preserveLogoutPositions",               \
+    DEFAULT_POSITION_PRESERVE_LOGOUT, false)                                   \
+  X(enableSnapping, setEnableSnapping, EnableSnapping,                         \
+    "position/enableSnapping", DEFAULT_POSITION_ENABLE_SNAPPING, false)        \
+  X(lockThumbnailPositions, setLockThumbnailPositions, LockPositions,          \
+    "position/lockPositions", DEFAULT_POSITION_LOCK, false)                    \
+  X(wildcardHotkeys, setWildcardHotkeys, WildcardHotkeys,                      \
+    "hotkey/wildcardMode", DEFAULT_HOTKEY_WILDCARD, false)                     \
+  X(hotkeysOnlyWhenEVEFocused, setHotkeysOnlyWhenEVEFocused,                   \
+    HotkeysOnlyWhenEVEFocused, "hotkey/onlyWhenEVEFocused",                    \
+    DEFAULT_HOTKEY_ONLY_WHEN_EVE_FOCUSED, true)                                \
+  X(resetGroupIndexOnNonGroupFocus, setResetGroupIndexOnNonGroupFocus,         \
+    ResetGroupIndexOnNonGroupFocus, "hotkey/resetGroupIndexOnNonGroupFocus",   \
+    DEFAULT_HOTKEY_RESET_GROUP_INDEX_ON_NON_GROUP_FOCUS, false)                \
+  X(showCharacterName, setShowCharacterName, ShowCharacterName,                \
+    "overlay/showCharacterName", DEFAULT_OVERLAY_SHOW_CHARACTER, false)        \
+  X(showSystemName, setShowSystemName, ShowSystemName,                         \
+    "overlay/showSystemName", DEFAULT_OVERLAY_SHOW_SYSTEM, false)              \
+  X(useUniqueSystemNameColors, setUseUniqueSystemNameColors,                   \
+    UniqueSystemNameColors, "overlay/uniqueSystemNameColors",                  \
+    DEFAULT_OVERLAY_UNIQUE_SYSTEM_COLORS, false)                               \
+  X(showOverlayBackground, setShowOverlayBackground, ShowOverlayBackground,    \
+    "overlay/showBackground", DEFAULT_OVERLAY_SHOW_BACKGROUND, false)          \
+  X(enableChatLogMonitoring, setEnableChatLogMonitoring,                       \
+    EnableChatLogMonitoring, "chatlog/enableMonitoring",                       \
+    DEFAULT_CHATLOG_ENABLE_MONITORING, false)                                  \
+  X(enableGameLogMonitoring, setEnableGameLogMonitoring,                       \
+    EnableGameLogMonitoring, "gamelog/enableMonitoring",                       \
+    DEFAULT_GAMELOG_ENABLE_MONITORING, false)                                  \
+  X(eventDrivenLogMonitoring, setEventDrivenLogMonitoring,                     \
+    EventDrivenLogMonitoring, "logMonitoring/eventDriven",                     \
+    DEFAULT_LOG_EVENT_DRIVEN_MONITORING, false)                                \
+  X(batchedLogEventDelivery, setBatchedLogEventDelivery,                       \
+    BatchedLogEventDelivery, "logMonitoring/batchedDelivery",                  \
+    DEFAULT_LOG_BATCHED_DELIVERY, false)                                       \
+  X(combatDamageTracking, setCombatDamageTracking, CombatDamageTracking,       \
+    "logMonitoring/combatDamageTracking", DEFAULT_COMBAT_DAMAGE_TRACKING,      \
+    false)                                                                     \
+  X(showCombatMessages, setShowCombatMessages, ShowCombatMessages,             \
+    "combatMessages/enabled", DEFAULT_COMBAT_MESSAGES_ENABLED, false)          \
+  X(suppressCombatWhenFocused, setSuppressCombatWhenFocused,                   \
+    SuppressCombatWhenFocused, "combatMessages/suppressWhenFocused",           \
+    DEFAULT_COMBAT_SUPPRESS_FOCUSED, false)                                    \
+  X(correlateFleetEvents, setCorrelateFleetEvents, CorrelateFleetEvents,       \
+    "combatMessages/correlateFleetEvents",                                     \
+    DEFAULT_COMBAT_CORRELATE_FLEET_EVENTS, false)
+
+#define CONFIG_INT_SETTINGS(X)                                                 \
+  X(eveFocusDebounceInterval, setEveFocusDebounceInterval,                     \
+    EveFocusDebounceInterval, "ui/eveFocusDebounceInterval",                   \
+    DEFAULT_EVE_FOCUS_DEBOUNCE_INTERVAL, NO_MINIMUM, NO_MAXIMUM, false)        \
+  X(highlightBorderWidth, setHighlightBorderWidth, HighlightBorderWidth,       \
+    "ui/highlightBorderWidth", DEFAULT_UI_HIGHLIGHT_BORDER_WIDTH, NO_MINIMUM,  \
+    NO_MAXIMUM, true)                                                          \
+  X(inactiveBorderWidth, setInactiveBorderWidth, InactiveBorderWidth,          \
+    "ui/inactiveBorderWidth", DEFAULT_UI_INACTIVE_BORDER_WIDTH, NO_MINIMUM,    \
+    NO_MAXIMUM, true)                                                          \
+  X(thumbnailWidth, setThumbnailWidth, ThumbnailWidth, "thumbnail/width",      \
+    DEFAULT_THUMBNAIL_WIDTH, NO_MINIMUM, NO_MAXIMUM, false)                    \
+  X(thumbnailHeight, setThumbnailHeight, ThumbnailHeight, "thumbnail/height",  \
+    DEFAULT_THUMBNAIL_HEIGHT, NO_MINIMUM, NO_MAXIMUM, false)                   \
+  X(thumbnailOpacity, setThumbnailOpacity, ThumbnailOpacity,                   \
+    "thumbnail/opacity", DEFAULT_THUMBNAIL_OPACITY, OPACITY_MIN, OPACITY_MAX,  \
+    false)                                                                     \
+  X(notLoggedInStackMode, setNotLoggedInStackMode, NotLoggedInStackMode,       \
+    "thumbnail/notLoggedInStackMode",                                          \
+    DEFAULT_THUMBNAIL_NOT_LOGGED_IN_STACK_MODE, NO_MINIMUM, NO_MAXIMUM, false) \
+  X(minimizeDelay, setMinimizeDelay, MinimizeDelay, "window/minimizeDelay",    \
+    DEFAULT_WINDOW_MINIMIZE_DELAY, NO_MINIMUM, NO_MAXIMUM, false)              \
+  X(snapDistance, setSnapDistance, SnapDistance, "position/snapDistance",      \
+    DEFAULT_POSITION_SNAP_DISTANCE, NO_MINIMUM, NO_MAXIMUM, false)             \
+  X(characterNamePosition, setCharacterNamePosition, CharacterNamePosition,    \
+    "overlay/characterNamePosition", DEFAULT_OVERLAY_CHARACTER_POSITION,       \
+    NO_MINIMUM, NO_MAXIMUM, false)                                             \
+  X(characterNameOffsetX, setCharacterNameOffsetX, CharacterNameOffsetX,       \
+    "overlay/characterNameOffsetX", DEFAULT_OVERLAY_OFFSET_X, NO_MINIMUM,      \
+    NO_MAXIMUM, false)                                                         \
+  X(characterNameOffsetY, setCharacterNameOffsetY, CharacterNameOffsetY,       \
+    "overlay/characterNameOffsetY", DEFAULT_OVERLAY_OFFSET_Y, NO_MINIMUM,      \
+    NO_MAXIMUM, false)                                                         \
+  X(systemNamePosition, setSystemNamePosition, SystemNamePosition,             \
+    "overlay/systemNamePosition", DEFAULT_OVERLAY_SYSTEM_POSITION, NO_MINIMUM, \
+    NO_MAXIMUM, false)                                                         \
+  X(systemNameOffsetX, setSystemNameOffsetX, SystemNameOffsetX,                \
+    "overlay/systemNameOffsetX", DEFAULT_OVERLAY_OFFSET_X, NO_MINIMUM,         \
+    NO_MAXIMUM, false)                                                         \
+  X(systemNameOffsetY, setSystemNameOffsetY, SystemNameOffsetY,                \
+    "overlay/systemNameOffsetY", DEFAULT_OVERLAY_OFFSET_Y, NO_MINIMUM,         \
+    NO_MAXIMUM, false)                                                         \
+  X(overlayBackgroundOpacity, setOverlayBackgroundOpacity,                     \
+    OverlayBackgroundOpacity, "overlay/backgroundOpacity",                     \
+    DEFAULT_OVERLAY_BACKGROUND_OPACITY, OPACITY_MIN, OPACITY_MAX, false)       \
+  X(logWorkerCount, setLogWorkerCount, LogWorkerCount,                         \
+    "logMonitoring/workerCount", DEFAULT_LOG_WORKER_COUNT,                     \
+    LOG_WORKER_COUNT_MIN, LOG_WORKER_COUNT_MAX, false)                         \
+  X(logStatsDumpIntervalSeconds, setLogStatsDumpIntervalSeconds,               \
+    LogStatsDumpIntervalSeconds, "logMonitoring/statsDumpIntervalSeconds",     \
+    DEFAULT_LOG_STATS_DUMP_INTERVAL_SECONDS, NO_MINIMUM, NO_MAXIMUM, false)    \
+  X(intelAlertJumps, setIntelAlertJumps, IntelAlertJumps,                      \
+    "logMonitoring/intelAlertJumps", DEFAULT_INTEL_ALERT_JUMPS, NO_MINIMUM,    \
+    NO_MAXIMUM, false)                                                         \
+  X(logMaxEventAgeSeconds, setLogMaxEventAgeSeconds, LogMaxEventAgeSeconds,    \
+    "logMonitoring/maxEventAgeSeconds", DEFAULT_LOG_MAX_EVENT_AGE_SECONDS,     \
+    NO_MINIMUM, NO_MAXIMUM, false)                                             \
+  X(combatMessagePosition, setCombatMessagePosition, CombatMessagePosition,    \
+    "combatMessages/position", DEFAULT_COMBAT_MESSAGE_POSITION, NO_MINIMUM,    \
+    NO_MAXIMUM, false)                                                         \
+  X(combatMessageOffsetX, setCombatMessageOffsetX, CombatMessageOffsetX,       \
+    "combatMessages/offsetX", DEFAULT_OVERLAY_OFFSET_X, NO_MINIMUM,            \
+    NO_MAXIMUM, false)                                                         \
+  X(combatMessageOffsetY, setCombatMessageOffsetY, CombatMessageOffsetY,       \
+    "combatMessages/offsetY", DEFAULT_OVERLAY_OFFSET_Y, NO_MINIMUM,            \
+    NO_MAXIMUM, false)                                                         \
+  X(miningTimeoutSeconds, setMiningTimeoutSeconds, MiningTimeoutSeconds,       \
+    "miningMode/timeoutSeconds", DEFAULT_MINING_TIMEOUT_SECONDS, NO_MINIMUM,   \
+    NO_MAXIMUM, false)
+
+#define CONFIG_COLOR_SETTINGS(X)                                               \
+  X(highlightColor, setHighlightColor, HighlightColor, "ui/highlightColor",    \
+    DEFAULT_UI_HIGHLIGHT_COLOR, true)                                          \
+  X(inactiveBorderColor, setInactiveBorderColor, InactiveBorderColor,          \
+    "ui/inactiveBorderColor", DEFAULT_UI_INACTIVE_BORDER_COLOR, true)          \
+  X(characterNameColor, setCharacterNameColor, CharacterNameColor,             \
+    "overlay/characterNameColor", DEFAULT_OVERLAY_CHARACTER_COLOR, false)      \
+  X(systemNameColor, setSystemNameColor, SystemNameColor,                      \
+    "overlay/systemNameColor", DEFAULT_OVERLAY_SYSTEM_COLOR, false)            \
+  X(overlayBackgroundColor, setOverlayBackgroundColor, OverlayBackgroundColor, \
+    "overlay/backgroundColor", DEFAULT_OVERLAY_BACKGROUND_COLOR, false)
+
+#define CONFIG_STYLE_SETTINGS(X)                                               \
+  X(activeBorderStyle, setActiveBorderStyle, ActiveBorderStyle,                \
+    "ui/activeBorderStyle", DEFAULT_ACTIVE_BORDER_STYLE, true)                 \
+  X(inactiveBorderStyle, setInactiveBorderStyle, InactiveBorderStyle,          \
+    "ui/inactiveBorderStyle", DEFAULT_INACTIVE_BORDER_STYLE, true)
+
+#endif
@@ -0,0 +1,21 @@
+#ifndef EVETIMESTAMP_H
+#define EVETIMESTAMP_H
+
+#include <QStringView>
+
+/// Parser for the fixed "YYYY.MM.DD HH:MM:SS" timestamps of EVE log lines.
+/// EVE logs are written in UTC (EVE time). Parsing reads the characters in
+/// place and never allocates.
+class EveTimestamp {
+public:
+  static constexpr int LENGTH = 19;
+
+  /// Milliseconds since epoch, or -1 if text is not exactly one timestamp
+  static qint64 parse(QStringView text);
+
+  /// Timestamp of a "[ YYYY.MM.DD HH:MM:SS ] ..." line (optionally after a
+  /// byte order mark), or -1 if the line does not start with one
+  static qint64 parseLine(QStringView line);
+};
+
+#endif
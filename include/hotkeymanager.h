@@ -9,7 +9,7 @@
 #include <QVector>
 #include <Windows.h>
 
-class QSettings;
+class SettingsMap;
 
 struct HotkeyBinding {
   int keyCode;
@@ -172,6 +172,9 @@ public:
   void uninstallMouseHook();
 
   void loadFromConfig();
+  /// Takes the hotkeys of a profile being switched to and registers again
+  /// only the bindings that differ from the current ones
+  void applyProfileHotkeys(const SettingsMap &values);
   void saveToConfig();
 
   void updateCharacterWindows(const QHash<QString, HWND> &characterWindows);
@@ -203,6 +206,8 @@ private:
   QHash<int, QString> m_hotkeyIdToCycleGroup;
   QHash<int, bool> m_hotkeyIdIsForward;
   QHash<int, int> m_wildcardAliases;
+  QHash<HotkeyBinding, int> m_characterBindingIds;
+  bool m_registeredWildcard = false; // Mode the hotkeys were registered in
   QHash<int, QString> m_hotkeyIdToProfile;
   QHash<QString, QVector<HotkeyBinding>> m_profileHotkeys;
 
@@ -271,10 +276,25 @@ private:
                           QSet<int> &outHotkeyIds);
   void registerHotkeyList(const QVector<HotkeyBinding> &multiHotkeys,
                           QSet<int> &outHotkeyIds, bool allowWildcard);
+  void updateHotkeyList(const QVector<HotkeyBinding> &oldHotkeys,
+                        const QVector<HotkeyBinding> &multiHotkeys,
+                        QSet<int> &hotkeyIds, bool allowWildcard);
+  /// Unregisters the hotkeys along with their wildcard aliases
+  void unregisterHotkeyIds(const QSet<int> &hotkeyIds);
   void unregisterAndReset(int &hotkeyId);
-  void saveHotkeyList(QSettings &settings, const QString &key,
+
+  /// Characters of each enabled binding
+  QHash<HotkeyBinding, QVector<QString>> characterBindings() const;
+  void registerCharacterBinding(const HotkeyBinding &binding,
+                                const QVector<QString> &characters);
+  void unregisterCharacterBinding(const HotkeyBinding &binding);
+  void registerCycleGroup(const QString &groupName, const CycleGroup &group);
+  void unregisterCycleGroup(const QString &groupName);
+
+  void readHotkeys(const SettingsMap &values);
+  void saveHotkeyList(const QString &key,
                       const QVector<HotkeyBinding> &multiHotkeys);
-  QVector<HotkeyBinding> loadHotkeyList(QSettings &settings,
+  QVector<HotkeyBinding> loadHotkeyList(const SettingsMap &values,
                                         const QString &key);
 };
 
@@ -0,0 +1,94 @@
+#ifndef LOGALERTMATCHER_H
+#define LOGALERTMATCHER_H
+
+#include <QColor>
+#include <QRegularExpression>
+#include <QString>
+#include <QVector>
+
+/// User-defined alert on log lines, stored in the profile. Matches are
+/// reported as combat events of type eventType().
+struct LogAlertRule {
+  enum Channel { AnyLog, ChatLog, GameLog };
+
+  QString name;
+  QString pattern; // Literal text (ASCII case-insensitive) or a regex
+  bool isRegex = false;
+  Channel channel = AnyLog;
+  QColor color;
+  bool enabled = true;
+
+  static constexpr const char *EVENT_TYPE_PREFIX = "alert:";
+
+  QString eventType() const { return EVENT_TYPE_PREFIX + name; }
+};
+
+/// Evaluates all enabled alert rules against a line in one pass, so the
+/// cost per line does not grow with the number of rules.
+///
+/// Literal rules are compiled into a single Aho-Corasick automaton. Every
+/// regex rule that has a literal run which must appear in any match adds
+/// that run to the same automaton and is only executed when it was seen.
+/// The remaining regex rules are joined into one alternation that rejects
+/// most lines with a single regex search.
+class LogAlertMatcher {
+public:
+  LogAlertMatcher();
+
+  /// Replaces the compiled rules; disabled, empty and invalid rules are
+  /// dropped (invalid regexes with a warning).
+  void compile(const QVector<LogAlertRule> &rules);
+
+  bool isEmpty() const { return m_rules.isEmpty(); }
+  bool hasRulesFor(bool isChatLog) const;
+
+  /// Appends the index into rules() of every rule matching line from the
+  /// given position on.
+  void match(const QString &line, bool isChatLog, QVector<int> &matched,
+             int from = 0) const;
+
+  const QVector<LogAlertRule> &rules() const { return m_rules; }
+
+private:
+  enum class Check {
+    None,     // The automaton hit is the match
+    Contains, // Literal with non-ASCII characters; confirm exactly
+    Regex     // Required literal of a regex seen; run the regex
+  };
+
+  struct CompiledRule {
+    QRegularExpression regex; // Invalid for literal rules
+    Check check = Check::None;
+    quint8 channels = 0; // CHAT_BIT and / or GAME_BIT
+  };
+
+  // 128 folded ASCII symbols plus one for any non-ASCII character
+  static constexpr int SYMBOL_COUNT = 129;
+  static constexpr int OTHER_SYMBOL = 128;
+  static constexpr quint8 CHAT_BIT = 1;
+  static constexpr quint8 GAME_BIT = 2;
+
+  static int symbolFor(ushort c);
+  static QString requiredLiteral(const QString &regex);
+
+  static void addLiteral(const QString &text, int ruleIndex,
+                         QVector<QVector<int>> &trie,
+                         QVector<QVector<int>> &outputs);
+  void buildTransitions(const QVector<QVector<int>> &trie,
+                        QVector<QVector<int>> &outputs);
+
+  QVector<LogAlertRule> m_rules;
+  QVector<CompiledRule> m_compiled;
+
+  QVector<int> m_next;        // Complete DFA: state * SYMBOL_COUNT + symbol
+  QVector<int> m_outputStart; // Rules recognised on entering state s are
+  QVector<int> m_outputs;     // m_outputs[m_outputStart[s]..[s + 1])
+
+  QVector<int> m_unanchoredRules; // Regex rules without a required literal
+  QRegularExpression m_unanchoredAny; // Alternation of all of them
+  quint8 m_channels = 0;              // Union of all rule channels
+
+  static constexpr int MIN_REQUIRED_LITERAL = 3; // Shorter runs filter little
+};
+
+#endif
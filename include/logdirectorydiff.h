@@ -0,0 +1,37 @@
+#ifndef LOGDIRECTORYDIFF_H
+#define LOGDIRECTORYDIFF_H
+
+#include <QDir>
+#include <QSet>
+#include <QString>
+#include <QStringList>
+
+/// Remembers the file names of a log directory, so that a change notification
+/// can be reduced to the files added or removed since the previous listing
+/// instead of rebuilding everything derived from the directory.
+class LogDirectoryDiff {
+public:
+  struct Changes {
+    QStringList added;   // Absolute paths
+    QStringList removed; // Absolute paths
+
+    bool isEmpty() const { return added.isEmpty() && removed.isEmpty(); }
+  };
+
+  LogDirectoryDiff() = default;
+
+  /// Lists dir and returns the differences to the previous listing. The
+  /// first listing after construction or reset() only seeds the entry set
+  /// and reports no changes.
+  Changes update(const QDir &dir, const QStringList &filters);
+
+  void reset();
+
+  bool isSeeded() const { return m_seeded; }
+
+private:
+  QSet<QString> m_entries; // Absolute paths
+  bool m_seeded = false;
+};
+
+#endif
@@ -0,0 +1,51 @@
+#ifndef LOGEVENTCORRELATOR_H
+#define LOGEVENTCORRELATOR_H
+
+#include <QHash>
+#include <QQueue>
+#include <QString>
+
+/// Groups identical events that arrive for several characters within a
+/// short window. A fleet warp or regroup, for example, writes a
+/// near-identical line to the gamelog of every fleet member.
+///
+/// Groups are keyed by event type and normalized text, and windows are
+/// measured in log time. Groups open in arrival order and all share one
+/// window length, so they also expire in that order; log lines of different
+/// characters arrive close enough to time order for this. Adding an event
+/// is therefore O(1) amortized.
+class LogEventCorrelator {
+public:
+  static constexpr qint64 DEFAULT_WINDOW_MS = 1500;
+
+  struct Result {
+    quint64 groupId; // Shared by all events of the group
+    bool opened;     // First event of the group
+  };
+
+  explicit LogEventCorrelator(qint64 windowMs = DEFAULT_WINDOW_MS);
+
+  /// Adds an event logged at timeMs (milliseconds) and returns its group.
+  /// Groups whose window has passed by then are closed first.
+  Result add(const QString &eventType, const QString &text, qint64 timeMs);
+
+  void clear();
+
+  /// Case-folded text with runs of whitespace collapsed
+  static QString normalize(const QString &text);
+
+private:
+  struct Group {
+    quint64 id = 0;
+    qint64 openedAt = 0;
+  };
+
+  void expire(qint64 timeMs);
+
+  QHash<QString, Group> m_open; // Key -> group in its window
+  QQueue<QString> m_openOrder;  // Keys in opening (and expiry) order
+  qint64 m_windowMs;
+  quint64 m_nextGroupId;
+};
+
+#endif
@@ -0,0 +1,111 @@
+#ifndef LOGFILEDISCOVERY_H
+#define LOGFILEDISCOVERY_H
+
+#include "logdirectorydiff.h"
+#include "logfileindex.h"
+#include <QDateTime>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFileInfo>
+#include <QFileSystemWatcher>
+#include <QFutureWatcher>
+#include <QHash>
+#include <QMetaType>
+#include <QMutex>
+#include <QObject>
+#include <QSet>
+#include <QString>
+#include <QStringList>
+#include <QThreadPool>
+#include <QTimer>
+
+/// Newest log file of every listener and intel channel, as found by one
+/// directory scan
+struct LogFileAssignment {
+  QHash<QString, QString> chatLogs;  // Lowercased listener -> file path
+  QHash<QString, QString> gameLogs;  // Lowercased listener -> file path
+  QHash<QString, QString> intelLogs; // Channel name -> file path
+  bool complete = true; // false while headers of some files are being read
+};
+Q_DECLARE_METATYPE(LogFileAssignment)
+
+/// Finds the log files of every character for all workers of a
+/// ChatLogReader: watches the log directories, diffs their listings,
+/// resolves "Listener:" headers through the persistent index and reads
+/// unindexed headers on a small thread pool. Runs on its own thread.
+class LogFileDiscovery : public QObject {
+  Q_OBJECT
+
+public:
+  explicit LogFileDiscovery(QObject *parent = nullptr);
+  ~LogFileDiscovery();
+
+  void setLogDirectory(const QString &directory);
+  void setGameLogDirectory(const QString &directory);
+  void setEnableChatLogMonitoring(bool enabled);
+  void setEnableGameLogMonitoring(bool enabled);
+  void setIntelChannels(const QStringList &channels);
+  void setDataDirectory(const QString &directory);
+
+  /// Reads the listener from the header of a log file
+  static QString readListenerFromLogFile(const QString &filePath);
+
+signals:
+  /// Emitted after every scan that may have changed the files
+  void logFilesChanged(const LogFileAssignment &files);
+
+public slots:
+  void startMonitoring();
+  void stopMonitoring();
+  void refreshMonitoring();
+  void checkForNewFiles();
+  void onDirectoryChanged(const QString &path);
+
+private slots:
+  void onHeaderScanFinished();
+
+private:
+  void scan();
+  bool applyDirectoryChanges(bool isChatLog);
+  QHash<QString, QString> buildListenerToFileMap(const QDir &dir,
+                                                 const QStringList &filters,
+                                                 int maxAgeHours,
+                                                 bool *complete);
+  QString findIntelLogFile(const QString &channel) const;
+  void startHeaderScan();
+
+  QMutex m_mutex;
+  bool m_running = false;
+  QString m_logDirectory;
+  QString m_gameLogDirectory;
+  bool m_enableChatLogMonitoring = true;
+  bool m_enableGameLogMonitoring = true;
+  QStringList m_intelChannels;
+  QString m_dataDirectory; // Holds the listener index
+
+  QTimer *m_scanTimer;
+  QFileSystemWatcher *m_directoryWatcher; // Watch directories for new files
+  LogFileIndex m_listenerIndex;           // Persistent file -> listener cache
+
+  // Parallel header extraction for files missing from the index
+  QThreadPool m_headerPool;
+  QFutureWatcher<QPair<QString, QString>> *m_headerWatcher;
+  QHash<QString, QFileInfo> m_pendingHeaderFiles; // Queued or being read
+  QStringList m_headerQueue;                      // Not yet submitted
+  QElapsedTimer m_headerScanTimer;
+
+  QDateTime m_lastChatDirScanTime;
+  QDateTime m_lastGameDirScanTime;
+  QHash<QString, QString> m_cachedChatListenerMap;
+  QHash<QString, QString> m_cachedGameListenerMap;
+  LogDirectoryDiff m_chatDirDiff;
+  LogDirectoryDiff m_gameDirDiff;
+  LogDirectoryDiff m_intelDirDiff;
+  QSet<QString> m_headerlessNewFiles; // Created before their header was written
+
+  static constexpr int MAX_HEADER_SCAN_THREADS = 4;
+  static constexpr int SCAN_INTERVAL_MS =
+      300000; // Backup diff of the log directories every 5 min
+};
+
+#endif
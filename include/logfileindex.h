@@ -0,0 +1,60 @@
+#ifndef LOGFILEINDEX_H
+#define LOGFILEINDEX_H
+
+#include <QFileInfo>
+#include <QHash>
+#include <QString>
+
+/// Persistent cache of the "Listener:" header of EVE log files, so that only
+/// new or replaced files have to be opened and parsed on startup.
+///
+/// Entries are keyed by path and only hold what is fixed once the header is
+/// read: the listener, the file identity (birth time) and the size at that
+/// point. Logs are append-only, so a file that only grew keeps its entry
+/// without touching the index; a file that shrank or was recreated under the
+/// same name is parsed again. The file is only rewritten when an entry was
+/// added, replaced or pruned.
+class LogFileIndex {
+public:
+  LogFileIndex() = default;
+
+  /// Loads the index from filePath; a missing or unreadable file yields an
+  /// empty index. Later saves go to the same path.
+  void load(const QString &filePath);
+
+  /// Writes the index back if it changed, dropping entries indexed before
+  /// the retention window that were not used since load().
+  void save();
+
+  /// Returns true and sets listener if the file is known and unchanged in
+  /// identity. An empty listener records a file without a header; such
+  /// entries only stay valid while the file keeps its size.
+  bool lookup(const QFileInfo &fileInfo, QString &listener);
+
+  void insert(const QFileInfo &fileInfo, const QString &listener);
+
+  bool isLoaded() const { return !m_filePath.isEmpty(); }
+
+private:
+  struct Entry {
+    QString listener;
+    qint64 fileId = 0;    // Birth time in ms since epoch, 0 if unknown
+    qint64 size = 0;      // When the header was read
+    qint64 indexedAt = 0; // ms since epoch
+    bool used = false;    // Looked up since load(); not saved
+  };
+
+  static qint64 fileIdFor(const QFileInfo &fileInfo);
+  void prune();
+
+  QString m_filePath;
+  QHash<QString, Entry> m_entries;
+  bool m_dirty = false;
+
+  static constexpr quint32 FILE_MAGIC = 0x4C464958; // "LFIX"
+  static constexpr quint32 FILE_VERSION = 2;
+  static constexpr qint64 RETENTION_MS =
+      7LL * 24 * 60 * 60 * 1000; // Logs are only looked up for 24h
+};
+
+#endif
@@ -0,0 +1,100 @@
+#ifndef LOGLINECLASSIFIER_H
+#define LOGLINECLASSIFIER_H
+
+#include <QRegularExpression>
+#include <QString>
+#include <QVarLengthArray>
+#include <QVector>
+
+enum class LogLineKind {
+  Unrecognized,
+  SystemChange,
+  FleetInvite,
+  FollowWarp,
+  Regroup,
+  Compression,
+  Decloak,
+  CrystalBroke,
+  AsteroidDepleted,
+  ConduitJump,
+  Mining,
+  Jump,
+  ConvoRequest
+};
+
+/// Classifies a log line in a single pass over its characters using an
+/// Aho-Corasick automaton built from the fixed literals that identify each
+/// event (markers such as "(notify)" plus the event keywords that follow
+/// them). A keyword only counts when it starts at or after the first
+/// occurrence of its marker. Matching is ASCII case-insensitive.
+class LogLineClassifier {
+public:
+  using Kinds = QVarLengthArray<LogLineKind, 4>;
+
+  /// The candidate whose extractor regex matched, with its captures
+  struct Extraction {
+    LogLineKind kind = LogLineKind::Unrecognized;
+    QRegularExpressionMatch match;
+  };
+
+  LogLineClassifier();
+
+  /// Candidate kinds in the order their extractor regexes must be tried:
+  /// when one regex does not match, the next candidate may still apply.
+  /// Empty when no event literal is found.
+  Kinds classify(const QString &line, int from = 0) const;
+
+  /// Runs the extractor regex of each candidate in turn and returns the
+  /// first that matches; kind is Unrecognized when none does.
+  static Extraction extract(const Kinds &candidates, const QString &line);
+
+  /// Extractor regex whose captures ChatLogWorker reads for a kind
+  static const QRegularExpression &patternFor(LogLineKind kind);
+
+private:
+  enum Literal : quint32 {
+    EveSystem = 1u << 0,
+    Question = 1u << 1,
+    Notify = 1u << 2,
+    MiningMarker = 1u << 3,
+    NoneMarker = 1u << 4,
+    Following = 1u << 5,
+    Regrouping = 1u << 6,
+    Compressed = 1u << 7,
+    CloakDeactivates = 1u << 8,
+    CrystalDestruction = 1u << 9,
+    PaleShadow = 1u << 10,
+    ConduitField = 1u << 11,
+    Jumping = 1u << 12,
+    Conversation = 1u << 13
+  };
+
+  static constexpr int LITERAL_COUNT = 14;
+
+  // 128 folded ASCII symbols plus one for any non-ASCII character
+  static constexpr int SYMBOL_COUNT = 129;
+  static constexpr int OTHER_SYMBOL = 128;
+
+  /// Where each literal was seen: its first and its last start offset
+  struct Occurrences {
+    int first[LITERAL_COUNT];
+    int last[LITERAL_COUNT];
+
+    bool has(Literal literal) const;
+    bool follows(Literal keyword, Literal marker) const;
+  };
+
+  static int symbolFor(ushort c);
+  static int indexOf(Literal literal);
+  static Kinds kindsFor(const Occurrences &seen);
+
+  void addLiteral(const char *text, Literal literal);
+  void buildTransitions();
+
+  QVector<QVector<int>> m_trie; // Goto function while building
+  QVector<int> m_next;          // Complete DFA: state * SYMBOL_COUNT + symbol
+  QVector<quint32> m_output;    // Literals recognised on entering a state
+  int m_lengths[LITERAL_COUNT] = {};
+};
+
+#endif
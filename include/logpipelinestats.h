@@ -0,0 +1,85 @@
+#ifndef LOGPIPELINESTATS_H
+#define LOGPIPELINESTATS_H
+
+#include <QString>
+#include <array>
+#include <atomic>
+
+/// Fixed-bucket latency histogram that can be recorded from any thread
+/// without locking. Bucket i counts samples below 2^i microseconds; the last
+/// bucket also takes everything larger.
+class LogLatencyHistogram {
+public:
+  static constexpr int BUCKET_COUNT = 24; // Last bound is ~8.4 s
+
+  struct Snapshot {
+    quint64 count = 0;
+    quint64 totalMicros = 0;
+    quint64 maxMicros = 0;
+    std::array<quint64, BUCKET_COUNT> buckets{};
+
+    double meanMicros() const;
+    /// Upper bound of the bucket holding the given percentile (0-100)
+    quint64 percentileMicros(double percentile) const;
+  };
+
+  void record(qint64 micros);
+  Snapshot snapshot() const;
+
+private:
+  std::array<std::atomic<quint64>, BUCKET_COUNT> m_buckets{};
+  std::atomic<quint64> m_count{0};
+  std::atomic<quint64> m_totalMicros{0};
+  std::atomic<quint64> m_maxMicros{0};
+};
+
+/// Point-in-time copy of LogPipelineStats
+struct LogPipelineStatsSnapshot {
+  qint64 timestamp = 0; // ms since epoch
+
+  quint64 bytesRead = 0;
+  quint64 linesScanned = 0;     // Complete lines split by the prefilter
+  quint64 linesPrefiltered = 0; // Lines that passed the prefilter
+  quint64 linesParsed = 0;      // Lines classified as an event
+  quint64 eventsEmitted = 0;
+  quint64 eventsDroppedStale = 0; // Alerts older than the maximum age
+  quint64 polls = 0;
+
+  LogLatencyHistogram::Snapshot parseTime;
+  LogLatencyHistogram::Snapshot fileReadLatency;
+  LogLatencyHistogram::Snapshot pollDuration;
+  LogLatencyHistogram::Snapshot eventDelay;
+  LogLatencyHistogram::Snapshot deliveryDelay;
+  LogLatencyHistogram::Snapshot profileSwitch;
+
+  static QString csvHeader();
+  QString toCsvRow() const;
+};
+
+/// Always-on counters for the log reading pipeline. Shared by all workers of
+/// a ChatLogReader; every update is a relaxed atomic operation.
+class LogPipelineStats {
+public:
+  std::atomic<quint64> bytesRead{0};
+  std::atomic<quint64> linesScanned{0};
+  std::atomic<quint64> linesPrefiltered{0};
+  std::atomic<quint64> linesParsed{0};
+  std::atomic<quint64> eventsEmitted{0};
+  std::atomic<quint64> eventsDroppedStale{0};
+  std::atomic<quint64> polls{0};
+
+  LogLatencyHistogram parseTime;       // Classification and regexes per line
+  LogLatencyHistogram fileReadLatency; // Read, prefilter and parse per file
+  LogLatencyHistogram pollDuration;    // One pass over all monitored files
+  LogLatencyHistogram eventDelay;      // Log line timestamp to emit
+  LogLatencyHistogram deliveryDelay;   // Log line timestamp to GUI thread
+  LogLatencyHistogram profileSwitch;   // Profile hotkey to applied profile
+
+  static void add(std::atomic<quint64> &counter, quint64 value) {
+    counter.fetch_add(value, std::memory_order_relaxed);
+  }
+
+  LogPipelineStatsSnapshot snapshot() const;
+};
+
+#endif
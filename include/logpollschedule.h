@@ -0,0 +1,32 @@
+#ifndef LOGPOLLSCHEDULE_H
+#define LOGPOLLSCHEDULE_H
+
+#include <QtGlobal>
+
+/// Poll intervals of the log files on ChatLogWorker's timing wheel. Files
+/// that keep growing are checked on every tick and idle ones back off by
+/// doubling their interval every few empty checks. Logs of a character with
+/// a running client, and logs written to recently, never back off beyond
+/// one second; only dormant logs decay to multi-second intervals.
+class LogPollSchedule {
+public:
+  static constexpr int TICK_MS = 500;
+  static constexpr int IDLE_POLLS_PER_LEVEL = 4; // Before an interval doubles
+  static constexpr int LIVE_MAX_LEVEL = 1;       // 500ms << 1 = 1s
+  static constexpr int DORMANT_MAX_LEVEL = 4;    // 500ms << 4 = 8s
+  static constexpr qint64 RECENT_WRITE_MS = 5 * 60 * 1000;
+
+  /// Safety poll once change notifications are known to work for a file
+  static constexpr int NOTIFIED_FALLBACK_MS = 5000;
+
+  /// Whether a log may still get lines at any moment: its character has a
+  /// client open, or it was written to within RECENT_WRITE_MS
+  static bool isLive(bool clientRunning, qint64 lastWriteMs, qint64 nowMs);
+
+  /// Milliseconds until the next check of a file after idlePolls
+  /// consecutive checks without new data. notified is set once change
+  /// notifications were seen to deliver new lines for the file.
+  static int intervalMs(int idlePolls, bool live, bool notified);
+};
+
+#endif
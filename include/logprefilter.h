@@ -0,0 +1,51 @@
+#ifndef LOGPREFILTER_H
+#define LOGPREFILTER_H
+
+#include <QByteArrayView>
+#include <QVector>
+
+/// Byte-level line splitter and marker prefilter for EVE log data.
+/// Works directly on raw UTF-16LE (chatlogs) or UTF-8 (gamelogs) bytes so
+/// that only lines that can hold an event get decoded into a QString.
+class LogPrefilter {
+public:
+  struct LineRange {
+    qsizetype start;  // Byte offset of the first code unit of the line
+    qsizetype length; // Byte length, excluding the '\n' terminator
+  };
+
+  struct ScanResult {
+    qsizetype consumed; // Bytes up to and including the last '\n'
+    int linesScanned;   // Complete lines seen, including filtered ones
+  };
+
+  /// Splits the complete lines in data and appends the ranges of those that
+  /// contain one of the markers relevant for the log type:
+  /// - Chat logs: "EVE System" (for "Channel changed to Local:")
+  /// - Game logs: "Jumping", "Undocking", "(notify)", "(question)",
+  ///   "(mining)" and "(None)"
+  /// Markers are matched ASCII case-insensitively. Bytes after the last line
+  /// terminator belong to an incomplete line and are not consumed.
+  /// The first searchFrom bytes are known to hold no line terminator (the
+  /// incomplete line from a previous scan) and are not searched again.
+  /// includeCombat also passes "(combat)" lines of game logs.
+  static ScanResult scan(QByteArrayView data, bool isChatLog,
+                         QVector<LineRange> &candidates,
+                         qsizetype searchFrom = 0, bool includeCombat = false);
+
+  /// Like scan(), but appends every complete line; used for logs whose
+  /// lines are all relevant, such as intel channels.
+  static ScanResult splitLines(QByteArrayView data, bool isChatLog,
+                               QVector<LineRange> &lines,
+                               qsizetype searchFrom = 0);
+
+  /// Bytes of the unconsumed tail that were searched for a terminator, to be
+  /// passed as searchFrom once more data has been appended to the tail.
+  static qsizetype searchedTail(qsizetype tailSize, bool isChatLog);
+
+  /// Returns the offset just past the first line terminator in data, or -1
+  /// if data holds no complete line.
+  static qsizetype nextLineStart(QByteArrayView data, bool isChatLog);
+};
+
+#endif
@@ -1,6 +1,9 @@
 #ifndef MAINWINDOW_H
 #define MAINWINDOW_H
 
+#include "chatlogreader.h"
+#include "logeventcorrelator.h"
+#include "starmap.h"
 #include <QHash>
 #include <QLocalServer>
 #include <QMenu>
@@ -21,6 +24,8 @@ class ConfigDialog;
 class ChatLogReader;
 class ProtocolHandler;
 struct CycleGroup;
+struct ProfileDiff;
+class SettingsMap;
 
 /// Pre-computed shared state for bulk thumbnail visibility updates
 struct VisibilityContext {
@@ -63,10 +68,14 @@ private slots:
   void exitApplication();
   void activateProfile();
   void onCharacterSystemChanged(const QString &characterName,
-                                const QString &systemName);
+                                const QString &systemName, qint64 timestamp);
   void onCombatEventDetected(const QString &characterName,
                              const QString &eventType,
-                             const QString &eventText);
+                             const QString &eventText, qint64 timestamp);
+  void onLogEventsBatched(const LogEventBatch &events);
+  void onIntelReported(const QString &channel, const QString &systemName,
+                       const QString &text);
+  void onCombatStatsUpdated(const CombatDamageStatsList &stats);
   void onHotkeysSuspendedChanged(bool suspended);
   void toggleSuspendHotkeys();
   void closeAllEVEClients();
@@ -97,6 +106,10 @@ private:
   QHash<QString, HWND> m_characterToWindow;
   QHash<HWND, QString> m_windowToCharacter;
   QHash<QString, QString> m_characterSystems;
+  QHash<QString, qint64> m_characterSystemTimes; // Log time of each system
+  std::unique_ptr<StarMap> m_starMap; // Loaded on first intel report
+  LogEventCorrelator m_eventCorrelator;
+  QHash<quint64, QTimer *> m_fleetEventTimers; // Correlation group -> expiry
   QHash<QString, int> m_cycleIndexByGroup;
   QHash<QString, HWND> m_lastActivatedWindowByGroup;
   QHash<HWND, qint64> m_windowCreationTimes;
@@ -164,6 +177,13 @@ private:
   void handleNonEVECycleForward();
   void handleNonEVECycleBackward();
   void handleProfileSwitch(const QString &profileName);
+  /// Applies what differs from the previous profile; to is the profile
+  /// switched to, as stored
+  void applyProfileDiff(const ProfileDiff &diff, const SettingsMap &to);
+  /// Applies thumbnail settings to every thumbnail, or with a diff only
+  /// where they differ from what the thumbnail shows
+  void applyThumbnailSettings(const ProfileDiff *diff);
+  void applyLogMonitoringSettings();
   void handleProtocolProfileSwitch(const QString &profileName);
   void handleProtocolCharacterActivation(const QString &characterName);
   void handleProtocolHotkeySuspend();
@@ -195,6 +215,7 @@ private:
   bool isWindowRectValid(const QRect &rect);
   void invalidateCycleIndicesForWindow(HWND hwnd);
   void ensureThumbnailsOnTop();
+  QTimer *fleetEventTimer(quint64 groupId, const QString &eventType);
 };
 
 #endif
@@ -0,0 +1,55 @@
+#ifndef PROFILEPRELOADER_H
+#define PROFILEPRELOADER_H
+
+#include "settingsmap.h"
+#include <QDateTime>
+#include <QHash>
+#include <QMutex>
+#include <QString>
+#include <QStringList>
+#include <QThreadPool>
+
+/// Keeps every profile file parsed in memory so switching profiles does not
+/// have to read and parse an INI file on the GUI thread. Files are parsed on
+/// a background thread; a copy is only used while the file's size and
+/// modification time still match the ones it was read with, so a file
+/// written since (by the settings writer or by hand) is read again.
+class ProfilePreloader {
+public:
+  ProfilePreloader();
+  ~ProfilePreloader();
+
+  ProfilePreloader(const ProfilePreloader &) = delete;
+  ProfilePreloader &operator=(const ProfilePreloader &) = delete;
+
+  /// Parses the given files on the background thread, skipping those whose
+  /// copy is still current, and forgets every other file
+  void preload(const QStringList &fileNames);
+
+  /// Parsed copy of the file, read on the calling thread when there is no
+  /// current copy
+  SettingsMap values(const QString &fileName);
+
+  /// Keeps values as the copy of the file, e.g. the changes to a profile
+  /// that are still being written. The copy is replaced once the file
+  /// changes, like one that was read.
+  void store(const QString &fileName, const SettingsMap &values);
+
+private:
+  struct Entry {
+    SettingsMap values;
+    qint64 size = -1;
+    QDateTime modified;
+  };
+
+  static Entry read(const QString &fileName);
+  static bool isCurrent(const Entry &entry, const QString &fileName);
+  void insert(const QString &fileName, Entry entry);
+
+  QMutex m_mutex; // Guards m_entries
+  QHash<QString, Entry> m_entries;
+
+  QThreadPool m_readPool;
+};
+
+#endif
@@ -0,0 +1,53 @@
+#ifndef SETTINGSMAP_H
+#define SETTINGSMAP_H
+
+#include <QHash>
+#include <QString>
+#include <QStringList>
+#include <QVariant>
+
+class QSettings;
+
+/// Read-only copy of an INI profile held in memory. Values are the ones
+/// QSettings returns, so a profile can be read once (on any thread) and then
+/// loaded or compared without touching the file again.
+///
+/// Keys are matched like QSettings does on the platform: without regard to
+/// case on Windows. Child keys keep the spelling found in the file.
+class SettingsMap {
+public:
+  SettingsMap() = default;
+
+  static SettingsMap read(QSettings &settings);
+  static SettingsMap read(const QString &fileName);
+
+  bool isEmpty() const { return m_entries.isEmpty(); }
+  bool contains(const QString &key) const;
+  QVariant value(const QString &key,
+                 const QVariant &defaultValue = QVariant()) const;
+  /// Keys directly below group, like QSettings::childKeys() inside it
+  QStringList childKeys(const QString &group) const;
+
+  void setValue(const QString &key, const QVariant &value);
+  /// Removes key and every key below it
+  void remove(const QString &key);
+
+  /// Keys set in only one of the maps or set to different values. Values
+  /// of different types are equal if they are written the same way, so a
+  /// map changed in memory compares like the file it is written to.
+  static QStringList changedKeys(const SettingsMap &from,
+                                 const SettingsMap &to);
+
+private:
+  struct Entry {
+    QString key; // As spelled in the file
+    QVariant value;
+  };
+
+  static QString lookupKey(const QString &key);
+  static bool sameValue(const QVariant &a, const QVariant &b);
+
+  QHash<QString, Entry> m_entries; // By lookupKey()
+};
+
+#endif
@@ -0,0 +1,77 @@
+#ifndef SETTINGSWRITER_H
+#define SETTINGSWRITER_H
+
+#include <QElapsedTimer>
+#include <QHash>
+#include <QSet>
+#include <QString>
+#include <QThreadPool>
+#include <QTimer>
+#include <QVariant>
+#include <functional>
+
+/// Write-behind queue for one INI file. Changes are coalesced per key in
+/// memory and written on a background thread once no change has been made
+/// for DEBOUNCE_MS, so a burst of setter calls (dragging a group of
+/// thumbnails) costs one hash insert per call on the GUI thread instead of
+/// a QSettings write and a rewrite of the whole file.
+///
+/// The file is written through QSettings, which replaces it atomically.
+/// QSettings objects for the same file share their data, so reads through
+/// another QSettings see a change as soon as it has been flushed.
+class SettingsWriter {
+public:
+  static constexpr int DEBOUNCE_MS = 1000;
+  static constexpr int MAX_DELAY_MS = 5000; // Flush even if writes go on
+
+  explicit SettingsWriter(const QString &fileName);
+  ~SettingsWriter();
+
+  SettingsWriter(const SettingsWriter &) = delete;
+  SettingsWriter &operator=(const SettingsWriter &) = delete;
+
+  QString fileName() const { return m_fileName; }
+  /// Hands pending changes for the current file to the background thread
+  /// and writes later ones to fileName
+  void setFileName(const QString &fileName);
+
+  void setValue(const QString &key, const QVariant &value);
+  /// Removes key and, like QSettings::remove(), every key below it
+  void remove(const QString &key);
+
+  bool hasPendingChanges() const { return !m_pending.isEmpty(); }
+
+  /// Hands pending changes to the background thread without waiting
+  void flush();
+  /// Writes pending changes on the calling thread after any flush still in
+  /// progress, so the file is complete when this returns
+  void flushAndWait();
+
+  /// Runs task on the background thread once every change handed to it so
+  /// far has been written
+  void afterWrites(std::function<void()> task);
+
+private:
+  struct Changes {
+    QSet<QString> removals; // Applied before values
+    QHash<QString, QVariant> values;
+
+    bool isEmpty() const { return removals.isEmpty() && values.isEmpty(); }
+  };
+
+  static void write(const QString &fileName, const Changes &changes);
+
+  void markDirty();
+  void onDebounceTimeout();
+
+  QString m_fileName;
+  Changes m_pending;
+
+  QTimer m_debounceTimer;
+  QElapsedTimer m_sinceLastChange;
+  QElapsedTimer m_sinceFirstChange;
+
+  QThreadPool m_writePool; // One thread, so flushes reach the file in order
+};
+
+#endif
@@ -0,0 +1,61 @@
+#ifndef SOLARSYSTEMMATCHER_H
+#define SOLARSYSTEMMATCHER_H
+
+#include <QString>
+#include <QStringList>
+#include <QStringView>
+#include <QVector>
+#include <array>
+
+/// Finds every known solar system name in a chat line in a single pass.
+///
+/// The dictionary is compiled into an Aho-Corasick automaton whose trie is
+/// stored in compressed sparse rows: the edges of a state are a sorted slice
+/// of flat symbol and target arrays, so ~8000 names fit in a few hundred
+/// kilobytes. Names are matched ASCII case-insensitively and only as whole
+/// words, so "Hek" is not reported inside "Hekaton".
+class SolarSystemMatcher {
+public:
+  struct Match {
+    int start;       // Offset in the searched text
+    int length;      // In characters
+    int systemIndex; // Index into systemNames()
+  };
+
+  SolarSystemMatcher() = default;
+
+  /// Replaces the dictionary; duplicate and blank names are skipped.
+  void build(const QStringList &names);
+
+  /// Reads one name per line, skipping blank lines and '#' comments.
+  static QStringList readNames(const QString &filePath);
+
+  /// Appends all whole-word matches in text, in order of their end offset.
+  void findAll(QStringView text, QVector<Match> &matches) const;
+
+  const QStringList &systemNames() const { return m_names; }
+  bool isEmpty() const { return m_names.isEmpty(); }
+
+private:
+  static ushort fold(ushort c) {
+    return (c >= 'A' && c <= 'Z') ? ushort(c | 0x20) : c;
+  }
+  static bool isWordChar(QChar c);
+
+  int findEdge(int state, ushort symbol) const;
+  int step(int state, ushort symbol) const;
+
+  QStringList m_names;
+
+  // Edges of state s are [m_edgeStart[s], m_edgeStart[s + 1]), by symbol
+  QVector<int> m_edgeStart;
+  QVector<ushort> m_edgeSymbols;
+  QVector<int> m_edgeTargets;
+
+  QVector<int> m_fail;
+  QVector<int> m_output;     // Name ending in this state, -1 if none
+  QVector<int> m_outputLink; // Nearest failure state with an output, or 0
+  std::array<int, 128> m_rootNext{}; // ASCII transitions out of the root
+};
+
+#endif
@@ -0,0 +1,66 @@
+#ifndef STARMAP_H
+#define STARMAP_H
+
+#include <QHash>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+/// Stargate graph of New Eden for jump distance queries.
+///
+/// Systems are numbered in load order and the adjacency is kept in
+/// compressed sparse rows (one offset per system into a flat neighbour
+/// array), so a search touches two small contiguous arrays. Point-to-point
+/// queries use a bidirectional breadth-first search and are cached; one
+/// target against many systems uses a single search from the target.
+///
+/// Queries reuse internal scratch buffers and are not thread-safe.
+class StarMap {
+public:
+  StarMap() = default;
+
+  /// Reads stargate connections as "System A,System B" lines; blank lines
+  /// and '#' comments are skipped. Returns false if nothing was loaded.
+  bool load(const QString &filePath);
+
+  int systemCount() const { return m_names.size(); }
+
+  /// Index of a system by case-insensitive name, or -1 if unknown.
+  int systemIndex(const QString &name) const;
+
+  /// Jumps between two systems, or -1 if either is unknown or they are not
+  /// connected by stargates.
+  int jumpDistance(const QString &from, const QString &to) const;
+
+  /// Jumps from each of systems to target, or -1 for systems that are
+  /// unknown or further than maxJumps away.
+  QVector<int> jumpDistancesTo(const QString &target,
+                               const QStringList &systems,
+                               int maxJumps) const;
+
+private:
+  int bidirectionalSearch(int from, int to) const;
+  void nextStamp() const;
+
+  QStringList m_names;
+  QHash<QString, int> m_indexByName; // Lowercased name -> index
+
+  // Neighbours of system i are m_neighbours[m_offsets[i], m_offsets[i + 1])
+  QVector<int> m_offsets;
+  QVector<int> m_neighbours;
+
+  // Search state, stamped per search instead of cleared
+  mutable quint32 m_stamp = 0;
+  mutable QVector<quint32> m_forwardStamp;
+  mutable QVector<quint32> m_backwardStamp;
+  mutable QVector<int> m_forwardDepth;
+  mutable QVector<int> m_backwardDepth;
+  mutable QVector<int> m_frontier;
+  mutable QVector<int> m_otherFrontier;
+  mutable QVector<int> m_nextFrontier;
+
+  mutable QHash<quint64, int> m_distanceCache; // Unordered index pair
+  static constexpr int DISTANCE_CACHE_LIMIT = 4096;
+};
+
+#endif
@@ -7,6 +7,7 @@
 #include <QLabel>
 #include <QList>
 #include <QPixmap>
+#include <QPointer>
 #include <QTimer>
 #include <QVector>
 #include <QWidget>
@@ -19,10 +20,12 @@ class OverlayWidget;
 struct CombatEvent {
   QString message;
   QString eventType;
-  QTimer *timer;
+  QPointer<QTimer> timer; // A shared timer is deleted by its owner
+  bool ownsTimer;         // False for a timer shared with other thumbnails
 
-  CombatEvent(const QString &msg, const QString &type, QTimer *t)
-      : message(msg), eventType(type), timer(t) {}
+  CombatEvent(const QString &msg, const QString &type, QTimer *t,
+              bool owns = true)
+      : message(msg), eventType(type), timer(t), ownsTimer(owns) {}
 };
 
 class ThumbnailWidget : public QWidget {
@@ -51,13 +54,19 @@ public:
 
   void refreshSystemColor();
 
+  /// Shows message for the event type's duration. With a sharedTimer the
+  /// message instead ends when that (already started) timer fires, so that
+  /// one event shown on several thumbnails expires everywhere at once.
   void setCombatMessage(const QString &message,
-                        const QString &eventType = QString());
+                        const QString &eventType = QString(),
+                        QTimer *sharedTimer = nullptr);
   QString getCombatMessage() const;
   bool hasCombatEvent() const { return !m_combatEvents.isEmpty(); }
   QString getCombatEventType() const;
   QStringList getActiveCombatEventTypes() const;
 
+  void setDamageText(const QString &text);
+
   void forceUpdate();
   void updateWindowFlags(bool alwaysOnTop);
   void forceOverlayRender();
@@ -101,6 +110,7 @@ private:
   QString m_customName;
   QString m_systemName;
   QList<CombatEvent> m_combatEvents;
+  QString m_damageText; // Rolling DPS, empty while out of combat
   QColor m_cachedSystemColor;
   QPoint m_dragPosition;
   bool m_isDragging = false;
@@ -136,6 +146,8 @@ public:
   void setOverlays(const QVector<OverlayElement> &overlays);
   void setActiveState(bool active);
   void setCharacterName(const QString &characterName);
+  /// Config::characterId() of the character, or -1 for none
+  void setCharacterId(int characterId);
   void setSystemName(const QString &systemName);
   void setCombatEventTypes(const QStringList &eventTypes);
   void updateWindowFlags(bool alwaysOnTop);
@@ -149,7 +161,8 @@ protected:
 private:
   QVector<OverlayElement> m_overlays;
   bool m_isActive = false;
-  QString m_characterName;
+  QString m_characterName; // Display name; custom name if one is set
+  int m_characterId = -1;
   QString m_systemName;
   QStringList m_combatEventTypes;
 
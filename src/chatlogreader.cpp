@@ -1,39 +1,40 @@
 #include "chatlogreader.h"
 #include "config.h"
+#include "evetimestamp.h"
 #include <QDateTime>
 #include <QDebug>
 #include <QDir>
 #include <QElapsedTimer>
 #include <QFile>
 #include <QRegularExpression>
+#include <QScopeGuard>
 #include <QSet>
 #include <QStandardPaths>
-#include <QStringDecoder>
 #include <QTextStream>
 #include <QTimer>
 
-ChatLogWorker::ChatLogWorker(QObject *parent)
-    : QObject(parent), m_pollTimer(new QTimer(this)),
-      m_scanTimer(new QTimer(this)),
-      m_directoryWatcher(new QFileSystemWatcher(this)),
-      m_currentPollInterval(SLOW_POLL_MS), m_activeFilesLastPoll(0),
-      m_running(false), m_enableChatLogMonitoring(true),
-      m_enableGameLogMonitoring(true) {
-
-  // Poll timer for checking file changes
+ChatLogWorker::ChatLogWorker(LogPipelineStats &stats, QObject *parent)
+    : QObject(parent), m_stats(stats), m_pollTimer(new QTimer(this)),
+      m_fileWatcher(new QFileSystemWatcher(this)),
+      m_pollWheel(POLL_WHEEL_SLOTS), m_pollTick(0), m_running(false),
+      m_enableChatLogMonitoring(true), m_enableGameLogMonitoring(true),
+      m_eventDrivenMonitoring(false), m_batchedDelivery(true),
+      m_combatDamageTracking(false),
+      m_combatStatsTimer(new QTimer(this)), m_maxEventAgeMs(0),
+      m_miningTimeoutMs(Config::DEFAULT_MINING_TIMEOUT_SECONDS * 1000) {
+
+  // Poll timer drives the timing wheel; it runs at the fastest per-file rate
   connect(m_pollTimer, &QTimer::timeout, this, &ChatLogWorker::pollLogFiles);
-  m_pollTimer->setInterval(m_currentPollInterval);
-
-  // Scan timer for finding new log files (as backup)
-  connect(m_scanTimer, &QTimer::timeout, this,
-          &ChatLogWorker::checkForNewFiles);
-  m_scanTimer->setInterval(SCAN_INTERVAL_MS);
+  m_pollTimer->setInterval(POLL_TICK_MS);
 
-  // Directory watcher for immediate new file detection
-  connect(m_directoryWatcher, &QFileSystemWatcher::directoryChanged, this,
-          &ChatLogWorker::onDirectoryChanged);
+  // Rolling damage rates; only runs while some character has recent damage
+  connect(m_combatStatsTimer, &QTimer::timeout, this,
+          &ChatLogWorker::publishCombatStats);
+  m_combatStatsTimer->setInterval(COMBAT_STATS_INTERVAL_MS);
 
-  updateCustomNameCache();
+  // File watcher for event-driven tailing (polling remains as fallback)
+  connect(m_fileWatcher, &QFileSystemWatcher::fileChanged, this,
+          &ChatLogWorker::onLogFileChanged);
 }
 
 /// Normalize a log line by removing invisible/problematic characters.
@@ -74,45 +75,28 @@ static QString normalizeLogLine(const QString &line) {
   return s;
 }
 
-static qint64 parseEVETimestamp(const QString &timestamp) {
-  if (timestamp.length() != 19) {
-    return QDateTime::currentMSecsSinceEpoch();
-  }
-
-  bool ok;
-  int year = timestamp.mid(0, 4).toInt(&ok);
-  if (!ok || year < 2000 || year > 2100) {
-    return QDateTime::currentMSecsSinceEpoch();
-  }
-
-  int month = timestamp.mid(5, 2).toInt(&ok);
-  if (!ok || month < 1 || month > 12) {
-    return QDateTime::currentMSecsSinceEpoch();
-  }
-
-  int day = timestamp.mid(8, 2).toInt(&ok);
-  if (!ok || day < 1 || day > 31) {
-    return QDateTime::currentMSecsSinceEpoch();
-  }
-
-  int hour = timestamp.mid(11, 2).toInt(&ok);
-  if (!ok || hour < 0 || hour > 23) {
-    return QDateTime::currentMSecsSinceEpoch();
-  }
+/// Timestamp in ms since epoch, or the current time if it cannot be parsed
+static qint64 parseEVETimestamp(QStringView timestamp) {
+  const qint64 parsed = EveTimestamp::parse(timestamp);
+  return parsed >= 0 ? parsed : QDateTime::currentMSecsSinceEpoch();
+}
 
-  int minute = timestamp.mid(14, 2).toInt(&ok);
-  if (!ok || minute < 0 || minute > 59) {
-    return QDateTime::currentMSecsSinceEpoch();
-  }
+/// Timestamp of a "[ YYYY.MM.DD HH:MM:SS ] ..." log line in ms since epoch,
+/// or the current time for lines without one
+static qint64 lineTimestamp(QStringView line) {
+  const qint64 parsed = EveTimestamp::parseLine(line);
+  return parsed >= 0 ? parsed : QDateTime::currentMSecsSinceEpoch();
+}
 
-  int second = timestamp.mid(17, 2).toInt(&ok);
-  if (!ok || second < 0 || second > 59) {
-    return QDateTime::currentMSecsSinceEpoch();
+/// Chatlogs use UTF-16 LE, gamelogs use UTF-8. Each line is decoded on its
+/// own, so a stray byte of a damaged line cannot shift the next one.
+static QString decodeLogLine(QByteArrayView lineData, bool isChatLog) {
+  if (isChatLog) {
+    return QString::fromUtf16(
+        reinterpret_cast<const char16_t *>(lineData.data()),
+        lineData.size() / 2);
   }
-
-  QDateTime dt(QDate(year, month, day), QTime(hour, minute, second));
-  return dt.isValid() ? dt.toMSecsSinceEpoch()
-                      : QDateTime::currentMSecsSinceEpoch();
+  return QString::fromUtf8(lineData);
 }
 
 ChatLogWorker::~ChatLogWorker() {
@@ -153,26 +137,77 @@ void ChatLogWorker::setCharacterNames(const QStringList &characters) {
   }
 
   m_characterNames = characters;
+
+  // Logs of closed clients stay attached until the next scan; until then
+  // they may back off like any dormant log
+  for (LogFileState *state : std::as_const(m_logFiles)) {
+    if (state->intelChannel.isEmpty()) {
+      state->clientRunning =
+          characters.contains(state->characterName, Qt::CaseInsensitive);
+    }
+  }
 }
 
-void ChatLogWorker::setLogDirectory(const QString &directory) {
+void ChatLogWorker::setEnableChatLogMonitoring(bool enabled) {
   QMutexLocker locker(&m_mutex);
-  m_logDirectory = directory;
+  m_enableChatLogMonitoring = enabled;
 }
 
-void ChatLogWorker::setGameLogDirectory(const QString &directory) {
+void ChatLogWorker::setEnableGameLogMonitoring(bool enabled) {
   QMutexLocker locker(&m_mutex);
-  m_gameLogDirectory = directory;
+  m_enableGameLogMonitoring = enabled;
 }
 
-void ChatLogWorker::setEnableChatLogMonitoring(bool enabled) {
+void ChatLogWorker::setEventDrivenMonitoring(bool enabled) {
   QMutexLocker locker(&m_mutex);
-  m_enableChatLogMonitoring = enabled;
+  m_eventDrivenMonitoring = enabled;
 }
 
-void ChatLogWorker::setEnableGameLogMonitoring(bool enabled) {
+void ChatLogWorker::setBatchedDelivery(bool enabled) {
   QMutexLocker locker(&m_mutex);
-  m_enableGameLogMonitoring = enabled;
+  m_batchedDelivery = enabled;
+}
+
+void ChatLogWorker::setCombatDamageTracking(bool enabled) {
+  QMutexLocker locker(&m_mutex);
+  m_combatDamageTracking = enabled;
+  if (!enabled) {
+    m_damageTracker.clear();
+  }
+}
+
+void ChatLogWorker::setLogAlertRules(const QVector<LogAlertRule> &rules) {
+  QMutexLocker locker(&m_mutex);
+  m_alertMatcher.compile(rules);
+}
+
+void ChatLogWorker::setMaxEventAge(int seconds) {
+  QMutexLocker locker(&m_mutex);
+  m_maxEventAgeMs = qint64(qMax(0, seconds)) * 1000;
+}
+
+void ChatLogWorker::setDataDirectory(const QString &directory) {
+  QMutexLocker locker(&m_mutex);
+  m_dataDirectory = directory;
+}
+
+void ChatLogWorker::setMiningTimeout(int seconds) {
+  QMutexLocker locker(&m_mutex);
+  m_miningTimeoutMs = qMax(1, seconds) * 1000;
+}
+
+void ChatLogWorker::setCustomNames(const QHash<QString, QString> &customNames) {
+  QMutexLocker locker(&m_mutex);
+  m_cachedCustomNames = customNames;
+}
+
+void ChatLogWorker::assignLogFiles(const LogFileAssignment &files) {
+  QMutexLocker locker(&m_mutex);
+  m_assignedFiles = files;
+
+  if (m_running) {
+    attachLogFiles();
+  }
 }
 
 void ChatLogWorker::refreshMonitoring() {
@@ -185,11 +220,16 @@ void ChatLogWorker::refreshMonitoring() {
   qDebug()
       << "ChatLogWorker: Refreshing monitoring with updated settings (ChatLog:"
       << m_enableChatLogMonitoring << ", GameLog:" << m_enableGameLogMonitoring
-      << ")";
+      << ", EventDriven:" << m_eventDrivenMonitoring << ")";
 
-  // No need to watch directories with polling architecture
-  // Just rescan the log files
-  scanExistingLogs();
+  // Enabled log types may have changed; the reader's discovery rescans the
+  // directories and hands in new files on its own
+  attachLogFiles();
+
+  // Apply a changed event-driven setting to every file's schedule
+  for (LogFileState *state : std::as_const(m_logFiles)) {
+    schedulePoll(state);
+  }
 
   qDebug() << "ChatLogWorker: Monitoring refresh completed";
 }
@@ -207,35 +247,15 @@ void ChatLogWorker::startMonitoring() {
            << m_enableChatLogMonitoring
            << ", GameLog:" << m_enableGameLogMonitoring << ")";
 
-  // Set up directory watching for instant new file detection
-  QStringList watchedDirs = m_directoryWatcher->directories();
-  if (!watchedDirs.isEmpty()) {
-    m_directoryWatcher->removePaths(watchedDirs);
-  }
-
-  if (m_enableChatLogMonitoring && QDir(m_logDirectory).exists()) {
-    m_directoryWatcher->addPath(m_logDirectory);
-    qDebug() << "ChatLogWorker: Watching chatlog directory:" << m_logDirectory;
-  }
-
-  if (m_enableGameLogMonitoring && QDir(m_gameLogDirectory).exists()) {
-    m_directoryWatcher->addPath(m_gameLogDirectory);
-    qDebug() << "ChatLogWorker: Watching gamelog directory:"
-             << m_gameLogDirectory;
-  }
-
-  // Scan for existing logs and set up initial state
-  scanExistingLogs();
+  // Files assigned before monitoring started
+  attachLogFiles();
 
-  // Start polling timer
+  // Start polling timer (only a safety net when file notifications are used)
   m_pollTimer->start();
 
-  // Start scan timer for finding new files
-  m_scanTimer->start();
-
   qDebug() << "ChatLogWorker: Monitoring started for" << m_characterNames.size()
            << "characters with" << m_logFiles.size() << "log files"
-           << "- poll interval:" << m_currentPollInterval << "ms";
+           << "- poll tick:" << POLL_TICK_MS << "ms";
 }
 
 void ChatLogWorker::stopMonitoring() {
@@ -249,90 +269,38 @@ void ChatLogWorker::stopMonitoring() {
 
   // Stop timers
   m_pollTimer->stop();
-  m_scanTimer->stop();
+  m_combatStatsTimer->stop();
+  m_damageTracker.clear();
 
-  // Stop directory watching
-  QStringList watchedDirs = m_directoryWatcher->directories();
-  if (!watchedDirs.isEmpty()) {
-    m_directoryWatcher->removePaths(watchedDirs);
-    qDebug() << "ChatLogWorker: Stopped watching" << watchedDirs.size()
-             << "directories";
+  QStringList watchedFiles = m_fileWatcher->files();
+  if (!watchedFiles.isEmpty()) {
+    m_fileWatcher->removePaths(watchedFiles);
   }
 
   // Clean up log file states
   qDeleteAll(m_logFiles);
   m_logFiles.clear();
 
-  m_cachedChatListenerMap.clear();
-  m_cachedGameListenerMap.clear();
+  for (QVector<QString> &slot : m_pollWheel) {
+    slot.clear();
+  }
+
+  // Discovery hands in the files again when monitoring restarts
+  m_assignedFiles = LogFileAssignment();
 
   qDebug() << "ChatLogWorker: Polling-based monitoring stopped";
 }
 
-void ChatLogWorker::scanExistingLogs() {
+void ChatLogWorker::attachLogFiles() {
   QElapsedTimer totalTimer;
   totalTimer.start();
 
-  QHash<QString, QString> chatListenerMap = m_cachedChatListenerMap;
-  QHash<QString, QString> gameListenerMap = m_cachedGameListenerMap;
-
-  // Build chat listener map (scan directory for Local_*.txt files)
-  if (m_enableChatLogMonitoring) {
-    QDir d(m_logDirectory);
-    if (!d.exists()) {
-      chatListenerMap.clear();
-      m_cachedChatListenerMap.clear();
-    } else {
-      QFileInfo di(d.absolutePath());
-      QDateTime dirLastMod = di.lastModified();
-      if (m_lastChatDirScanTime.isNull() ||
-          dirLastMod > m_lastChatDirScanTime) {
-        QElapsedTimer chatMapTimer;
-        chatMapTimer.start();
-        QStringList filters;
-        filters << "Local_*.txt";
-        chatListenerMap = buildListenerToFileMap(d, filters, 24);
-        m_cachedChatListenerMap = chatListenerMap;
-        m_lastChatDirScanTime = dirLastMod;
-        qDebug() << "ChatLogWorker: chatListenerMap build took"
-                 << chatMapTimer.elapsed()
-                 << "ms (files:" << chatListenerMap.count() << ")";
-      } else {
-        qDebug() << "ChatLogWorker: chat directory unchanged since last scan "
-                    "(using cached map with"
-                 << chatListenerMap.count() << "entries)";
-      }
-    }
-  }
+  const QHash<QString, QString> &chatListenerMap = m_assignedFiles.chatLogs;
+  const QHash<QString, QString> &gameListenerMap = m_assignedFiles.gameLogs;
 
-  // Build game listener map (scan directory for *.txt game logs)
-  if (m_enableGameLogMonitoring) {
-    QDir gd(m_gameLogDirectory);
-    if (!gd.exists()) {
-      gameListenerMap.clear();
-      m_cachedGameListenerMap.clear();
-    } else {
-      QFileInfo gdi(gd.absolutePath());
-      QDateTime dirLastMod = gdi.lastModified();
-      if (m_lastGameDirScanTime.isNull() ||
-          dirLastMod > m_lastGameDirScanTime) {
-        QElapsedTimer gameMapTimer;
-        gameMapTimer.start();
-        QStringList filters;
-        filters << "*.txt";
-        gameListenerMap = buildListenerToFileMap(gd, filters, 24);
-        m_cachedGameListenerMap = gameListenerMap;
-        m_lastGameDirScanTime = dirLastMod;
-        qDebug() << "ChatLogWorker: gameListenerMap build took"
-                 << gameMapTimer.elapsed()
-                 << "ms (files:" << gameListenerMap.count() << ")";
-      } else {
-        qDebug() << "ChatLogWorker: gamelog directory unchanged since last "
-                    "scan (using cached map with"
-                 << gameListenerMap.count() << "entries)";
-      }
-    }
-  }
+  // Characters missing from the maps may still be resolved by a running
+  // header scan, after which discovery assigns the files again
+  const bool headersPending = !m_assignedFiles.complete;
 
   // Track which files should exist after this scan
   QSet<QString> newFiles;
@@ -341,13 +309,8 @@ void ChatLogWorker::scanExistingLogs() {
   for (const QString &characterName : m_characterNames) {
     // Chat log setup
     if (m_enableChatLogMonitoring) {
-      QString chatLogFile;
-      QString key = characterName.toLower();
-      if (chatListenerMap.contains(key)) {
-        chatLogFile = chatListenerMap.value(key);
-      } else {
-        chatLogFile = findChatLogFileForCharacter(characterName);
-      }
+      const QString chatLogFile =
+          chatListenerMap.value(characterName.toLower());
 
       if (!chatLogFile.isEmpty()) {
         newFiles.insert(chatLogFile);
@@ -360,6 +323,7 @@ void ChatLogWorker::scanExistingLogs() {
           state->isChatLog = true;
           readInitialState(state);
           m_logFiles[chatLogFile] = state;
+          schedulePoll(state);
 
           qDebug() << "ChatLogWorker: Monitoring CHATLOG for" << characterName
                    << ":" << chatLogFile;
@@ -369,13 +333,8 @@ void ChatLogWorker::scanExistingLogs() {
 
     // Game log setup
     if (m_enableGameLogMonitoring) {
-      QString gameLogFile;
-      QString key = characterName.toLower();
-      if (gameListenerMap.contains(key)) {
-        gameLogFile = gameListenerMap.value(key);
-      } else {
-        gameLogFile = findGameLogFileForCharacter(characterName);
-      }
+      const QString gameLogFile =
+          gameListenerMap.value(characterName.toLower());
 
       if (!gameLogFile.isEmpty()) {
         newFiles.insert(gameLogFile);
@@ -388,6 +347,7 @@ void ChatLogWorker::scanExistingLogs() {
           state->isChatLog = false;
           readInitialState(state);
           m_logFiles[gameLogFile] = state;
+          schedulePoll(state);
 
           qDebug() << "ChatLogWorker: Monitoring GAMELOG for" << characterName
                    << ":" << gameLogFile;
@@ -396,11 +356,16 @@ void ChatLogWorker::scanExistingLogs() {
     }
   }
 
+  if (m_enableChatLogMonitoring && !m_assignedFiles.intelLogs.isEmpty()) {
+    attachIntelLogs(newFiles);
+  }
+
   // Remove LogFileState objects for files that no longer exist or are not
-  // monitored
+  // monitored. Unresolved characters keep their files until the header scan
+  // completes.
   QStringList staleFiles;
   for (auto it = m_logFiles.constBegin(); it != m_logFiles.constEnd(); ++it) {
-    if (!newFiles.contains(it.key())) {
+    if (!newFiles.contains(it.key()) && !headersPending) {
       staleFiles.append(it.key());
     }
   }
@@ -410,13 +375,22 @@ void ChatLogWorker::scanExistingLogs() {
     delete m_logFiles.take(staleFile);
   }
 
+  updateFileWatches();
+
   qDebug() << "ChatLogWorker: Now monitoring" << m_logFiles.count()
            << "log files";
-  qDebug() << "ChatLogWorker: scanExistingLogs total took"
+  // Initial states of newly monitored files
+  flushEvents();
+
+  qDebug() << "ChatLogWorker: attachLogFiles total took"
            << totalTimer.elapsed() << "ms";
 }
 
 void ChatLogWorker::readInitialState(LogFileState *state) {
+  m_readingInitialState = true;
+  auto endInitialState =
+      qScopeGuard([this]() { m_readingInitialState = false; });
+
   QFileInfo fi(state->filePath);
 
   if (!fi.exists()) {
@@ -429,41 +403,28 @@ void ChatLogWorker::readInitialState(LogFileState *state) {
   state->lastSize = fi.size();
   state->lastModified = fi.lastModified().toMSecsSinceEpoch();
 
-  const qint64 tailSize = 65536;
-  const qint64 fallbackSize = 5 * 1024 * 1024;
-
-  QFile file(state->filePath);
-  if (!file.open(QIODevice::ReadOnly)) {
+  // The handle stays open for the lifetime of the state and is reused by
+  // readNewLines
+  if (!openLogFile(state)) {
     state->position = 0;
     return;
   }
+  QFile &file = *state->file;
 
   qint64 fileSize = file.size();
-  qint64 startPos = 0;
-
-  // Read tail of file to find initial system
-  if (fileSize > tailSize + 1024) {
-    startPos = fileSize - tailSize - 1024;
-    file.seek(startPos);
-  }
 
-  QByteArray tailData = file.readAll();
+  // Everything up to the current end of file counts as initial state. A
+  // chatlog line that is still being written may end in half a UTF-16 code
+  // unit; reading on from its first byte keeps later lines aligned.
+  state->position = state->isChatLog ? (fileSize & ~qint64(1)) : fileSize;
+  // Lines written from now on are live
+  state->catchingUp = false;
 
-  // Chatlogs use UTF-16 LE, gamelogs use UTF-8
-  QString tailContent;
-  if (state->isChatLog) {
-    auto decoder = QStringDecoder(QStringDecoder::Utf16LE);
-    tailContent = decoder(tailData);
-    // Remove BOM character if present
-    if (tailContent.startsWith(QChar(0xFEFF))) {
-      tailContent.remove(0, 1);
-    }
-  } else {
-    tailContent = QString::fromUtf8(tailData);
+  // Intel reports are only of interest while they are fresh
+  if (!state->intelChannel.isEmpty()) {
+    return;
   }
 
-  QStringList tailLines = tailContent.split('\n', Qt::SkipEmptyParts);
-
   QString lastRelevantLine;
 
   if (state->isChatLog) {
@@ -473,52 +434,14 @@ void ChatLogWorker::readInitialState(LogFileState *state) {
         QRegularExpression::CaseInsensitiveOption |
             QRegularExpression::UseUnicodePropertiesOption);
 
-    for (int i = tailLines.size() - 1; i >= 0; --i) {
-      QString line = tailLines[i].trimmed();
-      if (systemChangePattern.match(line).hasMatch()) {
-        lastRelevantLine = line;
-        break;
-      }
-    }
-
-    // If tail scan found nothing and file is small enough, scan entire file
-    if (lastRelevantLine.isEmpty() && fileSize <= fallbackSize) {
-      qDebug()
-          << "ChatLogWorker: tail scan found nothing, scanning entire file for"
-          << state->filePath << "(size:" << fileSize << "bytes)";
-      file.seek(0);
-      QByteArray allData = file.readAll();
-
-      // Chatlogs use UTF-16 LE, gamelogs use UTF-8
-      QString allContent;
-      if (state->isChatLog) {
-        auto decoder = QStringDecoder(QStringDecoder::Utf16LE);
-        allContent = decoder(allData);
-        // Remove BOM character if present
-        if (allContent.startsWith(QChar(0xFEFF))) {
-          allContent.remove(0, 1);
-        }
-      } else {
-        allContent = QString::fromUtf8(allData);
-      }
-
-      QStringList allLines = allContent.split('\n', Qt::SkipEmptyParts);
-
-      for (const QString &line : allLines) {
-        QString s = extractSystemFromLine(line.trimmed());
-        if (!s.isEmpty()) {
-          lastRelevantLine = line.trimmed();
-        }
-      }
+    lastRelevantLine =
+        findLastMatchingLine(file, fileSize, true, [](const QString &line) {
+          return systemChangePattern.match(line).hasMatch();
+        });
 
-      if (lastRelevantLine.isEmpty()) {
-        qDebug()
-            << "ChatLogWorker: No system change found in entire chatlog for"
-            << state->characterName;
-      }
-    } else if (lastRelevantLine.isEmpty() && fileSize > fallbackSize) {
-      qDebug() << "ChatLogWorker: tail scan found nothing and file too large ("
-               << fileSize << "bytes) for full scan:" << state->filePath;
+    if (lastRelevantLine.isEmpty()) {
+      qDebug() << "ChatLogWorker: No system change found in chatlog for"
+               << state->characterName << "(size:" << fileSize << "bytes)";
     }
 
     if (!lastRelevantLine.isEmpty()) {
@@ -548,14 +471,15 @@ void ChatLogWorker::readInitialState(LogFileState *state) {
           qDebug() << "ChatLogWorker: Initial system for"
                    << state->characterName << ":" << newSystem << "(from"
                    << timestampStr << ")";
-          emit systemChanged(state->characterName, newSystem);
+          queueSystemChanged(state->characterName, newSystem, updateTime);
         } else {
           qDebug() << "ChatLogWorker: Chatlog data for" << state->characterName
                    << "is older than current position, skipping";
         }
       }
 
-      parseLogLine(lastRelevantLine, state->characterName);
+      parseLogLine(lastRelevantLine, state->characterName,
+                   lineTimestamp(lastRelevantLine));
     }
   } else {
     // Game log: look for "Jumping from" and conduit jump lines
@@ -564,14 +488,11 @@ void ChatLogWorker::readInitialState(LogFileState *state) {
     static QRegularExpression conduitPattern(
         R"(\[\s*([\d.\s:]+)\]\s*\(notify\)\s*A Conduit Field activated by .+ jumps you to\s+(.+))");
 
-    for (int i = tailLines.size() - 1; i >= 0; --i) {
-      QString line = tailLines[i].trimmed();
-      if (jumpPattern.match(line).hasMatch() ||
-          conduitPattern.match(line).hasMatch()) {
-        lastRelevantLine = line;
-        break;
-      }
-    }
+    lastRelevantLine =
+        findLastMatchingLine(file, fileSize, false, [](const QString &line) {
+          return jumpPattern.match(line).hasMatch() ||
+                 conduitPattern.match(line).hasMatch();
+        });
 
     if (!lastRelevantLine.isEmpty()) {
       QRegularExpressionMatch jumpMatch = jumpPattern.match(lastRelevantLine);
@@ -611,7 +532,7 @@ void ChatLogWorker::readInitialState(LogFileState *state) {
           qDebug() << "ChatLogWorker: Updated system from GAMELOG for"
                    << state->characterName << ":" << newSystem << "(from"
                    << timestampStr << ") - overriding chatlog data";
-          emit systemChanged(state->characterName, newSystem);
+          queueSystemChanged(state->characterName, newSystem, updateTime);
         } else {
           qDebug() << "ChatLogWorker: GAMELOG jump for" << state->characterName
                    << "is older than current location (current:"
@@ -622,433 +543,466 @@ void ChatLogWorker::readInitialState(LogFileState *state) {
       }
     }
   }
-
-  // Set position to end of file (we've processed initial state)
-  state->position = fileSize;
-  file.close();
 }
 
-void ChatLogWorker::checkForNewFiles() {
-  QMutexLocker locker(&m_mutex);
-
-  if (!m_running) {
-    return;
+QString ChatLogWorker::findLastMatchingLine(
+    QFile &file, qint64 fileSize, bool isChatLog,
+    const std::function<bool(const QString &)> &matches) {
+  // Walk backwards from EOF in fixed chunks so the cost depends on how far
+  // back the last relevant line is, not on the size of the file
+  const qint64 chunkSize = 65536; // Even, keeps UTF-16 chunks aligned
+  const qint64 maxScanBytes = 5 * 1024 * 1024;
+
+  // Ignore a trailing half code unit of a line that is still being written
+  const qint64 dataEnd = isChatLog ? (fileSize & ~qint64(1)) : fileSize;
+  const qint64 scanLimit = qMax<qint64>(0, dataEnd - maxScanBytes);
+
+  // Large scans read straight from the page cache instead of copying every
+  // chunk into a buffer; buffered reads remain the fallback
+  const uchar *mapped = nullptr;
+  if (dataEnd - scanLimit >= MAP_THRESHOLD_BYTES) {
+    mapped = file.map(scanLimit, dataEnd - scanLimit);
+    if (!mapped) {
+      qDebug() << "ChatLogWorker: Mapping" << file.fileName()
+               << "failed, using buffered reads:" << file.errorString();
+    }
   }
-
-  bool newFilesFound = false;
-
-  if (m_enableChatLogMonitoring) {
-    QDir d(m_logDirectory);
-    if (d.exists()) {
-      QStringList chatFiles =
-          d.entryList(QStringList() << "Local_*.txt", QDir::Files);
-      QSet<QString> currentChatFiles;
-      for (const QString &f : chatFiles) {
-        currentChatFiles.insert(d.absoluteFilePath(f));
+  auto unmap = qScopeGuard([&file, mapped]() {
+    if (mapped) {
+      file.unmap(const_cast<uchar *>(mapped));
+    }
+  });
+
+  // The last line may not be terminated yet
+  const QByteArray terminator =
+      isChatLog ? QByteArray("\n\0", 2) : QByteArray("\n");
+
+  qint64 chunkEnd = dataEnd;
+  qint64 pendingEnd = dataEnd; // Bytes up to here are not processed yet
+  QByteArray carry; // Buffered reads: start of a line continuing past chunkEnd
+  QVector<LogPrefilter::LineRange> candidates;
+
+  while (chunkEnd > scanLimit) {
+    const qint64 chunkStart = qMax(scanLimit, chunkEnd - chunkSize);
+    const bool containsEnd = pendingEnd == dataEnd;
+
+    QByteArray buffer;
+    QByteArrayView region;
+
+    if (mapped) {
+      QByteArrayView bytes(
+          reinterpret_cast<const char *>(mapped) + (chunkStart - scanLimit),
+          pendingEnd - chunkStart);
+      if (containsEnd) {
+        buffer = bytes.toByteArray() + terminator;
+        region = buffer;
+      } else {
+        region = bytes;
+      }
+    } else {
+      if (!file.seek(chunkStart)) {
+        break;
       }
 
-      if (m_knownChatLogFiles.isEmpty()) {
-        m_knownChatLogFiles = currentChatFiles;
-        newFilesFound = true;
-      } else if (currentChatFiles != m_knownChatLogFiles) {
-        qDebug() << "ChatLogWorker: Detected chat log file changes";
-        m_knownChatLogFiles = currentChatFiles;
-        newFilesFound = true;
+      buffer = file.read(chunkEnd - chunkStart);
+      if (buffer.size() != chunkEnd - chunkStart) {
+        break;
       }
+      buffer.append(carry);
+      if (chunkEnd == dataEnd) {
+        buffer.append(terminator);
+      }
+      region = buffer;
     }
-  }
-
-  if (m_enableGameLogMonitoring) {
-    QDir gd(m_gameLogDirectory);
-    if (gd.exists()) {
-      QStringList gameFiles =
-          gd.entryList(QStringList() << "*.txt", QDir::Files);
-      QSet<QString> currentGameFiles;
-      for (const QString &f : gameFiles) {
-        currentGameFiles.insert(gd.absoluteFilePath(f));
+    carry.clear();
+
+    // Unless this chunk starts the file, its first line is incomplete and is
+    // carried over to the next (earlier) chunk
+    qsizetype scanFrom = 0;
+    if (chunkStart > 0) {
+      scanFrom = LogPrefilter::nextLineStart(region, isChatLog);
+      if (scanFrom < 0) {
+        if (!mapped) {
+          carry = buffer;
+        }
+        chunkEnd = chunkStart;
+        continue;
       }
-
-      if (m_knownGameLogFiles.isEmpty()) {
-        m_knownGameLogFiles = currentGameFiles;
-        newFilesFound = true;
-      } else if (currentGameFiles != m_knownGameLogFiles) {
-        qDebug() << "ChatLogWorker: Detected game log file changes";
-        m_knownGameLogFiles = currentGameFiles;
-        newFilesFound = true;
+      if (!mapped) {
+        carry = buffer.left(scanFrom);
       }
     }
-  }
-
-  if (newFilesFound) {
-    qDebug() << "ChatLogWorker: New files detected, scanning...";
-    scanExistingLogs();
-  } else {
-  }
-}
-
-QString
-ChatLogWorker::findChatLogFileForCharacter(const QString &characterName) {
-
-  QDir chatLogDir(m_logDirectory);
-  if (!chatLogDir.exists()) {
-    return QString();
-  }
-
-  QStringList filters;
-  filters << "Local_*.txt";
 
-  QFileInfoList chatFiles =
-      chatLogDir.entryInfoList(filters, QDir::Files, QDir::Time);
+    QByteArrayView lines = region.sliced(scanFrom);
+    candidates.clear();
+    LogPrefilter::scan(lines, isChatLog, candidates);
 
-  for (const QFileInfo &fileInfo : chatFiles) {
-    QDateTime lastModified = fileInfo.lastModified();
-    qint64 hoursSinceModified =
-        lastModified.secsTo(QDateTime::currentDateTime()) / 3600;
+    for (int i = candidates.size() - 1; i >= 0; --i) {
+      QByteArrayView lineData =
+          lines.sliced(candidates[i].start, candidates[i].length);
 
-    if (hoursSinceModified > 24) {
-      continue;
+      const QString line = decodeLogLine(lineData, isChatLog).trimmed();
+      if (matches(line)) {
+        return line;
+      }
     }
 
-    QString foundCharacter =
-        extractCharacterFromLogFile(fileInfo.absoluteFilePath());
-    if (foundCharacter.compare(characterName, Qt::CaseInsensitive) == 0) {
-      return fileInfo.absoluteFilePath();
-    }
+    // The synthetic terminator may have been the first line break found
+    pendingEnd = qMin(dataEnd, chunkStart + scanFrom);
+    chunkEnd = chunkStart;
   }
 
   return QString();
 }
 
-QString
-ChatLogWorker::findGameLogFileForCharacter(const QString &characterName) {
-
-  QDir gameLogDir(m_gameLogDirectory);
-  if (!gameLogDir.exists()) {
-    return QString();
+bool ChatLogWorker::openLogFile(LogFileState *state) {
+  if (!state->file) {
+    state->file = std::make_unique<QFile>(state->filePath);
+  } else if (state->file->isOpen()) {
+    state->file->close();
   }
 
-  QStringList filters;
-  filters << "*.txt";
-
-  QFileInfoList gameFiles =
-      gameLogDir.entryInfoList(filters, QDir::Files, QDir::Time);
+  // Unbuffered: reads go straight into the state's reusable buffer
+  if (!state->file->open(QIODevice::ReadOnly | QIODevice::Unbuffered)) {
+    return false;
+  }
 
-  for (const QFileInfo &fileInfo : gameFiles) {
-    QDateTime lastModified = fileInfo.lastModified();
-    qint64 hoursSinceModified =
-        lastModified.secsTo(QDateTime::currentDateTime()) / 3600;
+  return true;
+}
 
-    if (hoursSinceModified > 24) {
-      continue;
+void ChatLogWorker::attachIntelLogs(QSet<QString> &monitoredFiles) {
+  if (!m_systemMatcher) {
+    // A dictionary in the profiles directory replaces the bundled one
+    QString dictionaryPath = m_dataDirectory + "/solarsystems.txt";
+    if (!QFile::exists(dictionaryPath)) {
+      dictionaryPath = ":/solarsystems.txt";
     }
 
-    QString foundCharacter =
-        extractCharacterFromLogFile(fileInfo.absoluteFilePath());
-    if (foundCharacter.compare(characterName, Qt::CaseInsensitive) == 0) {
-      return fileInfo.absoluteFilePath();
-    }
+    m_systemMatcher = std::make_unique<SolarSystemMatcher>();
+    m_systemMatcher->build(SolarSystemMatcher::readNames(dictionaryPath));
   }
 
-  return QString();
-}
-
-QString ChatLogWorker::findLogFileForCharacter(const QString &characterName) {
+  for (auto it = m_assignedFiles.intelLogs.constBegin();
+       it != m_assignedFiles.intelLogs.constEnd(); ++it) {
+    const QString &channel = it.key();
+    const QString &intelLogFile = it.value();
 
-  QDir chatLogDir(m_logDirectory);
-  if (chatLogDir.exists()) {
-    QStringList filters;
-    filters << "Local_*.txt";
+    monitoredFiles.insert(intelLogFile);
 
-    QFileInfoList chatFiles =
-        chatLogDir.entryInfoList(filters, QDir::Files, QDir::Time);
+    if (!m_logFiles.contains(intelLogFile)) {
+      LogFileState *state = new LogFileState();
+      state->filePath = intelLogFile;
+      state->intelChannel = channel;
+      state->isChatLog = true;
+      readInitialState(state);
+      m_logFiles[intelLogFile] = state;
+      schedulePoll(state);
 
-    for (const QFileInfo &fileInfo : chatFiles) {
-      QDateTime lastModified = fileInfo.lastModified();
-      qint64 hoursSinceModified =
-          lastModified.secsTo(QDateTime::currentDateTime()) / 3600;
+      qDebug() << "ChatLogWorker: Monitoring INTEL channel" << channel << ":"
+               << intelLogFile;
+    }
+  }
+}
 
-      if (hoursSinceModified > 24) {
-        continue;
-      }
+void ChatLogWorker::pollLogFiles() {
+  QMutexLocker locker(&m_mutex);
 
-      QString foundCharacter =
-          extractCharacterFromLogFile(fileInfo.absoluteFilePath());
-      if (foundCharacter.compare(characterName, Qt::CaseInsensitive) == 0) {
-        return fileInfo.absoluteFilePath();
-      }
-    }
+  if (!m_running) {
+    return;
   }
 
-  QDir gameLogDir(m_gameLogDirectory);
-  if (gameLogDir.exists()) {
-    QStringList filters;
-    filters << "*.txt";
+  QElapsedTimer pollTimer;
+  pollTimer.start();
 
-    QFileInfoList gameFiles =
-        gameLogDir.entryInfoList(filters, QDir::Files, QDir::Time);
+  const quint64 tick = ++m_pollTick;
 
-    for (const QFileInfo &fileInfo : gameFiles) {
-      QDateTime lastModified = fileInfo.lastModified();
-      qint64 hoursSinceModified =
-          lastModified.secsTo(QDateTime::currentDateTime()) / 3600;
+  // Only the files due on this tick are checked
+  QVector<QString> due;
+  due.swap(m_pollWheel[tick % POLL_WHEEL_SLOTS]);
 
-      if (hoursSinceModified > 24) {
-        continue;
-      }
+  for (const QString &filePath : std::as_const(due)) {
+    LogFileState *state = m_logFiles.value(filePath, nullptr);
 
-      QString foundCharacter =
-          extractCharacterFromLogFile(fileInfo.absoluteFilePath());
-      if (foundCharacter.compare(characterName, Qt::CaseInsensitive) == 0) {
-        return fileInfo.absoluteFilePath();
-      }
+    // Skip entries of removed files and of files rescheduled since
+    if (!state || state->nextPollTick != tick) {
+      continue;
     }
-  }
 
-  return QString();
-}
+    const qint64 sizeBefore = state->lastSize;
+    readNewLines(state);
+    const bool grew = state->lastSize != sizeBefore;
+    state->idlePolls = grew ? 0 : state->idlePolls + 1;
 
-QString ChatLogWorker::extractCharacterFromLogFile(const QString &filePath) {
-  QFileInfo fileInfo(filePath);
-  qint64 modTime = fileInfo.lastModified().toMSecsSinceEpoch();
-
-  auto it = m_fileToCharacterCache.find(filePath);
-  if (it != m_fileToCharacterCache.end() && it->second == modTime) {
-    return it->first;
-  }
+    // Data found by polling was not announced: the watcher does not report
+    // appends to this file (common on Windows while EVE keeps it open)
+    if (grew) {
+      state->notificationsSeen = false;
+    }
 
-  QFile file(filePath);
-  if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
-    return QString();
+    schedulePoll(state);
   }
 
-  QTextStream in(&file);
-  in.setAutoDetectUnicode(true);
-
-  static QRegularExpression listenerPattern(R"(Listener:\s+(.+))");
+  flushEvents();
 
-  QString fileName = fileInfo.fileName();
-  bool isChatLog = fileName.startsWith("Local_", Qt::CaseInsensitive);
-
-  QString characterName;
+  LogPipelineStats::add(m_stats.polls, 1);
+  m_stats.pollDuration.record(pollTimer.nsecsElapsed() / 1000);
+}
 
-  if (isChatLog) {
-    for (int i = 1; i <= 8 && !in.atEnd(); ++i) {
-      in.readLine();
-    }
+void ChatLogWorker::onLogFileChanged(const QString &path) {
+  QMutexLocker locker(&m_mutex);
 
-    if (!in.atEnd()) {
-      QString line = in.readLine();
-      QRegularExpressionMatch match = listenerPattern.match(line);
-      if (match.hasMatch()) {
-        characterName = match.captured(1).trimmed();
-      }
-    }
-  } else {
-    for (int i = 1; i <= 2 && !in.atEnd(); ++i) {
-      in.readLine();
-    }
+  if (!m_running || !m_eventDrivenMonitoring) {
+    return;
+  }
 
-    if (!in.atEnd()) {
-      QString line = in.readLine();
-      QRegularExpressionMatch match = listenerPattern.match(line);
-      if (match.hasMatch()) {
-        characterName = match.captured(1).trimmed();
-      }
-    }
+  LogFileState *state = m_logFiles.value(path, nullptr);
+  if (!state) {
+    return;
   }
 
-  file.close();
+  readNewLines(state);
 
-  if (!characterName.isEmpty()) {
-    m_fileToCharacterCache[filePath] = qMakePair(characterName, modTime);
+  // Push the fallback poll of this file back
+  state->idlePolls = 0;
+  state->notificationsSeen = true;
+  schedulePoll(state);
+
+  // The watcher drops paths whose file was replaced; re-arm if it came back
+  if (!m_fileWatcher->files().contains(path) && QFile::exists(path)) {
+    m_fileWatcher->addPath(path);
   }
 
-  return characterName;
+  flushEvents();
 }
 
-void ChatLogWorker::pollLogFiles() {
-  QMutexLocker locker(&m_mutex);
+void ChatLogWorker::updateFileWatches() {
+  QStringList watchedFiles = m_fileWatcher->files();
 
-  if (!m_running) {
+  if (!m_eventDrivenMonitoring) {
+    if (!watchedFiles.isEmpty()) {
+      m_fileWatcher->removePaths(watchedFiles);
+    }
     return;
   }
 
-  bool hadActivity = false;
-
-  // Check all monitored log files for changes
-  for (auto it = m_logFiles.begin(); it != m_logFiles.end(); ++it) {
-    LogFileState *state = it.value();
-
-    if (readNewLines(state)) {
-      hadActivity = true;
+  QStringList toRemove;
+  for (const QString &path : watchedFiles) {
+    if (!m_logFiles.contains(path)) {
+      toRemove.append(path);
     }
   }
+  if (!toRemove.isEmpty()) {
+    m_fileWatcher->removePaths(toRemove);
+  }
 
-  // Update polling rate based on activity
-  updatePollingRate(hadActivity);
+  QSet<QString> watchedSet(watchedFiles.begin(), watchedFiles.end());
+  QStringList toAdd;
+  for (auto it = m_logFiles.constBegin(); it != m_logFiles.constEnd(); ++it) {
+    if (!watchedSet.contains(it.key())) {
+      toAdd.append(it.key());
+    }
+  }
+  if (!toAdd.isEmpty()) {
+    QStringList failed = m_fileWatcher->addPaths(toAdd);
+    if (!failed.isEmpty()) {
+      qDebug() << "ChatLogWorker:" << failed.size()
+               << "log files could not be watched, relying on polling";
+    }
+  }
 }
 
 bool ChatLogWorker::readNewLines(LogFileState *state) {
-  QFileInfo fi(state->filePath);
-
-  if (!fi.exists()) {
-    return false;
+  if (!state->file || !state->file->isOpen()) {
+    if (!openLogFile(state)) {
+      return false;
+    }
   }
 
-  qint64 currentSize = fi.size();
-  qint64 currentModified = fi.lastModified().toMSecsSinceEpoch();
+  QFile *file = state->file.get();
 
-  // Check if file has changed
-  if (currentSize == state->lastSize &&
-      currentModified == state->lastModified) {
+  // Logs are append-only, so a single size query on the open handle is
+  // enough to detect new data
+  qint64 currentSize = file->size();
+
+  if (currentSize == state->lastSize) {
     state->hadActivityLastPoll = false;
     return false;
   }
 
   // Handle file truncation (log rotation or reset)
-  if (currentSize < state->lastSize) {
-    qDebug() << "ChatLogWorker: File truncated, resetting position:"
+  if (currentSize < state->lastSize || state->position > currentSize) {
+    qDebug() << "ChatLogWorker: File truncated, reopening:"
              << state->filePath;
     state->position = 0;
-    state->partialLine.clear();
+    state->catchingUp = true;
+    state->readBuffer.clear();
+    state->readOffset = 0;
+    state->searchedBytes = 0;
+    if (!openLogFile(state)) {
+      return false;
+    }
+    file = state->file.get();
+    currentSize = file->size();
   }
 
-  QFile file(state->filePath);
-  if (!file.open(QIODevice::ReadOnly)) {
-    return false;
-  }
+  qint64 available = currentSize - state->position;
+  state->lastSize = currentSize;
 
-  // Seek to last position
-  if (state->position > currentSize) {
-    state->position = 0; // File was truncated
+  if (available <= 0) {
+    state->hadActivityLastPoll = false;
+    return false;
   }
 
-  file.seek(state->position);
+  state->lastModified = QDateTime::currentMSecsSinceEpoch();
 
-  // Read new data
-  QByteArray newData = file.readAll();
-  file.close();
+  QElapsedTimer readTimer;
+  readTimer.start();
 
-  if (newData.isEmpty()) {
-    state->lastSize = currentSize;
-    state->lastModified = currentModified;
-    state->hadActivityLastPoll = false;
+  if (file->pos() != state->position && !file->seek(state->position)) {
     return false;
   }
 
-  // Update position
-  state->position += newData.size();
-  state->lastSize = currentSize;
-  state->lastModified = currentModified;
+  // The buffer holds the incomplete line left over from the previous read
+  // at readOffset; the new data is appended after it. Capacity is kept
+  // across reads, and the leftover is only moved to the front when the
+  // buffer would have to grow otherwise.
+  if (state->readOffset == state->readBuffer.size()) {
+    state->readBuffer.resize(0);
+    state->readOffset = 0;
+  } else if (state->readOffset > 0 &&
+             state->readBuffer.size() + available >
+                 state->readBuffer.capacity()) {
+    state->readBuffer.remove(0, state->readOffset);
+    state->readOffset = 0;
+  }
 
-  // Chatlogs use UTF-16 LE, gamelogs use UTF-8
-  QString newText;
-  if (state->isChatLog) {
-    auto decoder = QStringDecoder(QStringDecoder::Utf16LE);
-    newText = decoder(newData);
-  } else {
-    newText = QString::fromUtf8(newData);
+  const qsizetype end = state->readBuffer.size();
+  state->readBuffer.resize(end + available);
+  qint64 bytesRead = file->read(state->readBuffer.data() + end, available);
+
+  if (bytesRead <= 0) {
+    state->readBuffer.resize(end);
+    state->hadActivityLastPoll = false;
+    return false;
   }
 
-  // Combine partial line from previous read with new data
-  QString text = state->partialLine + newText;
-  QStringList lines = text.split('\n');
+  state->readBuffer.resize(end + bytesRead);
 
-  // Save last line if it doesn't end with newline (partial line)
-  if (!text.endsWith('\n')) {
-    state->partialLine = lines.takeLast();
-  } else {
-    state->partialLine.clear();
+  // Update position
+  state->position += bytesRead;
+  LogPipelineStats::add(m_stats.bytesRead, quint64(bytesRead));
+
+  // Fast check on raw bytes: skip 95% of lines that aren't system changes or
+  // jumps before any of them is decoded. Every intel line is a candidate,
+  // and so is every line while alert rules apply to this kind of log.
+  const bool isIntelLog = !state->intelChannel.isEmpty();
+  const bool checkAlerts =
+      !isIntelLog && m_alertMatcher.hasRulesFor(state->isChatLog);
+  m_candidateLines.clear();
+  const QByteArrayView unread = pendingData(state);
+  LogPrefilter::ScanResult scan =
+      isIntelLog || checkAlerts
+          ? LogPrefilter::splitLines(unread, state->isChatLog,
+                                     m_candidateLines, state->searchedBytes)
+          : LogPrefilter::scan(unread, state->isChatLog, m_candidateLines,
+                               state->searchedBytes, m_combatDamageTracking);
+  LogPipelineStats::add(m_stats.linesScanned, quint64(scan.linesScanned));
+  LogPipelineStats::add(m_stats.linesPrefiltered,
+                        quint64(m_candidateLines.size()));
+
+  // Only a read that may start behind the live end of the log drops old
+  // alerts; the lines of a live read are delivered whatever their time
+  m_staleBefore = 0;
+  if (state->catchingUp && m_maxEventAgeMs > 0) {
+    const qint64 newest = newestLineTime(state);
+    if (newest > 0) {
+      m_staleBefore = newest - m_maxEventAgeMs;
+    }
   }
+  m_readingCatchUp = state->catchingUp;
+  state->catchingUp = false;
+  auto endCatchUp = qScopeGuard([this]() {
+    m_staleBefore = 0;
+    m_readingCatchUp = false;
+  });
 
-  // Process complete lines
+  // Process relevant complete lines
   bool hadRelevantLines = false;
-  for (const QString &line : lines) {
-    if (line.isEmpty()) {
-      continue;
+  for (const LogPrefilter::LineRange &range : m_candidateLines) {
+    QString line = decodeLogLine(unread.sliced(range.start, range.length),
+                                 state->isChatLog);
+
+    // This is a relevant line, parse it
+    hadRelevantLines = true;
+    line = line.trimmed();
+
+    QElapsedTimer parseTimer;
+    parseTimer.start();
+    // Per-worker count: other workers emit into the shared stats meanwhile
+    const quint64 eventsBefore = m_eventsEmitted;
+
+    const qint64 lineTime = lineTimestamp(line);
+
+    CombatHit hit;
+    if (isIntelLog) {
+      parseIntelLine(line, state->intelChannel, lineTime);
+    } else if (m_combatDamageTracking && !state->isChatLog &&
+               CombatDamageTracker::parseLine(line, hit)) {
+      LogPipelineStats::add(m_stats.linesParsed, 1);
+      const qint64 newestBefore = m_damageTracker.newestTimestamp();
+      m_damageTracker.record(state->characterName, lineTime, hit);
+      if (m_damageTracker.newestTimestamp() > newestBefore) {
+        m_combatLogClock.start();
+      }
+      if (!m_combatStatsTimer->isActive()) {
+        m_combatStatsTimer->start();
+      }
+    } else {
+      parseLogLine(line, state->characterName, lineTime);
     }
 
-    // Fast check: skip 95% of lines that aren't system changes or jumps
-    if (!shouldParseLine(line, state->isChatLog)) {
-      continue;
+    if (checkAlerts) {
+      matchAlertRules(line, state->characterName, state->isChatLog, lineTime);
     }
 
-    // This is a relevant line, parse it
-    hadRelevantLines = true;
-    parseLogLine(line.trimmed(), state->characterName);
+    m_stats.parseTime.record(parseTimer.nsecsElapsed() / 1000);
+    // Like the delivery delay, only measured for the lines of live reads
+    if (isLiveRead() && m_eventsEmitted != eventsBefore) {
+      const qint64 delayMs = QDateTime::currentMSecsSinceEpoch() - lineTime;
+      m_stats.eventDelay.record(delayMs * 1000);
+    }
   }
 
+  // Keep only the incomplete trailing line for the next read; it has
+  // already been searched for a line terminator
+  state->readOffset += scan.consumed;
+  state->searchedBytes = LogPrefilter::searchedTail(
+      state->readBuffer.size() - state->readOffset, state->isChatLog);
+
   state->hadActivityLastPoll = hadRelevantLines;
+  m_stats.fileReadLatency.record(readTimer.nsecsElapsed() / 1000);
   return hadRelevantLines;
 }
 
-bool ChatLogWorker::shouldParseLine(const QString &line, bool isChatLog) {
-  // Fast character-based filter to skip most lines
-  // We're looking for:
-  // - Chat logs: "EVE System" (for "Channel changed to Local:")
-  // - Game logs: "Jumping from", "Undocking", or event markers like (notify),
-  // (question), (mining)
-
-  if (isChatLog) {
-    // Look for "EVE System" indicator (case insensitive check via chars)
-    // Most lines are player chat, skip those fast
-    if (line.contains("EVE System", Qt::CaseInsensitive)) {
-      return true;
-    }
-  } else {
-    // Game log: look for jump, undock, or event type markers
-    if (line.contains("Jumping", Qt::CaseInsensitive) ||
-        line.contains("Undocking", Qt::CaseInsensitive) ||
-        line.contains("(notify)", Qt::CaseInsensitive) ||
-        line.contains("(question)", Qt::CaseInsensitive) ||
-        line.contains("(mining)", Qt::CaseInsensitive) ||
-        line.contains("(None)", Qt::CaseInsensitive)) {
-      return true;
-    }
-  }
-
-  return false;
+void ChatLogWorker::schedulePoll(LogFileState *state) {
+  const bool live =
+      LogPollSchedule::isLive(state->clientRunning, state->lastModified,
+                              QDateTime::currentMSecsSinceEpoch());
+  const int intervalMs = LogPollSchedule::intervalMs(
+      state->idlePolls, live,
+      m_eventDrivenMonitoring && state->notificationsSeen);
+
+  const int delayTicks = qMax(1, intervalMs / POLL_TICK_MS);
+  state->nextPollTick = m_pollTick + delayTicks;
+  m_pollWheel[state->nextPollTick % POLL_WHEEL_SLOTS].append(state->filePath);
 }
 
-void ChatLogWorker::updatePollingRate(bool hadActivity) {
-  int desiredInterval = SLOW_POLL_MS;
-
-  // Use fast polling if we had activity this cycle
-  if (hadActivity) {
-    desiredInterval = FAST_POLL_MS;
-    m_activeFilesLastPoll = 10; // Reset momentum counter on activity
-  } else {
-    // Decrement counter when no activity
-    if (m_activeFilesLastPoll > 0) {
-      m_activeFilesLastPoll--;
-    }
-  }
-
-  // Keep fast polling for a bit after activity stops (momentum)
-  if (m_activeFilesLastPoll > 0) {
-    desiredInterval = FAST_POLL_MS;
-  }
-
-  // Update timer interval if it changed
-  if (desiredInterval != m_currentPollInterval) {
-    m_currentPollInterval = desiredInterval;
-    m_pollTimer->setInterval(desiredInterval);
-
-    // Don't spam logs, only when switching rates
-    static int lastLoggedInterval = -1;
-    if (lastLoggedInterval != desiredInterval) {
-      qDebug() << "ChatLogWorker: Switching poll rate to" << desiredInterval
-               << "ms";
-      lastLoggedInterval = desiredInterval;
-    }
-  }
-}
-
-void ChatLogWorker::parseLogLine(const QString &line,
-                                 const QString &characterName) {
-  // Trust EVE's logs to be clean - skip expensive normalization
-  // Only use simple trimming for performance with 40+ monitored files
-  QString workingLine = line.trimmed();
+void ChatLogWorker::parseLogLine(const QString &line,
+                                 const QString &characterName,
+                                 qint64 lineTime) {
+  // Trust EVE's logs to be clean - skip expensive normalization
+  // Only use simple trimming for performance with 40+ monitored files
+  QString workingLine = line.trimmed();
 
   // Remove BOM character that appears at the start of each chatlog line
   if (!workingLine.isEmpty() && workingLine[0] == QChar(0xFEFF)) {
@@ -1060,371 +1014,267 @@ void ChatLogWorker::parseLogLine(const QString &line,
     return;
   }
 
+  // One pass over the line finds the extractors that may apply; their
+  // regexes confirm the match and pull out captures. A regex that does not
+  // match hands the line on to the next candidate.
   const int searchStart = 20;
-  int notifyPos =
-      workingLine.indexOf("(notify)", searchStart, Qt::CaseInsensitive);
-  int questionPos =
-      workingLine.indexOf("(question)", searchStart, Qt::CaseInsensitive);
-  int miningPos =
-      workingLine.indexOf("(mining)", searchStart, Qt::CaseInsensitive);
-  int nonePos = workingLine.indexOf("(None)", searchStart, Qt::CaseInsensitive);
-  int eveSystemPos =
-      workingLine.indexOf("EVE System", searchStart, Qt::CaseInsensitive);
-
-  if (eveSystemPos != -1) {
-    static QRegularExpression systemChangePattern(
-        R"(\[\s*([\d.\s:]+)\]\s*EVE System\s*>\s*Channel changed to Local\s*:\s*(.+))",
-        QRegularExpression::CaseInsensitiveOption |
-            QRegularExpression::UseUnicodePropertiesOption);
+  const LogLineClassifier::Kinds kinds =
+      m_lineClassifier.classify(workingLine, searchStart);
+  if (kinds.isEmpty()) {
+    return;
+  }
 
-    QRegularExpressionMatch match = systemChangePattern.match(workingLine);
-    if (match.hasMatch()) {
-      QString timestampStr = match.captured(1).trimmed();
-      QString rawSystem = match.captured(2).trimmed();
+  LogPipelineStats::add(m_stats.linesParsed, 1);
+  const LogLineClassifier::Extraction extraction =
+      LogLineClassifier::extract(kinds, workingLine);
+  if (extraction.kind != LogLineKind::Unrecognized) {
+    handleClassifiedLine(extraction.kind, extraction.match, characterName,
+                         lineTime);
+  }
+}
 
-      QString newSystem = sanitizeSystemName(rawSystem);
+void ChatLogWorker::handleClassifiedLine(LogLineKind kind,
+                                         const QRegularExpressionMatch &match,
+                                         const QString &characterName,
+                                         qint64 lineTime) {
+  switch (kind) {
+  case LogLineKind::SystemChange: {
+    QString timestampStr = match.captured(1).trimmed();
+    QString rawSystem = match.captured(2).trimmed();
 
-      CharacterLocation &location = m_characterLocations[characterName];
+    QString newSystem = sanitizeSystemName(rawSystem);
 
-      // Early exit if already in this system (skip timestamp checks)
-      if (!location.systemName.isEmpty() && location.systemName == newSystem) {
-        return;
-      }
+    CharacterLocation &location = m_characterLocations[characterName];
 
-      qint64 updateTime = parseEVETimestamp(timestampStr);
-
-      if (updateTime > location.lastUpdate ||
-          (updateTime == location.lastUpdate &&
-           location.systemName != newSystem)) {
-        location.characterName = characterName;
-        location.systemName = newSystem;
-        location.lastUpdate = updateTime;
-
-        qDebug() << "ChatLogWorker: System change detected (chatlog):"
-                 << characterName << "->" << newSystem << "(from"
-                 << timestampStr << ", was at" << location.systemName << "at"
-                 << location.lastUpdate << "ms)";
-
-        qint64 emitTime = QDateTime::currentMSecsSinceEpoch();
-        emit systemChanged(characterName, newSystem);
-        qint64 emitElapsed = QDateTime::currentMSecsSinceEpoch() - emitTime;
-        qDebug() << "ChatLogWorker: systemChanged signal emitted in"
-                 << emitElapsed << "ms";
-      } else {
-        qDebug() << "ChatLogWorker: Chatlog system change for" << characterName
-                 << "is older than current location (current:"
-                 << location.systemName << "at" << location.lastUpdate
-                 << "ms, chatlog:" << newSystem << "at" << updateTime
-                 << "ms), ignoring";
-      }
+    // Early exit if already in this system (skip timestamp checks)
+    if (!location.systemName.isEmpty() && location.systemName == newSystem) {
+      return;
     }
-    return;
-  }
 
-  if (questionPos != -1) {
-    static QRegularExpression fleetInvitePattern(
-        R"(\[\s*[\d.\s:]+\]\s*\(question\)\s*<a href="[^"]+">([^<]+)</a>\s*wants you to join their fleet)");
+    qint64 updateTime = parseEVETimestamp(timestampStr);
 
-    QRegularExpressionMatch fleetMatch = fleetInvitePattern.match(workingLine);
-    if (fleetMatch.hasMatch()) {
-      QString inviter = fleetMatch.captured(1).trimmed();
-      QString eventText = QString("Fleet invite from %1").arg(inviter);
-      qDebug() << "ChatLogWorker: Fleet invite detected for" << characterName
-               << "from" << inviter;
-      emit combatEventDetected(characterName, "fleet_invite", eventText);
+    if (updateTime > location.lastUpdate ||
+        (updateTime == location.lastUpdate &&
+         location.systemName != newSystem)) {
+      location.characterName = characterName;
+      location.systemName = newSystem;
+      location.lastUpdate = updateTime;
+
+      qDebug() << "ChatLogWorker: System change detected (chatlog):"
+               << characterName << "->" << newSystem << "(from"
+               << timestampStr << ", was at" << location.systemName << "at"
+               << location.lastUpdate << "ms)";
+
+      queueSystemChanged(characterName, newSystem, updateTime);
+    } else {
+      qDebug() << "ChatLogWorker: Chatlog system change for" << characterName
+               << "is older than current location (current:"
+               << location.systemName << "at" << location.lastUpdate
+               << "ms, chatlog:" << newSystem << "at" << updateTime
+               << "ms), ignoring";
     }
     return;
   }
 
-  if (notifyPos != -1) {
-    int followingPos =
-        workingLine.indexOf("Following", notifyPos, Qt::CaseInsensitive);
-    int regroupingPos =
-        workingLine.indexOf("Regrouping", notifyPos, Qt::CaseInsensitive);
-    int compressedPos =
-        workingLine.indexOf("compressed", notifyPos, Qt::CaseInsensitive);
-    int cloakPos = workingLine.indexOf("cloak deactivates", notifyPos,
-                                       Qt::CaseInsensitive);
-    int crystalBrokePos = workingLine.indexOf(
-        "deactivates due to the destruction", notifyPos, Qt::CaseInsensitive);
-    int asteroidDepletedPos = workingLine.indexOf(
-        "pale shadow of its former glory", notifyPos, Qt::CaseInsensitive);
-
-    if (followingPos != -1) {
-      static QRegularExpression followWarpPattern(
-          R"(\[\s*[\d.\s:]+\]\s*\(notify\)\s*Following\s+(.+?)\s+in warp)");
-
-      QRegularExpressionMatch followMatch =
-          followWarpPattern.match(workingLine);
-      if (followMatch.hasMatch()) {
-        QString leader = followMatch.captured(1).trimmed();
-
-        QString displayName = m_cachedCustomNames.value(leader, leader);
-
-        QString eventText = QString("Following %1").arg(displayName);
-        qDebug() << "ChatLogWorker: Follow warp detected for" << characterName
-                 << "->" << leader
-                 << (displayName != leader
-                         ? QString(" (displayed as: %1)").arg(displayName)
-                         : "");
-        emit combatEventDetected(characterName, "follow_warp", eventText);
-        return;
-      }
-    }
-
-    if (regroupingPos != -1) {
-      static QRegularExpression regroupPattern(
-          R"(\[\s*[\d.\s:]+\]\s*\(notify\)\s*Regrouping to\s+(.+?)(?:\.|$))");
-
-      QRegularExpressionMatch regroupMatch = regroupPattern.match(workingLine);
-      if (regroupMatch.hasMatch()) {
-        QString leader = regroupMatch.captured(1).trimmed();
+  case LogLineKind::FleetInvite: {
+    QString inviter = match.captured(1).trimmed();
+    QString eventText = QString("Fleet invite from %1").arg(inviter);
+    qDebug() << "ChatLogWorker: Fleet invite detected for" << characterName
+             << "from" << inviter;
+    queueCombatEvent(characterName, "fleet_invite", eventText, lineTime);
+    return;
+  }
 
-        QString displayName = m_cachedCustomNames.value(leader, leader);
+  case LogLineKind::FollowWarp: {
+    QString leader = match.captured(1).trimmed();
 
-        QString eventText = QString("Regrouping to %1").arg(displayName);
-        qDebug() << "ChatLogWorker: Regroup detected for" << characterName
-                 << "->" << leader
-                 << (displayName != leader
-                         ? QString(" (displayed as: %1)").arg(displayName)
-                         : "");
-        emit combatEventDetected(characterName, "regroup", eventText);
-        return;
-      }
-    }
+    QString displayName = m_cachedCustomNames.value(leader, leader);
 
-    if (compressedPos != -1) {
-      static QRegularExpression compressionPattern(
-          R"(\[\s*[\d.\s:]+\]\s*\(notify\)\s*Successfully compressed\s+(.+?)\s+into\s+(\d+)\s+(.+))");
-
-      QRegularExpressionMatch compressMatch =
-          compressionPattern.match(workingLine);
-      if (compressMatch.hasMatch()) {
-        QString count = compressMatch.captured(2).trimmed();
-        QString compressedItem = compressMatch.captured(3).trimmed();
-        if (compressedItem.endsWith('.')) {
-          compressedItem.chop(1);
-        }
-        QString eventText =
-            QString("Compressed: %1x %2").arg(count, compressedItem);
-        qDebug() << "ChatLogWorker: Compression detected for" << characterName
-                 << ":" << eventText;
-        emit combatEventDetected(characterName, "compression", eventText);
-        return;
-      }
-    }
+    QString eventText = QString("Following %1").arg(displayName);
+    qDebug() << "ChatLogWorker: Follow warp detected for" << characterName
+             << "->" << leader
+             << (displayName != leader
+                     ? QString(" (displayed as: %1)").arg(displayName)
+                     : "");
+    queueCombatEvent(characterName, "follow_warp", eventText, lineTime);
+    return;
+  }
 
-    if (cloakPos != -1) {
-      static QRegularExpression decloakPattern(
-          R"(\[\s*[\d.\s:]+\]\s*\(notify\)\s*Your cloak deactivates due to proximity to (?:a nearby )?(.+?)\.)");
-
-      QRegularExpressionMatch decloakMatch = decloakPattern.match(workingLine);
-      if (decloakMatch.hasMatch()) {
-        QString source = decloakMatch.captured(1).trimmed();
-        QString eventText = QString("Decloaked by %1").arg(source);
-        qDebug() << "ChatLogWorker: Decloak detected for" << characterName
-                 << "- Source:" << source;
-        emit combatEventDetected(characterName, "decloak", eventText);
-        return;
-      }
-    }
+  case LogLineKind::Regroup: {
+    QString leader = match.captured(1).trimmed();
 
-    if (crystalBrokePos != -1) {
-      static QRegularExpression crystalPattern(
-          R"(\[\s*[\d.\s:]+\]\s*\(notify\)\s*(.+?)\s+deactivates due to the destruction of the\s+(.+?)\s+it was fitted with)");
-
-      QRegularExpressionMatch crystalMatch = crystalPattern.match(workingLine);
-      if (crystalMatch.hasMatch()) {
-        QString module = crystalMatch.captured(1).trimmed();
-        QString crystal = crystalMatch.captured(2).trimmed();
-        QString eventText = QString("Crystal broke: %1").arg(crystal);
-        qDebug() << "ChatLogWorker: Mining crystal broke detected for"
-                 << characterName << "- Module:" << module
-                 << "- Crystal:" << crystal;
-        emit combatEventDetected(characterName, "crystal_broke", eventText);
-        return;
-      }
-    }
+    QString displayName = m_cachedCustomNames.value(leader, leader);
 
-    if (asteroidDepletedPos != -1) {
-      static QRegularExpression asteroidPattern(
-          R"(\[\s*[\d.\s:]+\]\s*\(notify\)\s*(.+?)\s+deactivates as it finds the resource it was harvesting a pale shadow of its former glory)");
-
-      QRegularExpressionMatch asteroidMatch =
-          asteroidPattern.match(workingLine);
-      if (asteroidMatch.hasMatch()) {
-        QString module = asteroidMatch.captured(1).trimmed();
-        qDebug() << "ChatLogWorker: Asteroid depleted detected for"
-                 << characterName << "- Module:" << module;
-
-        // Stop the mining timer if it exists
-        QTimer *timer = m_miningTimers.value(characterName, nullptr);
-        if (timer && timer->isActive()) {
-          timer->stop();
-          qDebug() << "ChatLogWorker: Stopped mining timer for"
-                   << characterName;
-        }
+    QString eventText = QString("Regrouping to %1").arg(displayName);
+    qDebug() << "ChatLogWorker: Regroup detected for" << characterName
+             << "->" << leader
+             << (displayName != leader
+                     ? QString(" (displayed as: %1)").arg(displayName)
+                     : "");
+    queueCombatEvent(characterName, "regroup", eventText, lineTime);
+    return;
+  }
 
-        // Mark mining as stopped and emit event
-        if (m_miningActiveState.value(characterName, false)) {
-          m_miningActiveState[characterName] = false;
-          emit combatEventDetected(characterName, "mining_stopped",
-                                   "Mining stopped");
-          qDebug() << "ChatLogWorker: Mining stopped for" << characterName
-                   << "(asteroid depleted)";
-        }
-        return;
-      }
+  case LogLineKind::Compression: {
+    QString count = match.captured(2).trimmed();
+    QString compressedItem = match.captured(3).trimmed();
+    if (compressedItem.endsWith('.')) {
+      compressedItem.chop(1);
     }
-
+    QString eventText =
+        QString("Compressed: %1x %2").arg(count, compressedItem);
+    qDebug() << "ChatLogWorker: Compression detected for" << characterName
+             << ":" << eventText;
+    queueCombatEvent(characterName, "compression", eventText, lineTime);
     return;
   }
 
-  if (miningPos != -1) {
-    static QRegularExpression miningPattern(R"(\[\s*[\d.\s:]+\]\s*\(mining\))");
+  case LogLineKind::Decloak: {
+    QString source = match.captured(1).trimmed();
+    QString eventText = QString("Decloaked by %1").arg(source);
+    qDebug() << "ChatLogWorker: Decloak detected for" << characterName
+             << "- Source:" << source;
+    queueCombatEvent(characterName, "decloak", eventText, lineTime);
+    return;
+  }
 
-    QRegularExpressionMatch miningMatch = miningPattern.match(workingLine);
-    if (miningMatch.hasMatch()) {
-      qDebug() << "ChatLogWorker: Mining event detected";
-      handleMiningEvent(characterName, "ore");
-    }
+  case LogLineKind::CrystalBroke: {
+    QString module = match.captured(1).trimmed();
+    QString crystal = match.captured(2).trimmed();
+    QString eventText = QString("Crystal broke: %1").arg(crystal);
+    qDebug() << "ChatLogWorker: Mining crystal broke detected for"
+             << characterName << "- Module:" << module
+             << "- Crystal:" << crystal;
+    queueCombatEvent(characterName, "crystal_broke", eventText, lineTime);
     return;
   }
 
-  if (nonePos != -1) {
-    int jumpingPos =
-        workingLine.indexOf("Jumping", nonePos, Qt::CaseInsensitive);
-    int convoRequestPos =
-        workingLine.indexOf("conversation", nonePos, Qt::CaseInsensitive);
+  case LogLineKind::AsteroidDepleted: {
+    QString module = match.captured(1).trimmed();
+    qDebug() << "ChatLogWorker: Asteroid depleted detected for"
+             << characterName << "- Module:" << module;
 
-    if (jumpingPos != -1) {
-      static QRegularExpression jumpPattern(
-          R"(\[\s*([\d.\s:]+)\]\s*\(None\)\s*Jumping from\s+(.+?)\s+to\s+(.+))");
+    // Stop the mining timer if it exists
+    QTimer *timer = m_miningTimers.value(characterName, nullptr);
+    if (timer && timer->isActive()) {
+      timer->stop();
+      qDebug() << "ChatLogWorker: Stopped mining timer for" << characterName;
+    }
 
-      QRegularExpressionMatch jumpMatch = jumpPattern.match(workingLine);
-      if (jumpMatch.hasMatch()) {
-        QString timestampStr = jumpMatch.captured(1).trimmed();
-        QString fromSystem = jumpMatch.captured(2).trimmed();
-        QString toSystem = jumpMatch.captured(3).trimmed();
+    // Mark mining as stopped and emit event
+    if (m_miningActiveState.value(characterName, false)) {
+      m_miningActiveState[characterName] = false;
+      queueCombatEvent(characterName, "mining_stopped", "Mining stopped",
+                       lineTime);
+      qDebug() << "ChatLogWorker: Mining stopped for" << characterName
+               << "(asteroid depleted)";
+    }
+    return;
+  }
 
-        QString newSystem = sanitizeSystemName(toSystem);
+  case LogLineKind::ConduitJump: {
+    QString timestampStr = match.captured(1).trimmed();
+    QString toSystem = match.captured(2).trimmed();
 
-        CharacterLocation &location = m_characterLocations[characterName];
+    QString newSystem = sanitizeSystemName(toSystem);
 
-        // Early exit if already in this system (skip timestamp checks)
-        if (!location.systemName.isEmpty() &&
-            location.systemName == newSystem) {
-          return;
-        }
+    CharacterLocation &location = m_characterLocations[characterName];
 
-        qint64 updateTime = parseEVETimestamp(timestampStr);
+    // Early exit if already in this system (skip timestamp checks)
+    if (!location.systemName.isEmpty() && location.systemName == newSystem) {
+      return;
+    }
 
-        if (updateTime > location.lastUpdate ||
-            (updateTime == location.lastUpdate &&
-             location.systemName != newSystem)) {
-          location.characterName = characterName;
-          location.systemName = newSystem;
-          location.lastUpdate = updateTime;
+    qint64 updateTime = parseEVETimestamp(timestampStr);
 
-          QDateTime detectTime = QDateTime::currentDateTime();
-          qDebug() << "ChatLogWorker: System jump detected (gamelog) at"
-                   << detectTime.toString("HH:mm:ss.zzz") << "-"
-                   << characterName << "from" << fromSystem << "to" << newSystem
-                   << "(jump timestamp:" << timestampStr << ", was at"
-                   << location.systemName << "at" << location.lastUpdate
-                   << "ms)";
+    if (updateTime > location.lastUpdate ||
+        (updateTime == location.lastUpdate &&
+         location.systemName != newSystem)) {
+      location.characterName = characterName;
+      location.systemName = newSystem;
+      location.lastUpdate = updateTime;
 
-          qint64 emitTime = QDateTime::currentMSecsSinceEpoch();
-          emit systemChanged(characterName, newSystem);
-          qint64 emitElapsed = QDateTime::currentMSecsSinceEpoch() - emitTime;
-          qDebug() << "ChatLogWorker: systemChanged signal emitted in"
-                   << emitElapsed << "ms";
-        } else {
-          qDebug() << "ChatLogWorker: Gamelog jump for" << characterName
-                   << "is older than current location (current:"
-                   << location.systemName << "at" << location.lastUpdate
-                   << "ms, gamelog:" << newSystem << "at" << updateTime
-                   << "ms), ignoring";
-        }
-      }
-    }
+      QDateTime detectTime = QDateTime::currentDateTime();
+      qDebug() << "ChatLogWorker: Conduit jump detected (gamelog) at"
+               << detectTime.toString("HH:mm:ss.zzz") << "-" << characterName
+               << "to" << newSystem << "(jump timestamp:" << timestampStr
+               << ")";
 
-    // Check for conversation requests: "(None) <a href=showinfo:...> ... </a>
-    // is inviting you to a conversation" Note: Only works when coming from
-    // someone not in the receiver's contacts.
-    if (convoRequestPos != -1) {
-      static QRegularExpression convoRequestPattern(
-          R"(\[ ([^\]]+) \] \(None\) <a href=showinfo:\d+//\d+>([^<]+)</a> is inviting you to a conversation\.)");
-
-      QRegularExpressionMatch convoRequestMatch =
-          convoRequestPattern.match(workingLine);
-      if (convoRequestMatch.hasMatch()) {
-        QString timestampStr = convoRequestMatch.captured(1).trimmed();
-        QString fromPilot = convoRequestMatch.captured(2).trimmed();
-        QString eventText = QString("Convo from: %1").arg(fromPilot);
-
-        qDebug() << "ChatLogWorker: Conversation request for" << characterName
-                 << "- From:" << fromPilot;
-        emit combatEventDetected(characterName, "convo_request", eventText);
-      }
+      queueSystemChanged(characterName, newSystem, updateTime);
+    } else {
+      qDebug() << "ChatLogWorker: Conduit jump for" << characterName
+               << "is older than current location (current:"
+               << location.systemName << "at" << location.lastUpdate
+               << "ms, gamelog:" << newSystem << "at" << updateTime
+               << "ms), ignoring";
     }
+    return;
   }
 
-  // Check for conduit jumps: "(notify) A Conduit Field activated by ... jumps
-  // you to [system]"
-  if (notifyPos != -1) {
-    int conduitPos =
-        workingLine.indexOf("Conduit Field", notifyPos, Qt::CaseInsensitive);
-    if (conduitPos != -1) {
-      static QRegularExpression conduitPattern(
-          R"(\[\s*([\d.\s:]+)\]\s*\(notify\)\s*A Conduit Field activated by .+ jumps you to\s+(.+))");
+  case LogLineKind::Mining:
+    qDebug() << "ChatLogWorker: Mining event detected";
+    handleMiningEvent(characterName, "ore");
+    return;
 
-      QRegularExpressionMatch conduitMatch = conduitPattern.match(workingLine);
-      if (conduitMatch.hasMatch()) {
-        QString timestampStr = conduitMatch.captured(1).trimmed();
-        QString toSystem = conduitMatch.captured(2).trimmed();
+  case LogLineKind::Jump: {
+    QString timestampStr = match.captured(1).trimmed();
+    QString fromSystem = match.captured(2).trimmed();
+    QString toSystem = match.captured(3).trimmed();
 
-        QString newSystem = sanitizeSystemName(toSystem);
+    QString newSystem = sanitizeSystemName(toSystem);
 
-        CharacterLocation &location = m_characterLocations[characterName];
+    CharacterLocation &location = m_characterLocations[characterName];
 
-        // Early exit if already in this system (skip timestamp checks)
-        if (!location.systemName.isEmpty() &&
-            location.systemName == newSystem) {
-          return;
-        }
+    // Early exit if already in this system (skip timestamp checks)
+    if (!location.systemName.isEmpty() && location.systemName == newSystem) {
+      return;
+    }
 
-        qint64 updateTime = parseEVETimestamp(timestampStr);
+    qint64 updateTime = parseEVETimestamp(timestampStr);
 
-        if (updateTime > location.lastUpdate ||
-            (updateTime == location.lastUpdate &&
-             location.systemName != newSystem)) {
-          location.characterName = characterName;
-          location.systemName = newSystem;
-          location.lastUpdate = updateTime;
+    if (updateTime > location.lastUpdate ||
+        (updateTime == location.lastUpdate &&
+         location.systemName != newSystem)) {
+      location.characterName = characterName;
+      location.systemName = newSystem;
+      location.lastUpdate = updateTime;
 
-          QDateTime detectTime = QDateTime::currentDateTime();
-          qDebug() << "ChatLogWorker: Conduit jump detected (gamelog) at"
-                   << detectTime.toString("HH:mm:ss.zzz") << "-"
-                   << characterName << "to" << newSystem
-                   << "(jump timestamp:" << timestampStr << ")";
+      QDateTime detectTime = QDateTime::currentDateTime();
+      qDebug() << "ChatLogWorker: System jump detected (gamelog) at"
+               << detectTime.toString("HH:mm:ss.zzz") << "-" << characterName
+               << "from" << fromSystem << "to" << newSystem
+               << "(jump timestamp:" << timestampStr << ", was at"
+               << location.systemName << "at" << location.lastUpdate << "ms)";
 
-          emit systemChanged(characterName, newSystem);
-        } else {
-          qDebug() << "ChatLogWorker: Conduit jump for" << characterName
-                   << "is older than current location (current:"
-                   << location.systemName << "at" << location.lastUpdate
-                   << "ms, gamelog:" << newSystem << "at" << updateTime
-                   << "ms), ignoring";
-        }
-      }
+      queueSystemChanged(characterName, newSystem, updateTime);
+    } else {
+      qDebug() << "ChatLogWorker: Gamelog jump for" << characterName
+               << "is older than current location (current:"
+               << location.systemName << "at" << location.lastUpdate
+               << "ms, gamelog:" << newSystem << "at" << updateTime
+               << "ms), ignoring";
     }
+    return;
+  }
+
+  case LogLineKind::ConvoRequest: {
+    QString fromPilot = match.captured(2).trimmed();
+    QString eventText = QString("Convo from: %1").arg(fromPilot);
+
+    qDebug() << "ChatLogWorker: Conversation request for" << characterName
+             << "- From:" << fromPilot;
+    queueCombatEvent(characterName, "convo_request", eventText, lineTime);
+    return;
+  }
+
+  case LogLineKind::Unrecognized:
+    return;
   }
 }
 
 void ChatLogWorker::handleMiningEvent(const QString &characterName,
                                       const QString &ore) {
-  int timeoutMs = Config::instance().miningTimeoutSeconds() * 1000;
+  const int timeoutMs = m_miningTimeoutMs;
 
   qDebug() << "ChatLogWorker: Mining event detected for" << characterName
            << "- ore:" << ore << "- timeout:" << timeoutMs << "ms";
@@ -1460,69 +1310,195 @@ void ChatLogWorker::handleMiningEvent(const QString &characterName,
 void ChatLogWorker::onMiningTimeout(const QString &characterName) {
   if (m_miningActiveState.value(characterName, false)) {
     m_miningActiveState[characterName] = false;
-    emit combatEventDetected(characterName, "mining_stopped", "Mining stopped");
+    queueCombatEvent(characterName, "mining_stopped", "Mining stopped",
+                     QDateTime::currentMSecsSinceEpoch());
     qDebug() << "ChatLogWorker: Mining stopped for" << characterName
              << "(timeout)";
   }
+
+  flushEvents();
+}
+
+void ChatLogWorker::queueSystemChanged(const QString &characterName,
+                                       const QString &systemName,
+                                       qint64 timestamp) {
+  countEmittedEvent();
+
+  // Initial states and catch-up reads always go out with the batch flushed
+  // after the read, so the receiver can tell them from live events
+  if (!m_batchedDelivery && isLiveRead()) {
+    emit systemChanged(characterName, systemName, timestamp);
+    return;
+  }
+
+  const LogEvent event{LogEvent::SystemChange, characterName, QString(),
+                       systemName, timestamp, isLiveRead()};
+
+  // Only the latest system of a character matters to the receiver
+  auto pending = m_pendingSystemChanges.constFind(characterName);
+  if (pending != m_pendingSystemChanges.constEnd()) {
+    m_pendingEvents[*pending] = event;
+    return;
+  }
+
+  m_pendingSystemChanges.insert(characterName, m_pendingEvents.size());
+  m_pendingEvents.append(event);
 }
 
-void ChatLogWorker::updateCustomNameCache() {
-  m_cachedCustomNames = Config::instance().getAllCustomThumbnailNames();
-  qDebug() << "ChatLogWorker: Updated custom name cache with"
-           << m_cachedCustomNames.size() << "entries";
+void ChatLogWorker::countEmittedEvent() {
+  LogPipelineStats::add(m_stats.eventsEmitted, 1);
+  ++m_eventsEmitted;
 }
 
-void ChatLogWorker::onDirectoryChanged(const QString &path) {
-  qDebug() << "ChatLogWorker: Directory changed detected:" << path
-           << "- triggering immediate file scan";
+bool ChatLogWorker::isLiveRead() const {
+  return !m_readingInitialState && !m_readingCatchUp;
+}
 
-  // Immediately check for new files when directory changes
-  // This catches new character logins much faster than the 5-minute timer
-  checkForNewFiles();
+bool ChatLogWorker::isStale(qint64 timestamp) const {
+  return m_staleBefore > 0 && timestamp < m_staleBefore;
 }
 
-QString ChatLogWorker::extractSystemFromLine(const QString &logLine) {
-  static QRegularExpression pattern(
-      R"(Channel changed to Local\s*:\s*(.+))",
-      QRegularExpression::CaseInsensitiveOption |
-          QRegularExpression::UseUnicodePropertiesOption);
-  QRegularExpressionMatch match = pattern.match(logLine);
+QByteArrayView ChatLogWorker::pendingData(const LogFileState *state) {
+  return QByteArrayView(state->readBuffer).sliced(state->readOffset);
+}
+
+qint64 ChatLogWorker::newestLineTime(const LogFileState *state) const {
+  // Logs are written in time order, so the last line with a timestamp is
+  // the newest one of the read
+  const QByteArrayView unread = pendingData(state);
+  for (int i = m_candidateLines.size() - 1; i >= 0; --i) {
+    const QString line = decodeLogLine(
+        unread.sliced(m_candidateLines[i].start, m_candidateLines[i].length),
+        state->isChatLog);
+
+    const qint64 parsed = EveTimestamp::parseLine(line.trimmed());
+    if (parsed >= 0) {
+      return parsed;
+    }
+  }
+  return 0;
+}
 
-  if (match.hasMatch()) {
-    return sanitizeSystemName(match.captured(1).trimmed());
+void ChatLogWorker::queueCombatEvent(const QString &characterName,
+                                     const QString &eventType,
+                                     const QString &eventText,
+                                     qint64 timestamp) {
+  // Old lines read while catching up on a log must not show up as new alerts
+  if (isStale(timestamp)) {
+    LogPipelineStats::add(m_stats.eventsDroppedStale, 1);
+    return;
   }
 
-  return QString();
+  countEmittedEvent();
+
+  if (!m_batchedDelivery && isLiveRead()) {
+    emit combatEventDetected(characterName, eventType, eventText, timestamp);
+    return;
+  }
+
+  m_pendingEvents.append({LogEvent::CombatEvent, characterName, eventType,
+                          eventText, timestamp, isLiveRead()});
+}
+
+void ChatLogWorker::flushEvents() {
+  if (m_pendingEvents.isEmpty()) {
+    return;
+  }
+
+  LogEventBatch batch;
+  batch.swap(m_pendingEvents);
+  m_pendingSystemChanges.clear();
+  emit eventsBatched(batch);
 }
 
-QHash<QString, QString> ChatLogWorker::buildListenerToFileMap(
-    const QDir &dir, const QStringList &filters, int maxAgeHours) {
-  QHash<QString, QString> result;
+void ChatLogWorker::publishCombatStats() {
+  QMutexLocker locker(&m_mutex);
+
+  // The window moves on log time: the newest combat line plus the time
+  // since it was read, so rates still decay once the fight is over
+  const CombatDamageStatsList stats = m_damageTracker.takeStats(
+      m_damageTracker.newestTimestamp() + m_combatLogClock.elapsed());
 
-  if (!dir.exists()) {
-    return result;
+  // Idle characters were reported once at zero and dropped
+  if (m_damageTracker.isEmpty()) {
+    m_combatStatsTimer->stop();
   }
 
-  QFileInfoList files = dir.entryInfoList(filters, QDir::Files, QDir::Time);
+  if (!stats.isEmpty()) {
+    emit combatStatsUpdated(stats);
+  }
+}
+
+void ChatLogWorker::parseIntelLine(const QString &line,
+                                   const QString &channel, qint64 lineTime) {
+  // "[ 2024.01.01 12:00:00 ] Speaker > message"
+  const qsizetype separator = line.indexOf(QLatin1String(" > "));
+  if (separator < 0 || !m_systemMatcher) {
+    return;
+  }
 
-  for (const QFileInfo &fi : files) {
-    QDateTime lastModified = fi.lastModified();
-    qint64 hoursSinceModified =
-        lastModified.secsTo(QDateTime::currentDateTime()) / 3600;
-    if (hoursSinceModified > maxAgeHours) {
+  // Channel notices such as the MOTD are not reports
+  if (QStringView(line).left(separator).endsWith(QLatin1String("EVE System"))) {
+    return;
+  }
+
+  if (isStale(lineTime)) {
+    LogPipelineStats::add(m_stats.eventsDroppedStale, 1);
+    return;
+  }
+
+  const QString message = line.mid(separator + 3).trimmed();
+
+  m_intelMatches.clear();
+  m_systemMatcher->findAll(message, m_intelMatches);
+  if (m_intelMatches.isEmpty()) {
+    return;
+  }
+
+  LogPipelineStats::add(m_stats.linesParsed, 1);
+
+  QSet<int> reported;
+  for (const SolarSystemMatcher::Match &match : std::as_const(m_intelMatches)) {
+    if (reported.contains(match.systemIndex)) {
       continue;
     }
+    reported.insert(match.systemIndex);
 
-    QString character = extractCharacterFromLogFile(fi.absoluteFilePath());
-    if (!character.isEmpty()) {
-      QString key = character.toLower();
-      if (!result.contains(key)) {
-        result.insert(key, fi.absoluteFilePath());
-      }
-    }
+    const QString &systemName =
+        m_systemMatcher->systemNames().at(match.systemIndex);
+    qDebug() << "ChatLogWorker: Intel in" << channel << "for" << systemName
+             << ":" << message;
+
+    countEmittedEvent();
+    emit intelReported(channel, systemName, message, lineTime);
+  }
+}
+
+void ChatLogWorker::matchAlertRules(const QString &line,
+                                    const QString &characterName,
+                                    bool isChatLog, qint64 lineTime) {
+  // Rules see the line after its "[ timestamp ]" prefix
+  const qsizetype bracket = line.indexOf(']');
+  const int from = bracket < 0 ? 0 : int(bracket) + 1;
+
+  m_alertMatches.clear();
+  m_alertMatcher.match(line, isChatLog, m_alertMatches, from);
+  if (m_alertMatches.isEmpty()) {
+    return;
   }
 
-  return result;
+  LogPipelineStats::add(m_stats.linesParsed, 1);
+
+  static const QRegularExpression htmlTagPattern("<[^>]*>");
+  QString eventText = line.mid(from).trimmed();
+  eventText.remove(htmlTagPattern);
+
+  for (int ruleIndex : std::as_const(m_alertMatches)) {
+    const LogAlertRule &rule = m_alertMatcher.rules().at(ruleIndex);
+    qDebug() << "ChatLogWorker: Alert rule" << rule.name << "matched for"
+             << characterName << ":" << eventText;
+    queueCombatEvent(characterName, rule.eventType(), eventText, lineTime);
+  }
 }
 
 QString ChatLogWorker::sanitizeSystemName(const QString &system) {
@@ -1544,42 +1520,185 @@ QString ChatLogWorker::sanitizeSystemName(const QString &system) {
 }
 
 ChatLogReader::ChatLogReader(QObject *parent)
-    : QObject(parent), m_workerThread(new QThread(this)),
-      m_worker(new ChatLogWorker()), m_monitoring(false) {
-  m_worker->moveToThread(m_workerThread);
-
-  m_workerThread->setPriority(QThread::HighPriority);
-
-  connect(m_worker, &ChatLogWorker::systemChanged, this,
-          &ChatLogReader::handleSystemChanged, Qt::QueuedConnection);
-  connect(m_worker, &ChatLogWorker::combatEventDetected, this,
-          &ChatLogReader::combatEventDetected, Qt::QueuedConnection);
-  connect(m_worker, &ChatLogWorker::characterLoggedIn, this,
-          &ChatLogReader::characterLoggedIn, Qt::QueuedConnection);
-  connect(m_worker, &ChatLogWorker::characterLoggedOut, this,
-          &ChatLogReader::characterLoggedOut, Qt::QueuedConnection);
-
-  connect(m_workerThread, &QThread::started, m_worker,
-          &ChatLogWorker::startMonitoring);
+    : QObject(parent), m_enableChatLogMonitoring(true),
+      m_enableGameLogMonitoring(true), m_eventDrivenMonitoring(false),
+      m_batchedDelivery(true), m_combatDamageTracking(false),
+      m_maxEventAgeSeconds(0),
+      m_miningTimeoutSeconds(Config::DEFAULT_MINING_TIMEOUT_SECONDS),
+      m_monitoring(false), m_wakeupsInWindow(0), m_guiWakeupsPerSecond(0) {
+  qRegisterMetaType<LogEventBatch>();
+  qRegisterMetaType<CombatDamageStatsList>();
+  qRegisterMetaType<LogFileAssignment>();
+
+  m_statsDumpTimer = new QTimer(this);
+  connect(m_statsDumpTimer, &QTimer::timeout, this,
+          &ChatLogReader::dumpStats);
+  m_statsPool.setMaxThreadCount(1);
+
+  // One directory scan and header index for all shards
+  m_discoveryThread = new QThread(this);
+  m_discovery = new LogFileDiscovery();
+  m_discovery->moveToThread(m_discoveryThread);
+  connect(m_discovery, &LogFileDiscovery::logFilesChanged, this,
+          &ChatLogReader::handleLogFilesChanged, Qt::QueuedConnection);
+  connect(m_discoveryThread, &QThread::started, m_discovery,
+          &LogFileDiscovery::startMonitoring);
+
+  createShards(1);
 
   qDebug() << "ChatLogReader: Created";
 }
 
 ChatLogReader::~ChatLogReader() {
   stop();
-  if (!m_workerThread->wait(3000)) {
-    qWarning()
-        << "ChatLogReader: Worker thread did not stop in time, terminating";
-    m_workerThread->terminate();
-    m_workerThread->wait();
-  }
+  destroyShards();
 
-  delete m_worker;
-  m_worker = nullptr;
+  if (m_discoveryThread->isRunning()) {
+    QMetaObject::invokeMethod(m_discovery, "stopMonitoring",
+                              Qt::BlockingQueuedConnection);
+    m_discoveryThread->quit();
+    m_discoveryThread->wait();
+  }
+  delete m_discovery;
 
   qDebug() << "ChatLogReader: Destroyed";
 }
 
+void ChatLogReader::createShards(int count) {
+  m_shards.reserve(count);
+
+  for (int i = 0; i < count; ++i) {
+    Shard shard;
+    shard.thread = new QThread(this);
+    shard.worker = new ChatLogWorker(m_stats);
+    shard.worker->moveToThread(shard.thread);
+
+    shard.thread->setPriority(QThread::HighPriority);
+
+    connect(shard.worker, &ChatLogWorker::systemChanged, this,
+            &ChatLogReader::handleSystemChanged, Qt::QueuedConnection);
+    connect(shard.worker, &ChatLogWorker::combatEventDetected, this,
+            &ChatLogReader::handleCombatEventDetected, Qt::QueuedConnection);
+    connect(shard.worker, &ChatLogWorker::eventsBatched, this,
+            &ChatLogReader::handleEventsBatched, Qt::QueuedConnection);
+    connect(shard.worker, &ChatLogWorker::intelReported, this,
+            &ChatLogReader::intelReported, Qt::QueuedConnection);
+    connect(shard.worker, &ChatLogWorker::combatStatsUpdated, this,
+            &ChatLogReader::combatStatsUpdated, Qt::QueuedConnection);
+    connect(shard.worker, &ChatLogWorker::characterLoggedIn, this,
+            &ChatLogReader::characterLoggedIn, Qt::QueuedConnection);
+    connect(shard.worker, &ChatLogWorker::characterLoggedOut, this,
+            &ChatLogReader::characterLoggedOut, Qt::QueuedConnection);
+
+    connect(shard.thread, &QThread::started, shard.worker,
+            &ChatLogWorker::startMonitoring);
+
+    shard.worker->setEnableChatLogMonitoring(m_enableChatLogMonitoring);
+    shard.worker->setEnableGameLogMonitoring(m_enableGameLogMonitoring);
+    shard.worker->setEventDrivenMonitoring(m_eventDrivenMonitoring);
+    shard.worker->setBatchedDelivery(m_batchedDelivery);
+    shard.worker->setCombatDamageTracking(m_combatDamageTracking);
+    shard.worker->setLogAlertRules(m_logAlertRules);
+    shard.worker->setMaxEventAge(m_maxEventAgeSeconds);
+    shard.worker->setDataDirectory(m_dataDirectory);
+    shard.worker->setMiningTimeout(m_miningTimeoutSeconds);
+    shard.worker->setCustomNames(m_customNames);
+
+    m_shards.append(shard);
+  }
+
+  distributeCharacters();
+  distributeLogFiles();
+}
+
+void ChatLogReader::destroyShards() {
+  for (const Shard &shard : m_shards) {
+    if (shard.thread->isRunning()) {
+      // Timers and watchers must be stopped from the worker's own thread
+      QMetaObject::invokeMethod(shard.worker, "stopMonitoring",
+                                Qt::BlockingQueuedConnection);
+      shard.thread->quit();
+      if (!shard.thread->wait(3000)) {
+        qWarning()
+            << "ChatLogReader: Worker thread did not stop in time, terminating";
+        shard.thread->terminate();
+        shard.thread->wait();
+      }
+    }
+
+    delete shard.worker;
+    delete shard.thread;
+  }
+
+  m_shards.clear();
+}
+
+int ChatLogReader::shardFor(const QString &characterName) const {
+  // FNV-1a over the lowercased name, so a character always lands on the
+  // same worker regardless of qHash seeding
+  quint32 hash = 2166136261u;
+  const QString key = characterName.trimmed().toLower();
+  for (QChar c : key) {
+    hash = (hash ^ c.unicode()) * 16777619u;
+  }
+  return int(hash % quint32(m_shards.size()));
+}
+
+void ChatLogReader::distributeCharacters() {
+  QVector<QStringList> partitions(m_shards.size());
+  for (const QString &characterName : m_characterNames) {
+    partitions[shardFor(characterName)].append(characterName);
+  }
+
+  for (int i = 0; i < m_shards.size(); ++i) {
+    m_shards[i].worker->setCharacterNames(partitions[i]);
+  }
+}
+
+void ChatLogReader::distributeLogFiles() {
+  // Each worker gets the logs of the listeners that hash to it, so it never
+  // sees files of other shards; intel channels have no owner and go to the
+  // first worker
+  QVector<LogFileAssignment> partitions(m_shards.size());
+  for (auto it = m_logFileAssignment.chatLogs.constBegin();
+       it != m_logFileAssignment.chatLogs.constEnd(); ++it) {
+    partitions[shardFor(it.key())].chatLogs.insert(it.key(), it.value());
+  }
+  for (auto it = m_logFileAssignment.gameLogs.constBegin();
+       it != m_logFileAssignment.gameLogs.constEnd(); ++it) {
+    partitions[shardFor(it.key())].gameLogs.insert(it.key(), it.value());
+  }
+  partitions[0].intelLogs = m_logFileAssignment.intelLogs;
+
+  for (int i = 0; i < m_shards.size(); ++i) {
+    partitions[i].complete = m_logFileAssignment.complete;
+    QMetaObject::invokeMethod(m_shards[i].worker, "assignLogFiles",
+                              Qt::QueuedConnection,
+                              Q_ARG(LogFileAssignment, partitions[i]));
+  }
+}
+
+void ChatLogReader::setWorkerCount(int count) {
+  count = qMax(1, count);
+  if (count == m_shards.size()) {
+    return;
+  }
+
+  qDebug() << "ChatLogReader: Changing worker count from" << m_shards.size()
+           << "to" << count;
+
+  const bool wasMonitoring = m_monitoring;
+  stop();
+  destroyShards();
+  createShards(count);
+
+  if (wasMonitoring) {
+    start();
+  }
+}
+
+int ChatLogReader::workerCount() const { return m_shards.size(); }
+
 void ChatLogReader::setCharacterNames(const QStringList &characters) {
   QSet<QString> newSet;
   newSet.reserve(characters.size());
@@ -1594,44 +1713,137 @@ void ChatLogReader::setCharacterNames(const QStringList &characters) {
   }
 
   m_lastCharacterSet = newSet;
+  m_characterNames = characters;
 
-  m_worker->setCharacterNames(characters);
+  distributeCharacters();
 
-  if (m_monitoring && m_workerThread->isRunning()) {
-    QMetaObject::invokeMethod(m_worker, "checkForNewFiles",
+  // New characters may own logs that are already known; reassigning makes
+  // every worker attach and detach against its new character list
+  distributeLogFiles();
+
+  if (m_monitoring) {
+    QMetaObject::invokeMethod(m_discovery, "checkForNewFiles",
                               Qt::QueuedConnection);
   }
 }
 
 void ChatLogReader::setLogDirectory(const QString &directory) {
-  m_worker->setLogDirectory(directory);
+  m_logDirectory = directory;
+  m_discovery->setLogDirectory(directory);
   qDebug() << "ChatLogReader: Chatlog directory set to:" << directory;
 }
 
 void ChatLogReader::setGameLogDirectory(const QString &directory) {
-  m_worker->setGameLogDirectory(directory);
+  m_gameLogDirectory = directory;
+  m_discovery->setGameLogDirectory(directory);
   qDebug() << "ChatLogReader: Gamelog directory set to:" << directory;
 }
 
 void ChatLogReader::setEnableChatLogMonitoring(bool enabled) {
-  m_worker->setEnableChatLogMonitoring(enabled);
+  m_enableChatLogMonitoring = enabled;
+  m_discovery->setEnableChatLogMonitoring(enabled);
+  for (const Shard &shard : m_shards) {
+    shard.worker->setEnableChatLogMonitoring(enabled);
+  }
   qDebug() << "ChatLogReader: Chat log monitoring enabled:" << enabled;
 }
 
 void ChatLogReader::setEnableGameLogMonitoring(bool enabled) {
-  m_worker->setEnableGameLogMonitoring(enabled);
+  m_enableGameLogMonitoring = enabled;
+  m_discovery->setEnableGameLogMonitoring(enabled);
+  for (const Shard &shard : m_shards) {
+    shard.worker->setEnableGameLogMonitoring(enabled);
+  }
   qDebug() << "ChatLogReader: Game log monitoring enabled:" << enabled;
 }
 
+void ChatLogReader::setEventDrivenMonitoring(bool enabled) {
+  m_eventDrivenMonitoring = enabled;
+  for (const Shard &shard : m_shards) {
+    shard.worker->setEventDrivenMonitoring(enabled);
+  }
+  qDebug() << "ChatLogReader: Event-driven monitoring enabled:" << enabled;
+}
+
+void ChatLogReader::setBatchedDelivery(bool enabled) {
+  m_batchedDelivery = enabled;
+  for (const Shard &shard : m_shards) {
+    shard.worker->setBatchedDelivery(enabled);
+  }
+  qDebug() << "ChatLogReader: Batched event delivery enabled:" << enabled;
+}
+
+void ChatLogReader::setDataDirectory(const QString &directory) {
+  m_dataDirectory = directory;
+  m_discovery->setDataDirectory(directory);
+  for (const Shard &shard : m_shards) {
+    shard.worker->setDataDirectory(directory);
+  }
+}
+
+void ChatLogReader::setIntelChannels(const QStringList &channels) {
+  if (channels == m_intelChannels) {
+    return;
+  }
+
+  m_intelChannels = channels;
+  m_discovery->setIntelChannels(channels);
+  qDebug() << "ChatLogReader: Intel channels set to:" << channels;
+}
+
+void ChatLogReader::setCombatDamageTracking(bool enabled) {
+  m_combatDamageTracking = enabled;
+  for (const Shard &shard : m_shards) {
+    shard.worker->setCombatDamageTracking(enabled);
+  }
+  qDebug() << "ChatLogReader: Combat damage tracking enabled:" << enabled;
+}
+
+void ChatLogReader::setLogAlertRules(const QVector<LogAlertRule> &rules) {
+  m_logAlertRules = rules;
+  for (const Shard &shard : m_shards) {
+    shard.worker->setLogAlertRules(rules);
+  }
+  qDebug() << "ChatLogReader: Log alert rules set:" << rules.size();
+}
+
+void ChatLogReader::setMaxEventAge(int seconds) {
+  m_maxEventAgeSeconds = seconds;
+  for (const Shard &shard : m_shards) {
+    shard.worker->setMaxEventAge(seconds);
+  }
+  qDebug() << "ChatLogReader: Max event age set to" << seconds << "seconds";
+}
+
+void ChatLogReader::setMiningTimeout(int seconds) {
+  m_miningTimeoutSeconds = seconds;
+  for (const Shard &shard : m_shards) {
+    shard.worker->setMiningTimeout(seconds);
+  }
+}
+
+void ChatLogReader::setCustomNames(const QHash<QString, QString> &customNames) {
+  m_customNames = customNames;
+  for (const Shard &shard : m_shards) {
+    shard.worker->setCustomNames(customNames);
+  }
+}
+
 void ChatLogReader::refreshMonitoring() {
-  if (!m_monitoring || !m_workerThread->isRunning()) {
+  if (!m_monitoring) {
     qDebug() << "ChatLogReader: Cannot refresh - monitoring not active";
     return;
   }
 
   qDebug() << "ChatLogReader: Requesting monitoring refresh";
-  QMetaObject::invokeMethod(m_worker, "refreshMonitoring",
+  QMetaObject::invokeMethod(m_discovery, "refreshMonitoring",
                             Qt::QueuedConnection);
+  for (const Shard &shard : m_shards) {
+    if (shard.thread->isRunning()) {
+      QMetaObject::invokeMethod(shard.worker, "refreshMonitoring",
+                                Qt::QueuedConnection);
+    }
+  }
 }
 
 void ChatLogReader::start() {
@@ -1640,13 +1852,24 @@ void ChatLogReader::start() {
     return;
   }
 
-  qDebug() << "ChatLogReader: Starting monitoring";
+  qDebug() << "ChatLogReader: Starting monitoring with" << m_shards.size()
+           << "worker(s)";
   m_monitoring = true;
 
-  if (!m_workerThread->isRunning()) {
-    m_workerThread->start();
+  for (const Shard &shard : m_shards) {
+    if (!shard.thread->isRunning()) {
+      shard.thread->start();
+    } else {
+      QMetaObject::invokeMethod(shard.worker, "startMonitoring",
+                                Qt::QueuedConnection);
+    }
+  }
+
+  // Workers attach their files once discovery has scanned the directories
+  if (!m_discoveryThread->isRunning()) {
+    m_discoveryThread->start();
   } else {
-    QMetaObject::invokeMethod(m_worker, "startMonitoring",
+    QMetaObject::invokeMethod(m_discovery, "startMonitoring",
                               Qt::QueuedConnection);
   }
 
@@ -1661,8 +1884,16 @@ void ChatLogReader::stop() {
   qDebug() << "ChatLogReader: Stopping monitoring";
   m_monitoring = false;
 
-  if (m_workerThread->isRunning()) {
-    QMetaObject::invokeMethod(m_worker, "stopMonitoring", Qt::QueuedConnection);
+  if (m_discoveryThread->isRunning()) {
+    QMetaObject::invokeMethod(m_discovery, "stopMonitoring",
+                              Qt::QueuedConnection);
+  }
+
+  for (const Shard &shard : m_shards) {
+    if (shard.thread->isRunning()) {
+      QMetaObject::invokeMethod(shard.worker, "stopMonitoring",
+                                Qt::QueuedConnection);
+    }
   }
 
   emit monitoringStopped();
@@ -1676,12 +1907,151 @@ ChatLogReader::getSystemForCharacter(const QString &characterName) const {
 
 bool ChatLogReader::isMonitoring() const { return m_monitoring; }
 
+int ChatLogReader::guiWakeupsPerSecond() const {
+  return m_guiWakeupsPerSecond;
+}
+
+LogPipelineStatsSnapshot ChatLogReader::statsSnapshot() const {
+  return m_stats.snapshot();
+}
+
+void ChatLogReader::recordProfileSwitch(qint64 micros) {
+  m_stats.profileSwitch.record(micros);
+}
+
+void ChatLogReader::setStatsDumpInterval(int seconds) {
+  if (seconds <= 0) {
+    m_statsDumpTimer->stop();
+    return;
+  }
+
+  m_statsDumpTimer->start(seconds * 1000);
+}
+
+/// False if the stats file exists but was written with other columns
+static bool hasCurrentStatsHeader(const QString &filePath) {
+  QFile file(filePath);
+  if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+    return true;
+  }
+  return QString::fromUtf8(file.readLine()).trimmed() ==
+         LogPipelineStatsSnapshot::csvHeader();
+}
+
+void ChatLogReader::dumpStats() {
+  if (m_dataDirectory.isEmpty()) {
+    return;
+  }
+
+  // Only the snapshot is taken here; rotating and appending to the file
+  // happen on the stats thread
+  const QString basePath = m_dataDirectory + "/logstats";
+  const QString row = statsSnapshot().toCsvRow();
+  m_statsPool.start([basePath, row]() { writeStatsRow(basePath, row); });
+}
+
+void ChatLogReader::writeStatsRow(const QString &basePath,
+                                  const QString &row) {
+  const QString filePath = basePath + ".csv";
+
+  // Rotate: logstats.csv -> logstats.1.csv -> logstats.2.csv, also when a
+  // previous version wrote different columns
+  if (QFileInfo(filePath).size() > STATS_FILE_MAX_BYTES ||
+      !hasCurrentStatsHeader(filePath)) {
+    QFile::remove(QString("%1.%2.csv").arg(basePath).arg(STATS_FILE_KEEP));
+    for (int i = STATS_FILE_KEEP - 1; i >= 1; --i) {
+      QFile::rename(QString("%1.%2.csv").arg(basePath).arg(i),
+                    QString("%1.%2.csv").arg(basePath).arg(i + 1));
+    }
+    QFile::rename(filePath, basePath + ".1.csv");
+  }
+
+  QFile file(filePath);
+  const bool isNew = !file.exists();
+  if (!file.open(QIODevice::WriteOnly | QIODevice::Append |
+                 QIODevice::Text)) {
+    qWarning() << "ChatLogReader: Failed to write stats to" << filePath;
+    return;
+  }
+
+  QTextStream out(&file);
+  if (isNew) {
+    out << LogPipelineStatsSnapshot::csvHeader() << '\n';
+  }
+  out << row << '\n';
+}
+
+void ChatLogReader::recordGuiWakeup() {
+  if (!m_wakeupWindow.isValid()) {
+    m_wakeupWindow.start();
+  }
+
+  ++m_wakeupsInWindow;
+
+  const qint64 elapsed = m_wakeupWindow.elapsed();
+  if (elapsed >= 1000) {
+    m_guiWakeupsPerSecond = int(m_wakeupsInWindow * 1000 / elapsed);
+    qDebug() << "ChatLogReader: GUI thread wakeups per second:"
+             << m_guiWakeupsPerSecond
+             << (m_batchedDelivery ? "(batched)" : "(per event)");
+    m_wakeupsInWindow = 0;
+    m_wakeupWindow.restart();
+  }
+}
+
+void ChatLogReader::recordDeliveryDelay(qint64 timestamp) {
+  const qint64 delayMs = QDateTime::currentMSecsSinceEpoch() - timestamp;
+  m_stats.deliveryDelay.record(delayMs * 1000);
+}
+
 void ChatLogReader::handleSystemChanged(const QString &characterName,
-                                        const QString &systemName) {
+                                        const QString &systemName,
+                                        qint64 timestamp) {
+  recordGuiWakeup();
+  recordDeliveryDelay(timestamp);
+
   {
     QMutexLocker locker(&m_locationMutex);
     m_characterSystems[characterName] = systemName;
   }
 
-  emit systemChanged(characterName, systemName);
+  emit systemChanged(characterName, systemName, timestamp);
+}
+
+void ChatLogReader::handleCombatEventDetected(const QString &characterName,
+                                              const QString &eventType,
+                                              const QString &eventText,
+                                              qint64 timestamp) {
+  recordGuiWakeup();
+  recordDeliveryDelay(timestamp);
+
+  emit combatEventDetected(characterName, eventType, eventText, timestamp);
+}
+
+void ChatLogReader::handleEventsBatched(const LogEventBatch &events) {
+  recordGuiWakeup();
+
+  {
+    QMutexLocker locker(&m_locationMutex);
+    for (const LogEvent &event : events) {
+      // Initial states can be hours old and say nothing about the pipeline
+      if (event.live) {
+        recordDeliveryDelay(event.timestamp);
+      }
+      if (event.type == LogEvent::SystemChange) {
+        m_characterSystems[event.characterName] = event.text;
+      }
+    }
+  }
+
+  emit eventsBatched(events);
+}
+
+void ChatLogReader::handleLogFilesChanged(const LogFileAssignment &files) {
+  if (!m_monitoring) {
+    return;
+  }
+
+  m_logFileAssignment = files;
+  distributeLogFiles();
 }
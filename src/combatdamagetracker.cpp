@@ -0,0 +1,138 @@
+#include "combatdamagetracker.h"
+#include <QtAlgorithms>
+
+bool CombatDamageTracker::parseLine(QStringView line, CombatHit &hit) {
+  const qsizetype marker = line.indexOf(QLatin1String("(combat)"));
+  if (marker < 0) {
+    return false;
+  }
+
+  const qsizetype length = line.size();
+  qsizetype i = marker + 8;
+
+  // Formatting tags and spaces sit between every token of a combat line
+  auto skipMarkup = [&]() {
+    while (i < length) {
+      if (line[i] == QLatin1Char(' ')) {
+        ++i;
+      } else if (line[i] == QLatin1Char('<')) {
+        const qsizetype close = line.indexOf(QLatin1Char('>'), i);
+        i = close < 0 ? length : close + 1;
+      } else {
+        return;
+      }
+    }
+  };
+
+  auto wordAt = [&](QLatin1String word) {
+    return line.mid(i).startsWith(word) &&
+           (i + word.size() == length || !line[i + word.size()].isLetter());
+  };
+
+  skipMarkup();
+
+  qint64 damage = 0;
+  int digits = 0;
+  while (i < length && line[i] >= QLatin1Char('0') &&
+         line[i] <= QLatin1Char('9')) {
+    damage = damage * 10 + (line[i].unicode() - '0');
+    ++i;
+    if (++digits > 9) {
+      return false;
+    }
+  }
+  if (digits == 0) {
+    return false;
+  }
+
+  skipMarkup();
+
+  if (wordAt(QLatin1String("to"))) {
+    hit.outgoing = true;
+  } else if (wordAt(QLatin1String("from"))) {
+    hit.outgoing = false;
+  } else {
+    return false;
+  }
+
+  hit.damage = int(damage);
+  return true;
+}
+
+void CombatDamageTracker::Window::advance(qint64 second) {
+  if (second <= headSecond) {
+    return;
+  }
+
+  // Buckets that fall out of the window are reused for the new seconds
+  const qint64 steps = qMin<qint64>(second - headSecond, LONG_WINDOW_SECONDS);
+  for (qint64 step = 1; step <= steps; ++step) {
+    const int slot = int((headSecond + step) % LONG_WINDOW_SECONDS);
+    dealt[slot] = 0;
+    received[slot] = 0;
+  }
+
+  headSecond = second;
+}
+
+void CombatDamageTracker::record(const QString &characterName,
+                                 qint64 timestampMs, const CombatHit &hit) {
+  const qint64 second = timestampMs / 1000;
+  m_newestTimestampMs = qMax(m_newestTimestampMs, timestampMs);
+
+  Window &window = m_windows[characterName];
+  window.advance(second);
+  if (second <= window.headSecond - LONG_WINDOW_SECONDS) {
+    return;
+  }
+
+  const int slot = int(second % LONG_WINDOW_SECONDS);
+  if (hit.outgoing) {
+    window.dealt[slot] += quint32(hit.damage);
+  } else {
+    window.received[slot] += quint32(hit.damage);
+  }
+}
+
+CombatDamageStatsList CombatDamageTracker::takeStats(qint64 nowMs) {
+  CombatDamageStatsList result;
+  result.reserve(m_windows.size());
+
+  for (auto it = m_windows.begin(); it != m_windows.end();) {
+    Window &window = it.value();
+    window.advance(nowMs / 1000);
+
+    // A character's newest line may be ahead of nowMs by up to a second
+    const qint64 end = window.headSecond;
+
+    quint64 dealtShort = 0;
+    quint64 receivedShort = 0;
+    quint64 dealtLong = 0;
+    quint64 receivedLong = 0;
+    for (int age = 0; age < LONG_WINDOW_SECONDS; ++age) {
+      const int slot = int((end - age) % LONG_WINDOW_SECONDS);
+      dealtLong += window.dealt[slot];
+      receivedLong += window.received[slot];
+      if (age < SHORT_WINDOW_SECONDS) {
+        dealtShort += window.dealt[slot];
+        receivedShort += window.received[slot];
+      }
+    }
+
+    CombatDamageStats stats;
+    stats.characterName = it.key();
+    stats.dpsOutShort = double(dealtShort) / SHORT_WINDOW_SECONDS;
+    stats.dpsInShort = double(receivedShort) / SHORT_WINDOW_SECONDS;
+    stats.dpsOutLong = double(dealtLong) / LONG_WINDOW_SECONDS;
+    stats.dpsInLong = double(receivedLong) / LONG_WINDOW_SECONDS;
+    result.append(stats);
+
+    if (stats.isIdle()) {
+      it = m_windows.erase(it);
+    } else {
+      ++it;
+    }
+  }
+
+  return result;
+}
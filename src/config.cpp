@@ -1,5 +1,7 @@
 #include "config.h"
 #include "hotkeymanager.h"
+#include "profilepreloader.h"
+#include "settingswriter.h"
 #include <QCoreApplication>
 #include <QDebug>
 #include <QDir>
@@ -10,7 +12,7 @@
 #include <QRegularExpression>
 #include <QStandardPaths>
 
-Config::Config() {
+Config::Config() : m_preloader(std::make_unique<ProfilePreloader>()) {
   loadGlobalSettings();
 
   migrateToProfileSystem();
@@ -25,17 +27,20 @@ Config::Config() {
     profileToLoad = "default";
   }
 
-  QString profilePath = getProfileFilePath(profileToLoad);
-  m_settings = std::make_unique<QSettings>(profilePath, QSettings::IniFormat);
+  openProfileSettings(getProfileFilePath(profileToLoad));
   m_currentProfileName = profileToLoad;
 
-  if (!m_settings->contains(KEY_CONFIG_VERSION)) {
+  SettingsMap values = m_preloader->values(configFilePath());
+  if (!values.contains(KEY_CONFIG_VERSION)) {
     initializeDefaultProfile();
+    values = SettingsMap::read(configFilePath());
   }
 
-  loadCacheFromSettings();
+  loadCacheFromSettings(values);
 
   saveGlobalSettings();
+
+  preloadProfiles();
 }
 
 Config::~Config() { save(); }
@@ -79,274 +84,239 @@ Config &Config::instance() {
   return instance;
 }
 
-void Config::loadCacheFromSettings() {
+#define BOOL_ENTRY(getter, setter, name, key, defaultValue, inSnapshot)        \
+  {key, defaultValue, &Config::m_cached##name, inSnapshot},
+const Config::BoolSetting Config::BOOL_SETTINGS[] = {
+    CONFIG_BOOL_SETTINGS(BOOL_ENTRY)};
+#undef BOOL_ENTRY
+
+#define INT_ENTRY(getter, setter, name, key, defaultValue, minimum, maximum,   \
+                  inSnapshot)                                                  \
+  {key, defaultValue, &Config::m_cached##name, inSnapshot, minimum, maximum},
+const Config::IntSetting Config::INT_SETTINGS[] = {
+    CONFIG_INT_SETTINGS(INT_ENTRY)};
+#undef INT_ENTRY
+
+#define COLOR_ENTRY(getter, setter, name, key, defaultValue, inSnapshot)       \
+  {key, defaultValue, &Config::m_cached##name, inSnapshot},
+const Config::ColorSetting Config::COLOR_SETTINGS[] = {
+    CONFIG_COLOR_SETTINGS(COLOR_ENTRY)};
+#undef COLOR_ENTRY
+
+#define STYLE_ENTRY(getter, setter, name, key, defaultValue, inSnapshot)       \
+  {key, defaultValue, &Config::m_cached##name, inSnapshot},
+const Config::StyleSetting Config::STYLE_SETTINGS[] = {
+    CONFIG_STYLE_SETTINGS(STYLE_ENTRY)};
+#undef STYLE_ENTRY
+
+namespace {
+
+// Values of schema settings as the cache holds them
+bool boolValue(const char *key, bool defaultValue, const SettingsMap &values) {
+  return values.value(key, defaultValue).toBool();
+}
+
+int intValue(const char *key, int defaultValue, int minimum, int maximum,
+             const SettingsMap &values) {
+  return qBound(minimum, values.value(key, defaultValue).toInt(), maximum);
+}
+
+QColor colorValue(const char *key, const char *defaultValue,
+                  const SettingsMap &values) {
+  return QColor(values.value(key, defaultValue).toString());
+}
+
+} // namespace
+
+void Config::loadSchemaSettings(const SettingsMap &values) {
+  for (const BoolSetting &setting : BOOL_SETTINGS) {
+    this->*setting.cache = boolValue(setting.key, setting.defaultValue, values);
+  }
+  for (const IntSetting &setting : INT_SETTINGS) {
+    this->*setting.cache = intValue(setting.key, setting.defaultValue,
+                                    setting.minimum, setting.maximum, values);
+  }
+  for (const ColorSetting &setting : COLOR_SETTINGS) {
+    this->*setting.cache =
+        colorValue(setting.key, setting.defaultValue, values);
+  }
+  for (const StyleSetting &setting : STYLE_SETTINGS) {
+    this->*setting.cache = static_cast<BorderStyle>(intValue(
+        setting.key, setting.defaultValue, setting.minimum, setting.maximum,
+        values));
+  }
+}
+
+void Config::writeSchemaDefaults(QSettings &settings) {
+  for (const BoolSetting &setting : BOOL_SETTINGS) {
+    settings.setValue(setting.key, setting.defaultValue);
+  }
+  for (const IntSetting &setting : INT_SETTINGS) {
+    settings.setValue(setting.key, setting.defaultValue);
+  }
+  for (const ColorSetting &setting : COLOR_SETTINGS) {
+    settings.setValue(setting.key, setting.defaultValue);
+  }
+  for (const StyleSetting &setting : STYLE_SETTINGS) {
+    settings.setValue(setting.key, setting.defaultValue);
+  }
+}
+
+QStringList Config::changedSettings(const SettingsMap &values) const {
+  QStringList changed;
+  for (const BoolSetting &setting : BOOL_SETTINGS) {
+    if (boolValue(setting.key, setting.defaultValue, values) !=
+        this->*setting.cache) {
+      changed.append(setting.key);
+    }
+  }
+  for (const IntSetting &setting : INT_SETTINGS) {
+    if (intValue(setting.key, setting.defaultValue, setting.minimum,
+                 setting.maximum, values) != this->*setting.cache) {
+      changed.append(setting.key);
+    }
+  }
+  for (const ColorSetting &setting : COLOR_SETTINGS) {
+    if (colorValue(setting.key, setting.defaultValue, values) !=
+        this->*setting.cache) {
+      changed.append(setting.key);
+    }
+  }
+  for (const StyleSetting &setting : STYLE_SETTINGS) {
+    if (intValue(setting.key, setting.defaultValue, setting.minimum,
+                 setting.maximum, values) !=
+        static_cast<int>(this->*setting.cache)) {
+      changed.append(setting.key);
+    }
+  }
+  return changed;
+}
+
+void Config::setSetting(const BoolSetting &setting, bool value) {
+  writeValue(setting.key, value);
+  this->*setting.cache = value;
+  if (setting.inSnapshot) {
+    publishSnapshot();
+  }
+}
+
+void Config::setSetting(const IntSetting &setting, int value) {
+  value = qBound(setting.minimum, value, setting.maximum);
+  writeValue(setting.key, value);
+  this->*setting.cache = value;
+  if (setting.inSnapshot) {
+    publishSnapshot();
+  }
+}
+
+void Config::setSetting(const ColorSetting &setting, const QColor &color) {
+  writeValue(setting.key, color.name());
+  this->*setting.cache = color;
+  if (setting.inSnapshot) {
+    publishSnapshot();
+  }
+}
+
+void Config::setSetting(const StyleSetting &setting, BorderStyle style) {
+  const int value =
+      qBound(setting.minimum, static_cast<int>(style), setting.maximum);
+  writeValue(setting.key, value);
+  this->*setting.cache = static_cast<BorderStyle>(value);
+  if (setting.inSnapshot) {
+    publishSnapshot();
+  }
+}
+
+// Getters and setters of the schema settings
+#define BOOL_ACCESSORS(getter, setter, name, ...)                              \
+  bool Config::getter() const { return m_cached##name; }                       \
+  void Config::setter(bool value) {                                            \
+    setSetting(BOOL_SETTINGS[name##Setting], value);                           \
+  }
+#define INT_ACCESSORS(getter, setter, name, ...)                               \
+  int Config::getter() const { return m_cached##name; }                        \
+  void Config::setter(int value) {                                             \
+    setSetting(INT_SETTINGS[name##Setting], value);                            \
+  }
+#define COLOR_ACCESSORS(getter, setter, name, ...)                             \
+  QColor Config::getter() const { return m_cached##name; }                     \
+  void Config::setter(const QColor &color) {                                   \
+    setSetting(COLOR_SETTINGS[name##Setting], color);                          \
+  }
+#define STYLE_ACCESSORS(getter, setter, name, ...)                             \
+  BorderStyle Config::getter() const { return m_cached##name; }                \
+  void Config::setter(BorderStyle style) {                                     \
+    setSetting(STYLE_SETTINGS[name##Setting], style);                          \
+  }
+CONFIG_BOOL_SETTINGS(BOOL_ACCESSORS)
+CONFIG_INT_SETTINGS(INT_ACCESSORS)
+CONFIG_COLOR_SETTINGS(COLOR_ACCESSORS)
+CONFIG_STYLE_SETTINGS(STYLE_ACCESSORS)
+#undef BOOL_ACCESSORS
+#undef INT_ACCESSORS
+#undef COLOR_ACCESSORS
+#undef STYLE_ACCESSORS
+
+void Config::loadCacheFromSettings(const SettingsMap &values) {
   qDebug() << "Config::loadCacheFromSettings() - START";
 
-  m_cachedHighlightActive =
-      m_settings->value(KEY_UI_HIGHLIGHT_ACTIVE, DEFAULT_UI_HIGHLIGHT_ACTIVE)
-          .toBool();
-  m_cachedHideActiveThumbnail = m_settings
-                                    ->value(KEY_UI_HIDE_ACTIVE_THUMBNAIL,
-                                            DEFAULT_UI_HIDE_ACTIVE_THUMBNAIL)
-                                    .toBool();
-  m_cachedHideThumbnailsWhenEVENotFocused =
-      m_settings
-          ->value(KEY_UI_HIDE_THUMBNAILS_WHEN_EVE_NOT_FOCUSED,
-                  DEFAULT_UI_HIDE_THUMBNAILS_WHEN_EVE_NOT_FOCUSED)
-          .toBool();
-  m_cachedEveFocusDebounceInterval =
-      m_settings
-          ->value(KEY_UI_EVE_FOCUS_DEBOUNCE_INTERVAL,
-                  DEFAULT_EVE_FOCUS_DEBOUNCE_INTERVAL)
-          .toInt();
-  m_cachedHighlightColor = QColor(
-      m_settings->value(KEY_UI_HIGHLIGHT_COLOR, DEFAULT_UI_HIGHLIGHT_COLOR)
-          .toString());
-  m_cachedHighlightBorderWidth = m_settings
-                                     ->value(KEY_UI_HIGHLIGHT_BORDER_WIDTH,
-                                             DEFAULT_UI_HIGHLIGHT_BORDER_WIDTH)
-                                     .toInt();
-  m_cachedActiveBorderStyle = static_cast<BorderStyle>(
-      m_settings->value(KEY_UI_ACTIVE_BORDER_STYLE, DEFAULT_ACTIVE_BORDER_STYLE)
-          .toInt());
-
-  m_cachedShowInactiveBorders = m_settings
-                                    ->value(KEY_UI_SHOW_INACTIVE_BORDERS,
-                                            DEFAULT_UI_SHOW_INACTIVE_BORDERS)
-                                    .toBool();
-  m_cachedInactiveBorderColor =
-      QColor(m_settings
-                 ->value(KEY_UI_INACTIVE_BORDER_COLOR,
-                         DEFAULT_UI_INACTIVE_BORDER_COLOR)
-                 .toString());
-  m_cachedInactiveBorderWidth = m_settings
-                                    ->value(KEY_UI_INACTIVE_BORDER_WIDTH,
-                                            DEFAULT_UI_INACTIVE_BORDER_WIDTH)
-                                    .toInt();
-  m_cachedInactiveBorderStyle = static_cast<BorderStyle>(
-      m_settings
-          ->value(KEY_UI_INACTIVE_BORDER_STYLE, DEFAULT_INACTIVE_BORDER_STYLE)
-          .toInt());
-
-  m_cachedThumbnailWidth =
-      m_settings->value(KEY_THUMBNAIL_WIDTH, DEFAULT_THUMBNAIL_WIDTH).toInt();
-  m_cachedThumbnailHeight =
-      m_settings->value(KEY_THUMBNAIL_HEIGHT, DEFAULT_THUMBNAIL_HEIGHT).toInt();
-  m_cachedThumbnailOpacity =
-      qBound(OPACITY_MIN,
-             m_settings->value(KEY_THUMBNAIL_OPACITY, DEFAULT_THUMBNAIL_OPACITY)
-                 .toInt(),
-             OPACITY_MAX);
-
-  m_cachedShowNotLoggedIn = m_settings
-                                ->value(KEY_THUMBNAIL_SHOW_NOT_LOGGED_IN,
-                                        DEFAULT_THUMBNAIL_SHOW_NOT_LOGGED_IN)
-                                .toBool();
-  m_cachedNotLoggedInStackMode =
-      m_settings
-          ->value(KEY_THUMBNAIL_NOT_LOGGED_IN_STACK_MODE,
-                  DEFAULT_THUMBNAIL_NOT_LOGGED_IN_STACK_MODE)
-          .toInt();
+  m_values = values;
+
+  loadSchemaSettings(values);
+  qDebug() << "Config::loadCacheFromSettings() - Loaded "
+              "enableGameLogMonitoring from disk:"
+           << m_cachedEnableGameLogMonitoring;
+
   m_cachedNotLoggedInReferencePosition =
-      m_settings
-          ->value(KEY_THUMBNAIL_NOT_LOGGED_IN_REF_POSITION,
+      values.value(KEY_THUMBNAIL_NOT_LOGGED_IN_REF_POSITION,
                   QPoint(DEFAULT_THUMBNAIL_NOT_LOGGED_IN_REF_X,
                          DEFAULT_THUMBNAIL_NOT_LOGGED_IN_REF_Y))
           .toPoint();
-  m_cachedShowNotLoggedInOverlay =
-      m_settings
-          ->value(KEY_THUMBNAIL_SHOW_NOT_LOGGED_IN_OVERLAY,
-                  DEFAULT_THUMBNAIL_SHOW_NOT_LOGGED_IN_OVERLAY)
-          .toBool();
-  m_cachedShowNonEVEOverlay =
-      m_settings
-          ->value(KEY_THUMBNAIL_SHOW_NON_EVE_OVERLAY,
-                  DEFAULT_THUMBNAIL_SHOW_NON_EVE_OVERLAY)
-          .toBool();
 
   QStringList defaultProcessNames;
   defaultProcessNames << DEFAULT_THUMBNAIL_PROCESS_NAME;
   m_cachedProcessNames =
-      m_settings->value(KEY_THUMBNAIL_PROCESS_NAMES, defaultProcessNames)
+      values.value(KEY_THUMBNAIL_PROCESS_NAMES, defaultProcessNames)
           .toStringList();
 
-  m_cachedAlwaysOnTop =
-      m_settings->value(KEY_WINDOW_ALWAYS_ON_TOP, DEFAULT_WINDOW_ALWAYS_ON_TOP)
-          .toBool();
-  m_cachedSwitchOnMouseDown = m_settings
-                                  ->value(KEY_WINDOW_SWITCH_ON_MOUSE_DOWN,
-                                          DEFAULT_WINDOW_SWITCH_ON_MOUSE_DOWN)
-                                  .toBool();
-  m_cachedDragWithRightClick = m_settings
-                                   ->value(KEY_WINDOW_DRAG_WITH_RIGHT_CLICK,
-                                           DEFAULT_WINDOW_DRAG_WITH_RIGHT_CLICK)
-                                   .toBool();
-  m_cachedMinimizeInactive = m_settings
-                                 ->value(KEY_WINDOW_MINIMIZE_INACTIVE,
-                                         DEFAULT_WINDOW_MINIMIZE_INACTIVE)
-                                 .toBool();
-  m_cachedMinimizeDelay =
-      m_settings
-          ->value(KEY_WINDOW_MINIMIZE_DELAY, DEFAULT_WINDOW_MINIMIZE_DELAY)
-          .toInt();
   m_cachedNeverMinimizeCharacters =
-      m_settings->value(KEY_WINDOW_NEVER_MINIMIZE_CHARACTERS, QStringList())
+      values.value(KEY_WINDOW_NEVER_MINIMIZE_CHARACTERS, QStringList())
           .toStringList();
   m_cachedNeverCloseCharacters =
-      m_settings->value(KEY_WINDOW_NEVER_CLOSE_CHARACTERS, QStringList())
+      values.value(KEY_WINDOW_NEVER_CLOSE_CHARACTERS, QStringList())
           .toStringList();
   m_cachedHiddenCharacters =
-      m_settings->value(KEY_THUMBNAIL_HIDDEN_CHARACTERS, QStringList())
+      values.value(KEY_THUMBNAIL_HIDDEN_CHARACTERS, QStringList())
           .toStringList();
-  m_cachedSaveClientLocation = m_settings
-                                   ->value(KEY_WINDOW_SAVE_CLIENT_LOCATION,
-                                           DEFAULT_WINDOW_SAVE_CLIENT_LOCATION)
-                                   .toBool();
-
-  m_cachedRememberPositions =
-      m_settings->value(KEY_POSITION_REMEMBER, DEFAULT_POSITION_REMEMBER)
-          .toBool();
-  m_cachedPreserveLogoutPositions =
-      m_settings
-          ->value(KEY_POSITION_PRESERVE_LOGOUT,
-                  DEFAULT_POSITION_PRESERVE_LOGOUT)
-          .toBool();
-  m_cachedEnableSnapping = m_settings
-                               ->value(KEY_POSITION_ENABLE_SNAPPING,
-                                       DEFAULT_POSITION_ENABLE_SNAPPING)
-                               .toBool();
-  m_cachedSnapDistance =
-      m_settings
-          ->value(KEY_POSITION_SNAP_DISTANCE, DEFAULT_POSITION_SNAP_DISTANCE)
-          .toInt();
-  m_cachedLockPositions =
-      m_settings->value(KEY_POSITION_LOCK, DEFAULT_POSITION_LOCK).toBool();
-
-  m_cachedWildcardHotkeys =
-      m_settings->value(KEY_HOTKEY_WILDCARD, DEFAULT_HOTKEY_WILDCARD).toBool();
-  m_cachedHotkeysOnlyWhenEVEFocused =
-      m_settings
-          ->value(KEY_HOTKEY_ONLY_WHEN_EVE_FOCUSED,
-                  DEFAULT_HOTKEY_ONLY_WHEN_EVE_FOCUSED)
-          .toBool();
-  m_cachedResetGroupIndexOnNonGroupFocus =
-      m_settings
-          ->value(KEY_HOTKEY_RESET_GROUP_INDEX_ON_NON_GROUP_FOCUS,
-                  DEFAULT_HOTKEY_RESET_GROUP_INDEX_ON_NON_GROUP_FOCUS)
-          .toBool();
-
-  m_cachedShowCharacterName =
-      m_settings
-          ->value(KEY_OVERLAY_SHOW_CHARACTER, DEFAULT_OVERLAY_SHOW_CHARACTER)
-          .toBool();
-  m_cachedCharacterNameColor = QColor(
-      m_settings
-          ->value(KEY_OVERLAY_CHARACTER_COLOR, DEFAULT_OVERLAY_CHARACTER_COLOR)
-          .toString());
-  m_cachedCharacterNamePosition =
-      m_settings
-          ->value(KEY_OVERLAY_CHARACTER_POSITION,
-                  DEFAULT_OVERLAY_CHARACTER_POSITION)
-          .toInt();
+
   QFont defaultCharFont(DEFAULT_OVERLAY_FONT_FAMILY, DEFAULT_OVERLAY_FONT_SIZE);
   m_cachedCharacterNameFont.fromString(
-      m_settings->value(KEY_OVERLAY_CHARACTER_FONT, defaultCharFont.toString())
+      values.value(KEY_OVERLAY_CHARACTER_FONT, defaultCharFont.toString())
           .toString());
-  m_cachedCharacterNameOffsetX =
-      m_settings
-          ->value(KEY_OVERLAY_CHARACTER_OFFSET_X, DEFAULT_OVERLAY_OFFSET_X)
-          .toInt();
-  m_cachedCharacterNameOffsetY =
-      m_settings
-          ->value(KEY_OVERLAY_CHARACTER_OFFSET_Y, DEFAULT_OVERLAY_OFFSET_Y)
-          .toInt();
-
-  m_cachedShowSystemName =
-      m_settings->value(KEY_OVERLAY_SHOW_SYSTEM, DEFAULT_OVERLAY_SHOW_SYSTEM)
-          .toBool();
-  m_cachedUniqueSystemNameColors =
-      m_settings
-          ->value(KEY_OVERLAY_UNIQUE_SYSTEM_COLORS,
-                  DEFAULT_OVERLAY_UNIQUE_SYSTEM_COLORS)
-          .toBool();
-  m_cachedSystemNameColor = QColor(
-      m_settings->value(KEY_OVERLAY_SYSTEM_COLOR, DEFAULT_OVERLAY_SYSTEM_COLOR)
-          .toString());
-  m_cachedSystemNamePosition =
-      m_settings
-          ->value(KEY_OVERLAY_SYSTEM_POSITION, DEFAULT_OVERLAY_SYSTEM_POSITION)
-          .toInt();
+
   QFont defaultSysFont(DEFAULT_OVERLAY_FONT_FAMILY, DEFAULT_OVERLAY_FONT_SIZE);
   m_cachedSystemNameFont.fromString(
-      m_settings->value(KEY_OVERLAY_SYSTEM_FONT, defaultSysFont.toString())
+      values.value(KEY_OVERLAY_SYSTEM_FONT, defaultSysFont.toString())
           .toString());
-  m_cachedSystemNameOffsetX =
-      m_settings->value(KEY_OVERLAY_SYSTEM_OFFSET_X, DEFAULT_OVERLAY_OFFSET_X)
-          .toInt();
-  m_cachedSystemNameOffsetY =
-      m_settings->value(KEY_OVERLAY_SYSTEM_OFFSET_Y, DEFAULT_OVERLAY_OFFSET_Y)
-          .toInt();
-
-  m_cachedShowOverlayBackground =
-      m_settings
-          ->value(KEY_OVERLAY_SHOW_BACKGROUND, DEFAULT_OVERLAY_SHOW_BACKGROUND)
-          .toBool();
-  m_cachedOverlayBackgroundColor =
-      QColor(m_settings
-                 ->value(KEY_OVERLAY_BACKGROUND_COLOR,
-                         DEFAULT_OVERLAY_BACKGROUND_COLOR)
-                 .toString());
-  m_cachedOverlayBackgroundOpacity =
-      qBound(OPACITY_MIN,
-             m_settings
-                 ->value(KEY_OVERLAY_BACKGROUND_OPACITY,
-                         DEFAULT_OVERLAY_BACKGROUND_OPACITY)
-                 .toInt(),
-             OPACITY_MAX);
 
   QFont defaultFont(DEFAULT_OVERLAY_FONT_FAMILY, DEFAULT_OVERLAY_FONT_SIZE);
   m_cachedOverlayFont.fromString(
-      m_settings->value(KEY_OVERLAY_FONT, defaultFont.toString()).toString());
+      values.value(KEY_OVERLAY_FONT, defaultFont.toString()).toString());
 
-  m_cachedEnableChatLogMonitoring =
-      m_settings
-          ->value(KEY_CHATLOG_ENABLE_MONITORING,
-                  DEFAULT_CHATLOG_ENABLE_MONITORING)
-          .toBool();
   m_cachedChatLogDirectory =
-      m_settings->value(KEY_CHATLOG_DIRECTORY, getDefaultChatLogDirectory())
+      values.value(KEY_CHATLOG_DIRECTORY, getDefaultChatLogDirectory())
           .toString();
-  m_cachedEnableGameLogMonitoring =
-      m_settings
-          ->value(KEY_GAMELOG_ENABLE_MONITORING,
-                  DEFAULT_GAMELOG_ENABLE_MONITORING)
-          .toBool();
-  qDebug() << "Config::loadCacheFromSettings() - Loaded "
-              "enableGameLogMonitoring from disk:"
-           << m_cachedEnableGameLogMonitoring;
   m_cachedGameLogDirectory =
-      m_settings->value(KEY_GAMELOG_DIRECTORY, getDefaultGameLogDirectory())
+      values.value(KEY_GAMELOG_DIRECTORY, getDefaultGameLogDirectory())
           .toString();
+  m_cachedIntelChannels =
+      values.value(KEY_LOG_INTEL_CHANNELS, QStringList()).toStringList();
 
-  m_cachedShowCombatMessages =
-      m_settings->value(KEY_COMBAT_ENABLED, DEFAULT_COMBAT_MESSAGES_ENABLED)
-          .toBool();
-  m_cachedCombatMessagePosition =
-      m_settings->value(KEY_COMBAT_POSITION, DEFAULT_COMBAT_MESSAGE_POSITION)
-          .toInt();
   QFont defaultCombatFont(DEFAULT_OVERLAY_FONT_FAMILY,
                           DEFAULT_OVERLAY_FONT_SIZE);
   defaultCombatFont.setBold(true);
   m_cachedCombatMessageFont =
-      m_settings->value(KEY_COMBAT_FONT, defaultCombatFont).value<QFont>();
-  m_cachedCombatMessageOffsetX =
-      m_settings->value(KEY_COMBAT_OFFSET_X, DEFAULT_OVERLAY_OFFSET_X).toInt();
-  m_cachedCombatMessageOffsetY =
-      m_settings->value(KEY_COMBAT_OFFSET_Y, DEFAULT_OVERLAY_OFFSET_Y).toInt();
-  m_cachedSuppressCombatWhenFocused =
-      m_settings
-          ->value(KEY_COMBAT_SUPPRESS_FOCUSED, DEFAULT_COMBAT_SUPPRESS_FOCUSED)
-          .toBool();
+      values.value(KEY_COMBAT_FONT, defaultCombatFont).value<QFont>();
 
   m_cachedCombatEventColors.clear();
   m_cachedCombatEventDurations.clear();
@@ -358,272 +328,199 @@ void Config::loadCacheFromSettings() {
     QString defaultColor =
         DEFAULT_EVENT_COLORS().value(eventType, DEFAULT_COMBAT_MESSAGE_COLOR);
     m_cachedCombatEventColors[eventType] =
-        m_settings->value(colorKey, QColor(defaultColor)).value<QColor>();
+        values.value(colorKey, QColor(defaultColor)).value<QColor>();
 
     QString durationKey = combatEventDurationKey(eventType);
     m_cachedCombatEventDurations[eventType] =
-        m_settings->value(durationKey, DEFAULT_COMBAT_MESSAGE_DURATION).toInt();
+        values.value(durationKey, DEFAULT_COMBAT_MESSAGE_DURATION).toInt();
 
     QString borderKey = combatEventBorderHighlightKey(eventType);
     m_cachedCombatEventBorderHighlights[eventType] =
-        m_settings->value(borderKey, DEFAULT_COMBAT_EVENT_BORDER_HIGHLIGHT)
+        values.value(borderKey, DEFAULT_COMBAT_EVENT_BORDER_HIGHLIGHT)
             .toBool();
 
     QString styleKey = combatBorderStyleKey(eventType);
     m_cachedCombatBorderStyles[eventType] = static_cast<BorderStyle>(
-        m_settings->value(styleKey, DEFAULT_COMBAT_BORDER_STYLE).toInt());
+        qBound(BORDER_STYLE_MIN,
+               values.value(styleKey, DEFAULT_COMBAT_BORDER_STYLE).toInt(),
+               BORDER_STYLE_MAX));
 
     QString soundEnabledKey = combatEventSoundEnabledKey(eventType);
     m_cachedCombatEventSoundsEnabled[eventType] =
-        m_settings->value(soundEnabledKey, DEFAULT_COMBAT_SOUND_ENABLED)
+        values.value(soundEnabledKey, DEFAULT_COMBAT_SOUND_ENABLED)
             .toBool();
 
     QString soundFileKey = combatEventSoundFileKey(eventType);
     m_cachedCombatEventSoundFiles[eventType] =
-        m_settings->value(soundFileKey, QString()).toString();
+        values.value(soundFileKey, QString()).toString();
 
     QString soundVolumeKey = combatEventSoundVolumeKey(eventType);
     m_cachedCombatEventSoundVolumes[eventType] =
-        m_settings->value(soundVolumeKey, DEFAULT_COMBAT_SOUND_VOLUME).toInt();
+        values.value(soundVolumeKey, DEFAULT_COMBAT_SOUND_VOLUME).toInt();
   }
 
   m_cachedEnabledCombatEventTypes =
-      m_settings
-          ->value(KEY_COMBAT_ENABLED_EVENT_TYPES,
+      values.value(KEY_COMBAT_ENABLED_EVENT_TYPES,
                   DEFAULT_COMBAT_MESSAGE_EVENT_TYPES())
           .toStringList();
-  m_cachedMiningTimeoutSeconds =
-      m_settings
-          ->value(KEY_MINING_TIMEOUT_SECONDS, DEFAULT_MINING_TIMEOUT_SECONDS)
-          .toInt();
-
-  m_cachedCharacterBorderColors.clear();
-  m_settings->beginGroup("characterBorderColors");
-  QStringList characterNames = m_settings->childKeys();
-  for (const QString &characterName : characterNames) {
-    QColor color = m_settings->value(characterName).value<QColor>();
+
+  // Ids handed out earlier must stay valid, so records are reset rather
+  // than removed
+  for (CharacterRecord &record : m_characters) {
+    const QString name = record.name;
+    record = CharacterRecord();
+    record.name = name;
+  }
+
+  for (const QString &characterName :
+       values.childKeys("characterBorderColors")) {
+    QColor color =
+        values.value("characterBorderColors/" + characterName).value<QColor>();
     if (color.isValid()) {
-      m_cachedCharacterBorderColors[characterName] = color;
+      characterForUpdate(characterName).borderColor = color;
     }
   }
-  m_settings->endGroup();
 
-  m_cachedCharacterInactiveBorderColors.clear();
-  m_settings->beginGroup("characterInactiveBorderColors");
-  QStringList inactiveCharacterNames = m_settings->childKeys();
-  for (const QString &characterName : inactiveCharacterNames) {
-    QColor color = m_settings->value(characterName).value<QColor>();
+  for (const QString &characterName :
+       values.childKeys("characterInactiveBorderColors")) {
+    QColor color =
+        values.value("characterInactiveBorderColors/" + characterName)
+            .value<QColor>();
     if (color.isValid()) {
-      m_cachedCharacterInactiveBorderColors[characterName] = color;
+      characterForUpdate(characterName).inactiveBorderColor = color;
     }
   }
-  m_settings->endGroup();
 
   m_cachedSystemNameColors.clear();
-  m_settings->beginGroup("systemNameColors");
-  QStringList systemNames = m_settings->childKeys();
-  for (const QString &systemName : systemNames) {
-    QColor color = m_settings->value(systemName).value<QColor>();
+  for (const QString &systemName : values.childKeys("systemNameColors")) {
+    QColor color =
+        values.value("systemNameColors/" + systemName).value<QColor>();
     if (color.isValid()) {
       m_cachedSystemNameColors[systemName] = color;
     }
   }
-  m_settings->endGroup();
 
-  m_cachedThumbnailPositions.clear();
-  m_settings->beginGroup("thumbnailPositions");
-  QStringList thumbnailCharNames = m_settings->childKeys();
-  for (const QString &characterName : thumbnailCharNames) {
-    QPoint pos = m_settings->value(characterName).toPoint();
+  m_cachedLogAlertRules.clear();
+  m_cachedLogAlertColors.clear();
+  const int alertRuleCount =
+      values.value(QString("%1/size").arg(KEY_LOG_ALERT_RULES)).toInt();
+  for (int i = 1; i <= alertRuleCount; ++i) {
+    const QString prefix = QString("%1/%2/").arg(KEY_LOG_ALERT_RULES).arg(i);
+
+    LogAlertRule rule;
+    rule.name = values.value(prefix + "name").toString();
+    rule.pattern = values.value(prefix + "pattern").toString();
+    rule.isRegex = values.value(prefix + "regex", false).toBool();
+    const QString channel = values.value(prefix + "channel").toString();
+    rule.channel = channel == "chat"   ? LogAlertRule::ChatLog
+                   : channel == "game" ? LogAlertRule::GameLog
+                                       : LogAlertRule::AnyLog;
+    rule.color = values.value(prefix + "color").value<QColor>();
+    rule.enabled = values.value(prefix + "enabled", true).toBool();
+
+    if (rule.name.isEmpty() || rule.pattern.isEmpty()) {
+      continue;
+    }
+    m_cachedLogAlertRules.append(rule);
+    if (rule.color.isValid()) {
+      m_cachedLogAlertColors[rule.eventType()] = rule.color;
+    }
+  }
+
+  for (const QString &characterName : values.childKeys("thumbnailPositions")) {
+    const QString key = "thumbnailPositions/" + characterName;
+    QPoint pos = values.value(key).toPoint();
     // Skip invalid positions (issue #27)
     // Windows uses (-32000, -32000) for minimized windows
     if (pos.x() == -32000 && pos.y() == -32000) {
       qDebug() << "Removing invalid thumbnail position for" << characterName;
-      m_settings->remove(characterName);
+      removeValue(key);
       continue;
     }
-    m_cachedThumbnailPositions[characterName] = pos;
+    characterForUpdate(characterName).thumbnailPosition = pos;
   }
-  m_settings->endGroup();
 
-  m_cachedThumbnailSizes.clear();
-  m_settings->beginGroup("thumbnailSizes");
-  QStringList sizeCharNames = m_settings->childKeys();
-  for (const QString &characterName : sizeCharNames) {
-    QSize size = m_settings->value(characterName).toSize();
+  for (const QString &characterName : values.childKeys("thumbnailSizes")) {
+    QSize size = values.value("thumbnailSizes/" + characterName).toSize();
     if (size.isValid()) {
-      m_cachedThumbnailSizes[characterName] = size;
+      characterForUpdate(characterName).thumbnailSize = size;
     }
   }
-  m_settings->endGroup();
 
   m_cachedProcessThumbnailSizes.clear();
-  m_settings->beginGroup("processThumbnailSizes");
-  QStringList processNames = m_settings->childKeys();
-  for (const QString &processName : processNames) {
-    QSize size = m_settings->value(processName).toSize();
+  for (const QString &processName : values.childKeys("processThumbnailSizes")) {
+    QSize size = values.value("processThumbnailSizes/" + processName).toSize();
     if (size.isValid()) {
       m_cachedProcessThumbnailSizes[processName] = size;
     }
   }
-  m_settings->endGroup();
 
-  m_cachedCustomThumbnailNames.clear();
-  m_settings->beginGroup("thumbnailCustomNames");
-  QStringList customNameCharNames = m_settings->childKeys();
-  for (const QString &characterName : customNameCharNames) {
-    QString customName = m_settings->value(characterName).toString();
+  for (const QString &characterName :
+       values.childKeys("thumbnailCustomNames")) {
+    QString customName =
+        values.value("thumbnailCustomNames/" + characterName).toString();
     if (!customName.isEmpty()) {
-      m_cachedCustomThumbnailNames[characterName] = customName;
+      characterForUpdate(characterName).customName = customName;
     }
   }
-  m_settings->endGroup();
 
-  m_cachedClientWindowRects.clear();
-  m_settings->beginGroup("clientWindowRects");
-  QStringList clientCharNames = m_settings->childKeys();
-  for (const QString &characterName : clientCharNames) {
-    QRect rect = m_settings->value(characterName).toRect();
+  for (const QString &characterName : values.childKeys("clientWindowRects")) {
+    const QString key = "clientWindowRects/" + characterName;
+    QRect rect = values.value(key).toRect();
     qDebug() << "Loading client window rect for" << characterName << ":" << rect
              << "isValid:" << rect.isValid() << "isEmpty:" << rect.isEmpty();
     // Check for invalid minimized window coordinates (issue #27)
     if (rect.x() == -32000 && rect.y() == -32000) {
       qDebug() << "  -> Removing invalid minimized window coordinates";
-      m_settings->remove(characterName);
+      removeValue(key);
       continue;
     }
     if (rect.isValid()) {
-      m_cachedClientWindowRects[characterName] = rect;
+      characterForUpdate(characterName).clientWindowRect = rect;
       qDebug() << "  -> Cached successfully";
     } else {
       qDebug() << "  -> Rejected (invalid)";
     }
   }
-  m_settings->endGroup();
-}
 
-bool Config::highlightActiveWindow() const { return m_cachedHighlightActive; }
+  // Read on first use from m_values
+  m_cachedCombatEventSuppressFocused.clear();
 
-void Config::setHighlightActiveWindow(bool enabled) {
-  m_settings->setValue(KEY_UI_HIGHLIGHT_ACTIVE, enabled);
-  m_cachedHighlightActive = enabled;
+  publishSnapshot();
 }
 
-bool Config::hideActiveClientThumbnail() const {
-  return m_cachedHideActiveThumbnail;
-}
+void Config::publishSnapshot() {
+  auto snapshot = std::make_shared<ConfigSnapshot>();
 
-void Config::setHideActiveClientThumbnail(bool enabled) {
-  m_settings->setValue(KEY_UI_HIDE_ACTIVE_THUMBNAIL, enabled);
-  m_cachedHideActiveThumbnail = enabled;
-}
-
-bool Config::hideThumbnailsWhenEVENotFocused() const {
-  return m_cachedHideThumbnailsWhenEVENotFocused;
-}
-
-void Config::setHideThumbnailsWhenEVENotFocused(bool enabled) {
-  m_settings->setValue(KEY_UI_HIDE_THUMBNAILS_WHEN_EVE_NOT_FOCUSED, enabled);
-  m_cachedHideThumbnailsWhenEVENotFocused = enabled;
-}
-
-int Config::eveFocusDebounceInterval() const {
-  return m_cachedEveFocusDebounceInterval;
-}
-
-QColor Config::highlightColor() const { return m_cachedHighlightColor; }
-
-void Config::setHighlightColor(const QColor &color) {
-  m_settings->setValue(KEY_UI_HIGHLIGHT_COLOR, color.name());
-  m_cachedHighlightColor = color;
-}
-
-int Config::highlightBorderWidth() const {
-  return m_cachedHighlightBorderWidth;
-}
-
-void Config::setHighlightBorderWidth(int width) {
-  m_settings->setValue(KEY_UI_HIGHLIGHT_BORDER_WIDTH, width);
-  m_cachedHighlightBorderWidth = width;
-}
-
-BorderStyle Config::activeBorderStyle() const {
-  return m_cachedActiveBorderStyle;
-}
-
-void Config::setActiveBorderStyle(BorderStyle style) {
-  m_settings->setValue(KEY_UI_ACTIVE_BORDER_STYLE, static_cast<int>(style));
-  m_cachedActiveBorderStyle = style;
-}
-
-bool Config::showInactiveBorders() const { return m_cachedShowInactiveBorders; }
+  snapshot->highlightActive = m_cachedHighlightActive;
+  snapshot->highlightColor = m_cachedHighlightColor;
+  snapshot->highlightBorderWidth = m_cachedHighlightBorderWidth;
+  snapshot->activeBorderStyle = m_cachedActiveBorderStyle;
 
-void Config::setShowInactiveBorders(bool enabled) {
-  m_settings->setValue(KEY_UI_SHOW_INACTIVE_BORDERS, enabled);
-  m_cachedShowInactiveBorders = enabled;
-}
-
-QColor Config::inactiveBorderColor() const {
-  return m_cachedInactiveBorderColor;
-}
-
-void Config::setInactiveBorderColor(const QColor &color) {
-  m_settings->setValue(KEY_UI_INACTIVE_BORDER_COLOR, color.name());
-  m_cachedInactiveBorderColor = color;
-}
-
-int Config::inactiveBorderWidth() const { return m_cachedInactiveBorderWidth; }
-
-void Config::setInactiveBorderWidth(int width) {
-  m_settings->setValue(KEY_UI_INACTIVE_BORDER_WIDTH, width);
-  m_cachedInactiveBorderWidth = width;
-}
-
-BorderStyle Config::inactiveBorderStyle() const {
-  return m_cachedInactiveBorderStyle;
-}
-
-void Config::setInactiveBorderStyle(BorderStyle style) {
-  m_settings->setValue(KEY_UI_INACTIVE_BORDER_STYLE, static_cast<int>(style));
-  m_cachedInactiveBorderStyle = style;
-}
-
-int Config::thumbnailWidth() const { return m_cachedThumbnailWidth; }
-
-void Config::setThumbnailWidth(int width) {
-  m_settings->setValue(KEY_THUMBNAIL_WIDTH, width);
-  m_cachedThumbnailWidth = width;
-}
-
-int Config::thumbnailHeight() const { return m_cachedThumbnailHeight; }
-
-void Config::setThumbnailHeight(int height) {
-  m_settings->setValue(KEY_THUMBNAIL_HEIGHT, height);
-  m_cachedThumbnailHeight = height;
-}
+  snapshot->showInactiveBorders = m_cachedShowInactiveBorders;
+  snapshot->inactiveBorderColor = m_cachedInactiveBorderColor;
+  snapshot->inactiveBorderWidth = m_cachedInactiveBorderWidth;
+  snapshot->inactiveBorderStyle = m_cachedInactiveBorderStyle;
 
-int Config::thumbnailOpacity() const { return m_cachedThumbnailOpacity; }
+  snapshot->configDialogOpen = m_configDialogOpen;
+  snapshot->hotkeysOnlyWhenEVEFocused = m_cachedHotkeysOnlyWhenEVEFocused;
+  snapshot->processNames = m_cachedProcessNames;
 
-void Config::setThumbnailOpacity(int opacity) {
-  int boundedOpacity = qBound(OPACITY_MIN, opacity, OPACITY_MAX);
-  m_settings->setValue(KEY_THUMBNAIL_OPACITY, boundedOpacity);
-  m_cachedThumbnailOpacity = boundedOpacity;
-}
-
-bool Config::showNotLoggedInClients() const { return m_cachedShowNotLoggedIn; }
-
-void Config::setShowNotLoggedInClients(bool enabled) {
-  m_settings->setValue(KEY_THUMBNAIL_SHOW_NOT_LOGGED_IN, enabled);
-  m_cachedShowNotLoggedIn = enabled;
-}
+  snapshot->characterColors.reserve(m_characters.size());
+  for (const CharacterRecord &record : std::as_const(m_characters)) {
+    snapshot->characterColors.append(
+        {record.borderColor, record.inactiveBorderColor});
+  }
 
-int Config::notLoggedInStackMode() const {
-  return m_cachedNotLoggedInStackMode;
-}
+  for (auto it = m_cachedCombatEventBorderHighlights.constBegin();
+       it != m_cachedCombatEventBorderHighlights.constEnd(); ++it) {
+    if (it.value()) {
+      snapshot->combatBorders.insert(
+          it.key(), {combatEventColor(it.key()), combatBorderStyle(it.key())});
+    }
+  }
 
-void Config::setNotLoggedInStackMode(int mode) {
-  m_settings->setValue(KEY_THUMBNAIL_NOT_LOGGED_IN_STACK_MODE, mode);
-  m_cachedNotLoggedInStackMode = mode;
+  m_snapshot.store(std::move(snapshot), std::memory_order_release);
 }
 
 QPoint Config::notLoggedInReferencePosition() const {
@@ -631,31 +528,16 @@ QPoint Config::notLoggedInReferencePosition() const {
 }
 
 void Config::setNotLoggedInReferencePosition(const QPoint &pos) {
-  m_settings->setValue(KEY_THUMBNAIL_NOT_LOGGED_IN_REF_POSITION, pos);
+  writeValue(KEY_THUMBNAIL_NOT_LOGGED_IN_REF_POSITION, pos);
   m_cachedNotLoggedInReferencePosition = pos;
 }
 
-bool Config::showNotLoggedInOverlay() const {
-  return m_cachedShowNotLoggedInOverlay;
-}
-
-void Config::setShowNotLoggedInOverlay(bool show) {
-  m_settings->setValue(KEY_THUMBNAIL_SHOW_NOT_LOGGED_IN_OVERLAY, show);
-  m_cachedShowNotLoggedInOverlay = show;
-}
-
-bool Config::showNonEVEOverlay() const { return m_cachedShowNonEVEOverlay; }
-
-void Config::setShowNonEVEOverlay(bool show) {
-  m_settings->setValue(KEY_THUMBNAIL_SHOW_NON_EVE_OVERLAY, show);
-  m_cachedShowNonEVEOverlay = show;
-}
-
 QStringList Config::processNames() const { return m_cachedProcessNames; }
 
 void Config::setProcessNames(const QStringList &names) {
-  m_settings->setValue(KEY_THUMBNAIL_PROCESS_NAMES, names);
+  writeValue(KEY_THUMBNAIL_PROCESS_NAMES, names);
   m_cachedProcessNames = names;
+  publishSnapshot();
 }
 
 void Config::addProcessName(const QString &name) {
@@ -672,51 +554,12 @@ void Config::removeProcessName(const QString &name) {
   setProcessNames(names);
 }
 
-bool Config::alwaysOnTop() const { return m_cachedAlwaysOnTop; }
-
-void Config::setAlwaysOnTop(bool enabled) {
-  m_settings->setValue(KEY_WINDOW_ALWAYS_ON_TOP, enabled);
-  m_cachedAlwaysOnTop = enabled;
-}
-
-bool Config::switchOnMouseDown() const { return m_cachedSwitchOnMouseDown; }
-
-void Config::setSwitchOnMouseDown(bool enabled) {
-  m_settings->setValue(KEY_WINDOW_SWITCH_ON_MOUSE_DOWN, enabled);
-  m_cachedSwitchOnMouseDown = enabled;
-}
-
-bool Config::useDragWithRightClick() const {
-  return m_cachedDragWithRightClick;
-}
-
-void Config::setUseDragWithRightClick(bool enabled) {
-  m_settings->setValue(KEY_WINDOW_DRAG_WITH_RIGHT_CLICK, enabled);
-  m_cachedDragWithRightClick = enabled;
-}
-
-bool Config::minimizeInactiveClients() const {
-  return m_cachedMinimizeInactive;
-}
-
-void Config::setMinimizeInactiveClients(bool enabled) {
-  m_settings->setValue(KEY_WINDOW_MINIMIZE_INACTIVE, enabled);
-  m_cachedMinimizeInactive = enabled;
-}
-
-int Config::minimizeDelay() const { return m_cachedMinimizeDelay; }
-
-void Config::setMinimizeDelay(int delayMs) {
-  m_settings->setValue(KEY_WINDOW_MINIMIZE_DELAY, delayMs);
-  m_cachedMinimizeDelay = delayMs;
-}
-
 QStringList Config::neverMinimizeCharacters() const {
   return m_cachedNeverMinimizeCharacters;
 }
 
 void Config::setNeverMinimizeCharacters(const QStringList &characters) {
-  m_settings->setValue(KEY_WINDOW_NEVER_MINIMIZE_CHARACTERS, characters);
+  writeValue(KEY_WINDOW_NEVER_MINIMIZE_CHARACTERS, characters);
   m_cachedNeverMinimizeCharacters = characters;
 }
 
@@ -744,7 +587,7 @@ QStringList Config::neverCloseCharacters() const {
 }
 
 void Config::setNeverCloseCharacters(const QStringList &characters) {
-  m_settings->setValue(KEY_WINDOW_NEVER_CLOSE_CHARACTERS, characters);
+  writeValue(KEY_WINDOW_NEVER_CLOSE_CHARACTERS, characters);
   m_cachedNeverCloseCharacters = characters;
 }
 
@@ -772,7 +615,7 @@ QStringList Config::hiddenCharacters() const {
 }
 
 void Config::setHiddenCharacters(const QStringList &characters) {
-  m_settings->setValue(KEY_THUMBNAIL_HIDDEN_CHARACTERS, characters);
+  writeValue(KEY_THUMBNAIL_HIDDEN_CHARACTERS, characters);
   m_cachedHiddenCharacters = characters;
 }
 
@@ -795,119 +638,146 @@ bool Config::isCharacterHidden(const QString &characterName) const {
   return characters.contains(characterName, Qt::CaseInsensitive);
 }
 
-bool Config::saveClientLocation() const { return m_cachedSaveClientLocation; }
+int Config::characterId(const QString &characterName) const {
+  auto it = m_characterIds.constFind(characterName);
+  if (it != m_characterIds.constEnd()) {
+    return it.value();
+  }
 
-void Config::setSaveClientLocation(bool enabled) {
-  m_settings->setValue(KEY_WINDOW_SAVE_CLIENT_LOCATION, enabled);
-  m_cachedSaveClientLocation = enabled;
+  const int id = m_characters.size();
+  CharacterRecord record;
+  record.name = characterName;
+  m_characters.append(record);
+  m_characterIds.insert(characterName, id);
+  return id;
 }
 
-QRect Config::getClientWindowRect(const QString &characterName) const {
-  return m_cachedClientWindowRects.value(characterName, QRect());
+CharacterRecord Config::characterRecord(int id) const {
+  return id >= 0 && id < m_characters.size() ? m_characters[id]
+                                             : CharacterRecord();
 }
 
-void Config::setClientWindowRect(const QString &characterName,
-                                 const QRect &rect) {
-  QString key = QString("clientWindowRects/%1").arg(characterName);
-  qDebug() << "Saving client window rect for" << characterName << ":" << rect
-           << "isValid:" << rect.isValid() << "isEmpty:" << rect.isEmpty();
-  m_settings->setValue(key, rect);
-  m_cachedClientWindowRects[characterName] = rect;
+CharacterRecord Config::findCharacter(const QString &characterName) const {
+  // Unlike characterId(), lookups by name do not register the character
+  return characterRecord(m_characterIds.value(characterName, -1));
 }
 
-bool Config::rememberPositions() const { return m_cachedRememberPositions; }
-
-void Config::setRememberPositions(bool enabled) {
-  m_settings->setValue(KEY_POSITION_REMEMBER, enabled);
-  m_cachedRememberPositions = enabled;
+CharacterRecord &Config::characterForUpdate(const QString &characterName) {
+  return m_characters[characterId(characterName)];
 }
 
-bool Config::preserveLogoutPositions() const {
-  return m_cachedPreserveLogoutPositions;
+QRect Config::getClientWindowRect(const QString &characterName) const {
+  return findCharacter(characterName).clientWindowRect;
 }
 
-void Config::setPreserveLogoutPositions(bool enabled) {
-  m_settings->setValue(KEY_POSITION_PRESERVE_LOGOUT, enabled);
-  m_cachedPreserveLogoutPositions = enabled;
+void Config::setClientWindowRect(const QString &characterName,
+                                 const QRect &rect) {
+  QString key = QString("clientWindowRects/%1").arg(characterName);
+  qDebug() << "Saving client window rect for" << characterName << ":" << rect
+           << "isValid:" << rect.isValid() << "isEmpty:" << rect.isEmpty();
+  writeValue(key, rect);
+  characterForUpdate(characterName).clientWindowRect = rect;
 }
 
 QPoint Config::getThumbnailPosition(const QString &characterName) const {
-  return m_cachedThumbnailPositions.value(characterName, QPoint(-1, -1));
+  return findCharacter(characterName).thumbnailPosition;
 }
 
 void Config::setThumbnailPosition(const QString &characterName,
                                   const QPoint &pos) {
   QString key = QString("thumbnailPositions/%1").arg(characterName);
-  m_settings->setValue(key, pos);
-  m_cachedThumbnailPositions[characterName] = pos;
+  writeValue(key, pos);
+  characterForUpdate(characterName).thumbnailPosition = pos;
 }
 
 QColor Config::getCharacterBorderColor(const QString &characterName) const {
-  return m_cachedCharacterBorderColors.value(characterName, QColor());
+  return findCharacter(characterName).borderColor;
 }
 
 void Config::setCharacterBorderColor(const QString &characterName,
                                      const QColor &color) {
   QString key = QString("characterBorderColors/%1").arg(characterName);
-  m_settings->setValue(key, color.name());
-  m_cachedCharacterBorderColors[characterName] = color;
+  writeValue(key, color.name());
+  characterForUpdate(characterName).borderColor = color;
+  publishSnapshot();
 }
 
 void Config::removeCharacterBorderColor(const QString &characterName) {
   QString key = QString("characterBorderColors/%1").arg(characterName);
-  m_settings->remove(key);
-  m_cachedCharacterBorderColors.remove(characterName);
+  removeValue(key);
+  characterForUpdate(characterName).borderColor = QColor();
+  publishSnapshot();
 }
 
 QHash<QString, QColor> Config::getAllCharacterBorderColors() const {
-  return m_cachedCharacterBorderColors;
+  QHash<QString, QColor> colors;
+  for (const CharacterRecord &record : m_characters) {
+    if (record.borderColor.isValid()) {
+      colors.insert(record.name, record.borderColor);
+    }
+  }
+  return colors;
 }
 
 QColor
 Config::getCharacterInactiveBorderColor(const QString &characterName) const {
-  return m_cachedCharacterInactiveBorderColors.value(characterName, QColor());
+  return findCharacter(characterName).inactiveBorderColor;
 }
 
 void Config::setCharacterInactiveBorderColor(const QString &characterName,
                                              const QColor &color) {
   QString key = QString("characterInactiveBorderColors/%1").arg(characterName);
-  m_settings->setValue(key, color.name());
-  m_cachedCharacterInactiveBorderColors[characterName] = color;
+  writeValue(key, color.name());
+  characterForUpdate(characterName).inactiveBorderColor = color;
+  publishSnapshot();
 }
 
 void Config::removeCharacterInactiveBorderColor(const QString &characterName) {
   QString key = QString("characterInactiveBorderColors/%1").arg(characterName);
-  m_settings->remove(key);
-  m_cachedCharacterInactiveBorderColors.remove(characterName);
+  removeValue(key);
+  characterForUpdate(characterName).inactiveBorderColor = QColor();
+  publishSnapshot();
 }
 
 QHash<QString, QColor> Config::getAllCharacterInactiveBorderColors() const {
-  return m_cachedCharacterInactiveBorderColors;
+  QHash<QString, QColor> colors;
+  for (const CharacterRecord &record : m_characters) {
+    if (record.inactiveBorderColor.isValid()) {
+      colors.insert(record.name, record.inactiveBorderColor);
+    }
+  }
+  return colors;
 }
 
 QSize Config::getThumbnailSize(const QString &characterName) const {
-  return m_cachedThumbnailSizes.value(characterName, QSize(-1, -1));
+  return findCharacter(characterName).thumbnailSize;
 }
 
 void Config::setThumbnailSize(const QString &characterName, const QSize &size) {
   QString key = QString("thumbnailSizes/%1").arg(characterName);
-  m_settings->setValue(key, size);
-  m_cachedThumbnailSizes[characterName] = size;
+  writeValue(key, size);
+  characterForUpdate(characterName).thumbnailSize = size;
 }
 
 void Config::removeThumbnailSize(const QString &characterName) {
   QString key = QString("thumbnailSizes/%1").arg(characterName);
-  m_settings->remove(key);
-  m_cachedThumbnailSizes.remove(characterName);
+  removeValue(key);
+  characterForUpdate(characterName).thumbnailSize = QSize(-1, -1);
 }
 
 bool Config::hasCustomThumbnailSize(const QString &characterName) const {
-  QSize size = m_cachedThumbnailSizes.value(characterName, QSize(-1, -1));
+  QSize size = getThumbnailSize(characterName);
   return size.isValid() && size.width() > 0 && size.height() > 0;
 }
 
 QHash<QString, QSize> Config::getAllCustomThumbnailSizes() const {
-  return m_cachedThumbnailSizes;
+  QHash<QString, QSize> sizes;
+  for (const CharacterRecord &record : m_characters) {
+    if (record.thumbnailSize.isValid()) {
+      sizes.insert(record.name, record.thumbnailSize);
+    }
+  }
+  return sizes;
 }
 
 QSize Config::getProcessThumbnailSize(const QString &processName) const {
@@ -917,13 +787,13 @@ QSize Config::getProcessThumbnailSize(const QString &processName) const {
 void Config::setProcessThumbnailSize(const QString &processName,
                                      const QSize &size) {
   QString key = QString("processThumbnailSizes/%1").arg(processName);
-  m_settings->setValue(key, size);
+  writeValue(key, size);
   m_cachedProcessThumbnailSizes[processName] = size;
 }
 
 void Config::removeProcessThumbnailSize(const QString &processName) {
   QString key = QString("processThumbnailSizes/%1").arg(processName);
-  m_settings->remove(key);
+  removeValue(key);
   m_cachedProcessThumbnailSizes.remove(processName);
 }
 
@@ -937,208 +807,57 @@ QHash<QString, QSize> Config::getAllCustomProcessThumbnailSizes() const {
 }
 
 QString Config::getCustomThumbnailName(const QString &characterName) const {
-  return m_cachedCustomThumbnailNames.value(characterName, QString());
+  return findCharacter(characterName).customName;
 }
 
 void Config::setCustomThumbnailName(const QString &characterName,
                                     const QString &customName) {
   QString key = QString("thumbnailCustomNames/%1").arg(characterName);
-  m_settings->setValue(key, customName);
-  m_cachedCustomThumbnailNames[characterName] = customName;
+  writeValue(key, customName);
+  characterForUpdate(characterName).customName = customName;
 }
 
 void Config::removeCustomThumbnailName(const QString &characterName) {
   QString key = QString("thumbnailCustomNames/%1").arg(characterName);
-  m_settings->remove(key);
-  m_cachedCustomThumbnailNames.remove(characterName);
+  removeValue(key);
+  characterForUpdate(characterName).customName.clear();
 }
 
 bool Config::hasCustomThumbnailName(const QString &characterName) const {
-  return m_cachedCustomThumbnailNames.contains(characterName) &&
-         !m_cachedCustomThumbnailNames[characterName].isEmpty();
+  return !getCustomThumbnailName(characterName).isEmpty();
 }
 
 QHash<QString, QString> Config::getAllCustomThumbnailNames() const {
-  return m_cachedCustomThumbnailNames;
-}
-
-bool Config::enableSnapping() const { return m_cachedEnableSnapping; }
-
-void Config::setEnableSnapping(bool enabled) {
-  m_settings->setValue(KEY_POSITION_ENABLE_SNAPPING, enabled);
-  m_cachedEnableSnapping = enabled;
-}
-
-int Config::snapDistance() const { return m_cachedSnapDistance; }
-
-void Config::setSnapDistance(int distance) {
-  m_settings->setValue(KEY_POSITION_SNAP_DISTANCE, distance);
-  m_cachedSnapDistance = distance;
-}
-
-bool Config::lockThumbnailPositions() const { return m_cachedLockPositions; }
-
-void Config::setLockThumbnailPositions(bool locked) {
-  m_settings->setValue(KEY_POSITION_LOCK, locked);
-  m_cachedLockPositions = locked;
-}
-
-bool Config::wildcardHotkeys() const { return m_cachedWildcardHotkeys; }
-
-void Config::setWildcardHotkeys(bool enabled) {
-  m_settings->setValue(KEY_HOTKEY_WILDCARD, enabled);
-  m_cachedWildcardHotkeys = enabled;
-}
-
-bool Config::hotkeysOnlyWhenEVEFocused() const {
-  return m_cachedHotkeysOnlyWhenEVEFocused;
-}
-
-void Config::setHotkeysOnlyWhenEVEFocused(bool enabled) {
-  m_settings->setValue(KEY_HOTKEY_ONLY_WHEN_EVE_FOCUSED, enabled);
-  m_cachedHotkeysOnlyWhenEVEFocused = enabled;
-}
-
-bool Config::resetGroupIndexOnNonGroupFocus() const {
-  return m_cachedResetGroupIndexOnNonGroupFocus;
-}
-
-void Config::setResetGroupIndexOnNonGroupFocus(bool enabled) {
-  m_settings->setValue(KEY_HOTKEY_RESET_GROUP_INDEX_ON_NON_GROUP_FOCUS,
-                       enabled);
-  m_cachedResetGroupIndexOnNonGroupFocus = enabled;
+  QHash<QString, QString> names;
+  for (const CharacterRecord &record : m_characters) {
+    if (!record.customName.isEmpty()) {
+      names.insert(record.name, record.customName);
+    }
+  }
+  return names;
 }
 
 bool Config::isConfigDialogOpen() const { return m_configDialogOpen; }
 
-void Config::setConfigDialogOpen(bool open) { m_configDialogOpen = open; }
-
-bool Config::showCharacterName() const { return m_cachedShowCharacterName; }
-
-void Config::setShowCharacterName(bool enabled) {
-  m_settings->setValue(KEY_OVERLAY_SHOW_CHARACTER, enabled);
-  m_cachedShowCharacterName = enabled;
-}
-
-QColor Config::characterNameColor() const { return m_cachedCharacterNameColor; }
-
-void Config::setCharacterNameColor(const QColor &color) {
-  m_settings->setValue(KEY_OVERLAY_CHARACTER_COLOR, color.name());
-  m_cachedCharacterNameColor = color;
-}
-
-int Config::characterNamePosition() const {
-  return m_cachedCharacterNamePosition;
-}
-
-void Config::setCharacterNamePosition(int position) {
-  m_settings->setValue(KEY_OVERLAY_CHARACTER_POSITION, position);
-  m_cachedCharacterNamePosition = position;
-}
-
-bool Config::showSystemName() const { return m_cachedShowSystemName; }
-
-void Config::setShowSystemName(bool enabled) {
-  m_settings->setValue(KEY_OVERLAY_SHOW_SYSTEM, enabled);
-  m_cachedShowSystemName = enabled;
-}
-
-bool Config::useUniqueSystemNameColors() const {
-  return m_cachedUniqueSystemNameColors;
-}
-
-void Config::setUseUniqueSystemNameColors(bool enabled) {
-  m_settings->setValue(KEY_OVERLAY_UNIQUE_SYSTEM_COLORS, enabled);
-  m_cachedUniqueSystemNameColors = enabled;
-}
-
-QColor Config::systemNameColor() const { return m_cachedSystemNameColor; }
-
-void Config::setSystemNameColor(const QColor &color) {
-  m_settings->setValue(KEY_OVERLAY_SYSTEM_COLOR, color.name());
-  m_cachedSystemNameColor = color;
-}
-
-int Config::systemNamePosition() const { return m_cachedSystemNamePosition; }
-
-void Config::setSystemNamePosition(int position) {
-  m_settings->setValue(KEY_OVERLAY_SYSTEM_POSITION, position);
-  m_cachedSystemNamePosition = position;
-}
-
-bool Config::showOverlayBackground() const {
-  return m_cachedShowOverlayBackground;
-}
-
-void Config::setShowOverlayBackground(bool enabled) {
-  m_settings->setValue(KEY_OVERLAY_SHOW_BACKGROUND, enabled);
-  m_cachedShowOverlayBackground = enabled;
-}
-
-QColor Config::overlayBackgroundColor() const {
-  return m_cachedOverlayBackgroundColor;
-}
-
-void Config::setOverlayBackgroundColor(const QColor &color) {
-  m_settings->setValue(KEY_OVERLAY_BACKGROUND_COLOR, color.name());
-  m_cachedOverlayBackgroundColor = color;
-}
-
-int Config::overlayBackgroundOpacity() const {
-  return m_cachedOverlayBackgroundOpacity;
-}
-
-void Config::setOverlayBackgroundOpacity(int opacity) {
-  m_settings->setValue(KEY_OVERLAY_BACKGROUND_OPACITY, opacity);
-  m_cachedOverlayBackgroundOpacity = opacity;
+void Config::setConfigDialogOpen(bool open) {
+  m_configDialogOpen = open;
+  publishSnapshot();
 }
 
 QFont Config::characterNameFont() const { return m_cachedCharacterNameFont; }
 
 void Config::setCharacterNameFont(const QFont &font) {
-  m_settings->setValue(KEY_OVERLAY_CHARACTER_FONT, font.toString());
+  writeValue(KEY_OVERLAY_CHARACTER_FONT, font.toString());
   m_cachedCharacterNameFont = font;
 }
 
-int Config::characterNameOffsetX() const {
-  return m_cachedCharacterNameOffsetX;
-}
-
-void Config::setCharacterNameOffsetX(int offset) {
-  m_settings->setValue(KEY_OVERLAY_CHARACTER_OFFSET_X, offset);
-  m_cachedCharacterNameOffsetX = offset;
-}
-
-int Config::characterNameOffsetY() const {
-  return m_cachedCharacterNameOffsetY;
-}
-
-void Config::setCharacterNameOffsetY(int offset) {
-  m_settings->setValue(KEY_OVERLAY_CHARACTER_OFFSET_Y, offset);
-  m_cachedCharacterNameOffsetY = offset;
-}
-
 QFont Config::systemNameFont() const { return m_cachedSystemNameFont; }
 
 void Config::setSystemNameFont(const QFont &font) {
-  m_settings->setValue(KEY_OVERLAY_SYSTEM_FONT, font.toString());
+  writeValue(KEY_OVERLAY_SYSTEM_FONT, font.toString());
   m_cachedSystemNameFont = font;
 }
 
-int Config::systemNameOffsetX() const { return m_cachedSystemNameOffsetX; }
-
-void Config::setSystemNameOffsetX(int offset) {
-  m_settings->setValue(KEY_OVERLAY_SYSTEM_OFFSET_X, offset);
-  m_cachedSystemNameOffsetX = offset;
-}
-
-int Config::systemNameOffsetY() const { return m_cachedSystemNameOffsetY; }
-
-void Config::setSystemNameOffsetY(int offset) {
-  m_settings->setValue(KEY_OVERLAY_SYSTEM_OFFSET_Y, offset);
-  m_cachedSystemNameOffsetY = offset;
-}
-
 QColor Config::getSystemNameColor(const QString &systemName) const {
   return m_cachedSystemNameColors.value(systemName, QColor());
 }
@@ -1146,13 +865,13 @@ QColor Config::getSystemNameColor(const QString &systemName) const {
 void Config::setSystemNameColor(const QString &systemName,
                                 const QColor &color) {
   QString key = QString("systemNameColors/%1").arg(systemName);
-  m_settings->setValue(key, color.name());
+  writeValue(key, color.name());
   m_cachedSystemNameColors[systemName] = color;
 }
 
 void Config::removeSystemNameColor(const QString &systemName) {
   QString key = QString("systemNameColors/%1").arg(systemName);
-  m_settings->remove(key);
+  removeValue(key);
   m_cachedSystemNameColors.remove(systemName);
 }
 
@@ -1163,13 +882,35 @@ QHash<QString, QColor> Config::getAllSystemNameColors() const {
 QFont Config::overlayFont() const { return m_cachedOverlayFont; }
 
 void Config::setOverlayFont(const QFont &font) {
-  m_settings->setValue(KEY_OVERLAY_FONT, font.toString());
+  writeValue(KEY_OVERLAY_FONT, font.toString());
   m_cachedOverlayFont = font;
 }
 
-QString Config::configFilePath() const { return m_settings->fileName(); }
+QString Config::configFilePath() const { return m_writer->fileName(); }
+
+void Config::save() { m_writer->flushAndWait(); }
+
+void Config::writeValue(const QString &key, const QVariant &value) {
+  m_values.setValue(key, value);
+  m_writer->setValue(key, value);
+}
 
-void Config::save() { m_settings->sync(); }
+void Config::removeValue(const QString &key) {
+  m_values.remove(key);
+  m_writer->remove(key);
+}
+
+void Config::openProfileSettings(const QString &profilePath) {
+  if (!m_writer) {
+    m_writer = std::make_unique<SettingsWriter>(profilePath);
+    return;
+  }
+
+  // Pending changes are written to the profile being closed on the writer
+  // thread. Until they are, switching back finds them in the preloader.
+  m_preloader->store(m_writer->fileName(), m_values);
+  m_writer->setFileName(profilePath);
+}
 
 QString Config::getProfilesDirectory() const {
   QString exePath = QCoreApplication::applicationDirPath();
@@ -1224,9 +965,9 @@ void Config::loadGlobalSettings() {
 
 void Config::saveGlobalSettings() {
   if (m_globalSettings) {
+    // Written by QSettings from the event loop, not on a profile switch
     m_globalSettings->setValue(KEY_GLOBAL_LAST_USED_PROFILE,
                                m_currentProfileName);
-    m_globalSettings->sync();
   }
 }
 
@@ -1338,108 +1079,40 @@ void Config::migrateToProfileSystem() {
 void Config::initializeDefaultProfile() {
   ensureProfilesDirectoryExists();
 
-  QString defaultProfilePath = getProfileFilePath("default");
-  m_settings =
-      std::make_unique<QSettings>(defaultProfilePath, QSettings::IniFormat);
-
-  m_settings->setValue(KEY_CONFIG_VERSION, CONFIG_VERSION);
-
-  m_settings->setValue(KEY_UI_HIGHLIGHT_ACTIVE, DEFAULT_UI_HIGHLIGHT_ACTIVE);
-  m_settings->setValue(KEY_UI_HIDE_ACTIVE_THUMBNAIL,
-                       DEFAULT_UI_HIDE_ACTIVE_THUMBNAIL);
-  m_settings->setValue(KEY_UI_HIDE_THUMBNAILS_WHEN_EVE_NOT_FOCUSED,
-                       DEFAULT_UI_HIDE_THUMBNAILS_WHEN_EVE_NOT_FOCUSED);
-  m_settings->setValue(KEY_UI_EVE_FOCUS_DEBOUNCE_INTERVAL,
-                       DEFAULT_EVE_FOCUS_DEBOUNCE_INTERVAL);
-  m_settings->setValue(KEY_UI_HIGHLIGHT_COLOR, DEFAULT_UI_HIGHLIGHT_COLOR);
-  m_settings->setValue(KEY_UI_HIGHLIGHT_BORDER_WIDTH,
-                       DEFAULT_UI_HIGHLIGHT_BORDER_WIDTH);
-  m_settings->setValue(KEY_UI_ACTIVE_BORDER_STYLE, DEFAULT_ACTIVE_BORDER_STYLE);
-
-  m_settings->setValue(KEY_UI_SHOW_INACTIVE_BORDERS,
-                       DEFAULT_UI_SHOW_INACTIVE_BORDERS);
-  m_settings->setValue(KEY_UI_INACTIVE_BORDER_COLOR,
-                       DEFAULT_UI_INACTIVE_BORDER_COLOR);
-  m_settings->setValue(KEY_UI_INACTIVE_BORDER_WIDTH,
-                       DEFAULT_UI_INACTIVE_BORDER_WIDTH);
-  m_settings->setValue(KEY_UI_INACTIVE_BORDER_STYLE,
-                       DEFAULT_INACTIVE_BORDER_STYLE);
-
-  m_settings->setValue(KEY_THUMBNAIL_WIDTH, DEFAULT_THUMBNAIL_WIDTH);
-  m_settings->setValue(KEY_THUMBNAIL_HEIGHT, DEFAULT_THUMBNAIL_HEIGHT);
-  m_settings->setValue(KEY_THUMBNAIL_OPACITY, DEFAULT_THUMBNAIL_OPACITY);
+  openProfileSettings(getProfileFilePath("default"));
+  QSettings settings(configFilePath(), QSettings::IniFormat);
+
+  settings.setValue(KEY_CONFIG_VERSION, CONFIG_VERSION);
+
+  writeSchemaDefaults(settings);
 
   QStringList defaultProcessNames;
   defaultProcessNames << DEFAULT_THUMBNAIL_PROCESS_NAME;
-  m_settings->setValue(KEY_THUMBNAIL_PROCESS_NAMES, defaultProcessNames);
-  m_settings->setValue(KEY_THUMBNAIL_SHOW_NOT_LOGGED_IN,
-                       DEFAULT_THUMBNAIL_SHOW_NOT_LOGGED_IN);
-  m_settings->setValue(KEY_THUMBNAIL_NOT_LOGGED_IN_STACK_MODE,
-                       DEFAULT_THUMBNAIL_NOT_LOGGED_IN_STACK_MODE);
-  m_settings->setValue(KEY_THUMBNAIL_NOT_LOGGED_IN_REF_POSITION,
-                       QPoint(DEFAULT_THUMBNAIL_NOT_LOGGED_IN_REF_X,
-                              DEFAULT_THUMBNAIL_NOT_LOGGED_IN_REF_Y));
-  m_settings->setValue(KEY_THUMBNAIL_SHOW_NOT_LOGGED_IN_OVERLAY,
-                       DEFAULT_THUMBNAIL_SHOW_NOT_LOGGED_IN_OVERLAY);
-  m_settings->setValue(KEY_THUMBNAIL_SHOW_NON_EVE_OVERLAY,
-                       DEFAULT_THUMBNAIL_SHOW_NON_EVE_OVERLAY);
-
-  m_settings->setValue(KEY_WINDOW_ALWAYS_ON_TOP, DEFAULT_WINDOW_ALWAYS_ON_TOP);
-  m_settings->setValue(KEY_WINDOW_MINIMIZE_INACTIVE,
-                       DEFAULT_WINDOW_MINIMIZE_INACTIVE);
-  m_settings->setValue(KEY_WINDOW_MINIMIZE_DELAY,
-                       DEFAULT_WINDOW_MINIMIZE_DELAY);
-
-  m_settings->setValue(KEY_POSITION_REMEMBER, DEFAULT_POSITION_REMEMBER);
-  m_settings->setValue(KEY_POSITION_PRESERVE_LOGOUT,
-                       DEFAULT_POSITION_PRESERVE_LOGOUT);
-  m_settings->setValue(KEY_POSITION_ENABLE_SNAPPING,
-                       DEFAULT_POSITION_ENABLE_SNAPPING);
-  m_settings->setValue(KEY_POSITION_SNAP_DISTANCE,
-                       DEFAULT_POSITION_SNAP_DISTANCE);
-
-  m_settings->setValue(KEY_OVERLAY_SHOW_CHARACTER,
-                       DEFAULT_OVERLAY_SHOW_CHARACTER);
-  m_settings->setValue(KEY_OVERLAY_CHARACTER_COLOR,
-                       DEFAULT_OVERLAY_CHARACTER_COLOR);
-  m_settings->setValue(KEY_OVERLAY_CHARACTER_POSITION,
-                       DEFAULT_OVERLAY_CHARACTER_POSITION);
-  m_settings->setValue(
+  settings.setValue(KEY_THUMBNAIL_PROCESS_NAMES, defaultProcessNames);
+  settings.setValue(KEY_THUMBNAIL_NOT_LOGGED_IN_REF_POSITION,
+                    QPoint(DEFAULT_THUMBNAIL_NOT_LOGGED_IN_REF_X,
+                           DEFAULT_THUMBNAIL_NOT_LOGGED_IN_REF_Y));
+
+  settings.setValue(
       KEY_OVERLAY_CHARACTER_FONT,
       QFont(DEFAULT_OVERLAY_FONT_FAMILY, DEFAULT_OVERLAY_FONT_SIZE).toString());
-  m_settings->setValue(KEY_OVERLAY_SHOW_SYSTEM, DEFAULT_OVERLAY_SHOW_SYSTEM);
-  m_settings->setValue(KEY_OVERLAY_SYSTEM_COLOR, DEFAULT_OVERLAY_SYSTEM_COLOR);
-  m_settings->setValue(KEY_OVERLAY_SYSTEM_POSITION,
-                       DEFAULT_OVERLAY_SYSTEM_POSITION);
-  m_settings->setValue(
+  settings.setValue(
       KEY_OVERLAY_SYSTEM_FONT,
       QFont(DEFAULT_OVERLAY_FONT_FAMILY, DEFAULT_OVERLAY_FONT_SIZE).toString());
-  m_settings->setValue(KEY_OVERLAY_SHOW_BACKGROUND,
-                       DEFAULT_OVERLAY_SHOW_BACKGROUND);
-  m_settings->setValue(KEY_OVERLAY_BACKGROUND_COLOR,
-                       DEFAULT_OVERLAY_BACKGROUND_COLOR);
-  m_settings->setValue(KEY_OVERLAY_BACKGROUND_OPACITY,
-                       DEFAULT_OVERLAY_BACKGROUND_OPACITY);
-  m_settings->setValue(
+  settings.setValue(
       KEY_OVERLAY_FONT,
       QFont(DEFAULT_OVERLAY_FONT_FAMILY, DEFAULT_OVERLAY_FONT_SIZE).toString());
 
-  m_settings->setValue(KEY_COMBAT_ENABLED, DEFAULT_COMBAT_MESSAGES_ENABLED);
-  m_settings->setValue(KEY_COMBAT_DURATION, DEFAULT_COMBAT_MESSAGE_DURATION);
-  m_settings->setValue(KEY_COMBAT_POSITION, DEFAULT_COMBAT_MESSAGE_POSITION);
-  m_settings->setValue(KEY_COMBAT_COLOR, DEFAULT_COMBAT_MESSAGE_COLOR);
+  settings.setValue(KEY_COMBAT_DURATION, DEFAULT_COMBAT_MESSAGE_DURATION);
+  settings.setValue(KEY_COMBAT_COLOR, DEFAULT_COMBAT_MESSAGE_COLOR);
   QFont defaultCombatFont(DEFAULT_OVERLAY_FONT_FAMILY,
                           DEFAULT_OVERLAY_FONT_SIZE);
   defaultCombatFont.setBold(true);
-  m_settings->setValue(KEY_COMBAT_FONT, defaultCombatFont.toString());
-  m_settings->setValue(KEY_COMBAT_SUPPRESS_FOCUSED,
-                       DEFAULT_COMBAT_SUPPRESS_FOCUSED);
-  m_settings->setValue(KEY_COMBAT_ENABLED_EVENT_TYPES,
-                       DEFAULT_COMBAT_MESSAGE_EVENT_TYPES());
-  m_settings->setValue(KEY_MINING_TIMEOUT_SECONDS,
-                       DEFAULT_MINING_TIMEOUT_SECONDS);
+  settings.setValue(KEY_COMBAT_FONT, defaultCombatFont.toString());
+  settings.setValue(KEY_COMBAT_ENABLED_EVENT_TYPES,
+                    DEFAULT_COMBAT_MESSAGE_EVENT_TYPES());
 
-  m_settings->sync();
+  settings.sync();
 
   m_currentProfileName = "default";
   qDebug() << "Initialized default profile";
@@ -1481,11 +1154,12 @@ bool Config::profileExists(const QString &profileName) const {
   return QFile::exists(profilePath);
 }
 
-void Config::migrateLegacyCombatKeys() {
+void Config::migrateLegacyCombatKeys(SettingsMap &values) {
   QPair<const char *, const char *> keys[] = {
-      {"CombatMessages/Enabled", KEY_COMBAT_ENABLED},
+      {"CombatMessages/Enabled", BOOL_SETTINGS[ShowCombatMessagesSetting].key},
       {"CombatMessages/Duration", KEY_COMBAT_DURATION},
-      {"CombatMessages/Position", KEY_COMBAT_POSITION},
+      {"CombatMessages/Position",
+       INT_SETTINGS[CombatMessagePositionSetting].key},
       {"CombatMessages/Color", KEY_COMBAT_COLOR},
       {"CombatMessages/Font", KEY_COMBAT_FONT},
       {"CombatMessages/EnabledEventTypes", KEY_COMBAT_ENABLED_EVENT_TYPES}};
@@ -1493,10 +1167,12 @@ void Config::migrateLegacyCombatKeys() {
   for (const auto &pair : keys) {
     const char *oldKey = pair.first;
     const char *newKey = pair.second;
-    if (m_settings->contains(oldKey) && !m_settings->contains(newKey)) {
-      QVariant v = m_settings->value(oldKey);
-      m_settings->setValue(newKey, v);
-      m_settings->remove(oldKey);
+    if (values.contains(oldKey) && !values.contains(newKey)) {
+      QVariant v = values.value(oldKey);
+      values.setValue(newKey, v);
+      values.remove(oldKey);
+      m_writer->setValue(newKey, v);
+      m_writer->remove(oldKey);
     }
   }
 }
@@ -1512,17 +1188,13 @@ bool Config::loadProfile(const QString &profileName) {
     return false;
   }
 
-  if (m_settings) {
-    m_settings->sync();
-  }
-
-  QString profilePath = getProfileFilePath(profileName);
-  m_settings = std::make_unique<QSettings>(profilePath, QSettings::IniFormat);
+  openProfileSettings(getProfileFilePath(profileName));
   m_currentProfileName = profileName;
 
-  migrateLegacyCombatKeys();
+  SettingsMap values = m_preloader->values(configFilePath());
+  migrateLegacyCombatKeys(values);
 
-  loadCacheFromSettings();
+  loadCacheFromSettings(values);
 
   saveGlobalSettings();
 
@@ -1530,6 +1202,86 @@ bool Config::loadProfile(const QString &profileName) {
   return true;
 }
 
+void Config::preloadProfiles() {
+  QStringList fileNames;
+  for (const QString &profileName : listProfiles()) {
+    fileNames.append(getProfileFilePath(profileName));
+  }
+
+  // Once the changes handed to the writer so far are written, so that a
+  // profile just switched away from is parsed as it is now
+  m_writer->afterWrites(
+      [this, fileNames]() { m_preloader->preload(fileNames); });
+}
+
+SettingsMap Config::profileValues(const QString &profileName) {
+  if (profileName == m_currentProfileName) {
+    return m_values;
+  }
+  return m_preloader->values(getProfileFilePath(profileName));
+}
+
+ProfileDiff Config::diffProfiles(const SettingsMap &from,
+                                 const SettingsMap &to) {
+  // Top-level groups by what applying a change to them takes. Changes to
+  // any other group are applied in full.
+  static const QStringList hotkeyGroups = {
+      "hotkey",
+      "hotkeys",
+      "characterHotkeys",
+      "cycleGroups",
+      "notLoggedInHotkeys",
+      "nonEVEHotkeys",
+      "closeAllHotkeys",
+      "minimizeAllHotkeys",
+      "toggleThumbnailsVisibilityHotkeys",
+  };
+  static const QStringList thumbnailGroups = {
+      "thumbnailPositions",
+      "thumbnailSizes",
+      "thumbnailCustomNames",
+      "processThumbnailSizes",
+      "characterBorderColors",
+      "characterInactiveBorderColors",
+  };
+  static const QStringList layoutGroups = {"thumbnail", "window", "position"};
+  static const QStringList overlayGroups = {"ui", "overlay", "combatMessages",
+                                            "systemNameColors"};
+  static const QStringList logGroups = {"chatlog", "gamelog", "logMonitoring",
+                                        "logAlertRules", "miningMode"};
+  // Read where they are used, or only when a window first appears
+  static const QStringList liveGroups = {"config", "clientWindowRects"};
+  static const QStringList layoutKeys = {
+      BOOL_SETTINGS[HideActiveThumbnailSetting].key,
+      BOOL_SETTINGS[HideThumbnailsWhenEVENotFocusedSetting].key,
+      INT_SETTINGS[EveFocusDebounceIntervalSetting].key,
+  };
+
+  ProfileDiff diff;
+  for (const QString &key : SettingsMap::changedKeys(from, to)) {
+    const int slash = key.indexOf('/');
+    const QString group = slash >= 0 ? key.left(slash) : key;
+
+    if (layoutKeys.contains(key, Qt::CaseInsensitive)) {
+      diff.layout = true;
+    } else if (hotkeyGroups.contains(group, Qt::CaseInsensitive)) {
+      diff.hotkeys = true;
+    } else if (thumbnailGroups.contains(group, Qt::CaseInsensitive)) {
+      diff.thumbnails.insert(key.mid(slash + 1).toLower());
+    } else if (layoutGroups.contains(group, Qt::CaseInsensitive)) {
+      diff.layout = true;
+    } else if (overlayGroups.contains(group, Qt::CaseInsensitive)) {
+      diff.overlays = true;
+    } else if (logGroups.contains(group, Qt::CaseInsensitive)) {
+      diff.logMonitoring = true;
+    } else if (!liveGroups.contains(group, Qt::CaseInsensitive)) {
+      qDebug() << "Config: Applying profile in full for changed key" << key;
+      diff.hotkeys = diff.layout = diff.overlays = diff.logMonitoring = true;
+    }
+  }
+  return diff;
+}
+
 bool Config::createProfile(const QString &profileName, bool useDefaults) {
   if (profileName.isEmpty()) {
     qWarning() << "Cannot create profile: empty profile name";
@@ -1549,88 +1301,35 @@ bool Config::createProfile(const QString &profileName, bool useDefaults) {
   if (useDefaults) {
     newProfile.setValue(KEY_CONFIG_VERSION, CONFIG_VERSION);
 
-    newProfile.setValue(KEY_UI_HIGHLIGHT_ACTIVE, DEFAULT_UI_HIGHLIGHT_ACTIVE);
-    newProfile.setValue(KEY_UI_HIDE_ACTIVE_THUMBNAIL,
-                        DEFAULT_UI_HIDE_ACTIVE_THUMBNAIL);
-    newProfile.setValue(KEY_UI_HIGHLIGHT_COLOR, DEFAULT_UI_HIGHLIGHT_COLOR);
-    newProfile.setValue(KEY_UI_HIGHLIGHT_BORDER_WIDTH,
-                        DEFAULT_UI_HIGHLIGHT_BORDER_WIDTH);
-
-    newProfile.setValue(KEY_THUMBNAIL_WIDTH, DEFAULT_THUMBNAIL_WIDTH);
-    newProfile.setValue(KEY_THUMBNAIL_HEIGHT, DEFAULT_THUMBNAIL_HEIGHT);
-    newProfile.setValue(KEY_THUMBNAIL_OPACITY, DEFAULT_THUMBNAIL_OPACITY);
+    writeSchemaDefaults(newProfile);
 
     QStringList defaultProcessNames;
     defaultProcessNames << DEFAULT_THUMBNAIL_PROCESS_NAME;
     newProfile.setValue(KEY_THUMBNAIL_PROCESS_NAMES, defaultProcessNames);
-    newProfile.setValue(KEY_THUMBNAIL_SHOW_NOT_LOGGED_IN,
-                        DEFAULT_THUMBNAIL_SHOW_NOT_LOGGED_IN);
-    newProfile.setValue(KEY_THUMBNAIL_NOT_LOGGED_IN_STACK_MODE,
-                        DEFAULT_THUMBNAIL_NOT_LOGGED_IN_STACK_MODE);
     newProfile.setValue(KEY_THUMBNAIL_NOT_LOGGED_IN_REF_POSITION,
                         QPoint(DEFAULT_THUMBNAIL_NOT_LOGGED_IN_REF_X,
                                DEFAULT_THUMBNAIL_NOT_LOGGED_IN_REF_Y));
-    newProfile.setValue(KEY_THUMBNAIL_SHOW_NOT_LOGGED_IN_OVERLAY,
-                        DEFAULT_THUMBNAIL_SHOW_NOT_LOGGED_IN_OVERLAY);
-    newProfile.setValue(KEY_THUMBNAIL_SHOW_NON_EVE_OVERLAY,
-                        DEFAULT_THUMBNAIL_SHOW_NON_EVE_OVERLAY);
-
-    newProfile.setValue(KEY_WINDOW_ALWAYS_ON_TOP, DEFAULT_WINDOW_ALWAYS_ON_TOP);
-    newProfile.setValue(KEY_WINDOW_MINIMIZE_INACTIVE,
-                        DEFAULT_WINDOW_MINIMIZE_INACTIVE);
-    newProfile.setValue(KEY_WINDOW_MINIMIZE_DELAY,
-                        DEFAULT_WINDOW_MINIMIZE_DELAY);
-
-    newProfile.setValue(KEY_POSITION_REMEMBER, DEFAULT_POSITION_REMEMBER);
-    newProfile.setValue(KEY_POSITION_PRESERVE_LOGOUT,
-                        DEFAULT_POSITION_PRESERVE_LOGOUT);
-    newProfile.setValue(KEY_POSITION_ENABLE_SNAPPING,
-                        DEFAULT_POSITION_ENABLE_SNAPPING);
-    newProfile.setValue(KEY_POSITION_SNAP_DISTANCE,
-                        DEFAULT_POSITION_SNAP_DISTANCE);
-
-    newProfile.setValue(KEY_OVERLAY_SHOW_CHARACTER,
-                        DEFAULT_OVERLAY_SHOW_CHARACTER);
-    newProfile.setValue(KEY_OVERLAY_CHARACTER_COLOR,
-                        DEFAULT_OVERLAY_CHARACTER_COLOR);
-    newProfile.setValue(KEY_OVERLAY_CHARACTER_POSITION,
-                        DEFAULT_OVERLAY_CHARACTER_POSITION);
+
     newProfile.setValue(
         KEY_OVERLAY_CHARACTER_FONT,
         QFont(DEFAULT_OVERLAY_FONT_FAMILY, DEFAULT_OVERLAY_FONT_SIZE)
             .toString());
-    newProfile.setValue(KEY_OVERLAY_SHOW_SYSTEM, DEFAULT_OVERLAY_SHOW_SYSTEM);
-    newProfile.setValue(KEY_OVERLAY_SYSTEM_COLOR, DEFAULT_OVERLAY_SYSTEM_COLOR);
-    newProfile.setValue(KEY_OVERLAY_SYSTEM_POSITION,
-                        DEFAULT_OVERLAY_SYSTEM_POSITION);
     newProfile.setValue(
         KEY_OVERLAY_SYSTEM_FONT,
         QFont(DEFAULT_OVERLAY_FONT_FAMILY, DEFAULT_OVERLAY_FONT_SIZE)
             .toString());
-    newProfile.setValue(KEY_OVERLAY_SHOW_BACKGROUND,
-                        DEFAULT_OVERLAY_SHOW_BACKGROUND);
-    newProfile.setValue(KEY_OVERLAY_BACKGROUND_COLOR,
-                        DEFAULT_OVERLAY_BACKGROUND_COLOR);
-    newProfile.setValue(KEY_OVERLAY_BACKGROUND_OPACITY,
-                        DEFAULT_OVERLAY_BACKGROUND_OPACITY);
     newProfile.setValue(KEY_OVERLAY_FONT, QFont(DEFAULT_OVERLAY_FONT_FAMILY,
                                                 DEFAULT_OVERLAY_FONT_SIZE)
                                               .toString());
 
-    newProfile.setValue(KEY_COMBAT_ENABLED, DEFAULT_COMBAT_MESSAGES_ENABLED);
     newProfile.setValue(KEY_COMBAT_DURATION, DEFAULT_COMBAT_MESSAGE_DURATION);
-    newProfile.setValue(KEY_COMBAT_POSITION, DEFAULT_COMBAT_MESSAGE_POSITION);
     newProfile.setValue(KEY_COMBAT_COLOR, DEFAULT_COMBAT_MESSAGE_COLOR);
     QFont defaultCombatFont(DEFAULT_OVERLAY_FONT_FAMILY,
                             DEFAULT_OVERLAY_FONT_SIZE);
     defaultCombatFont.setBold(true);
     newProfile.setValue(KEY_COMBAT_FONT, defaultCombatFont.toString());
-    newProfile.setValue(KEY_COMBAT_SUPPRESS_FOCUSED,
-                        DEFAULT_COMBAT_SUPPRESS_FOCUSED);
     newProfile.setValue(KEY_COMBAT_ENABLED_EVENT_TYPES,
                         DEFAULT_COMBAT_MESSAGE_EVENT_TYPES());
-    newProfile.setValue(KEY_MINING_TIMEOUT_SECONDS,
-                        DEFAULT_MINING_TIMEOUT_SECONDS);
   }
 
   newProfile.sync();
@@ -1657,6 +1356,10 @@ bool Config::cloneProfile(const QString &sourceName, const QString &destName) {
 
   ensureProfilesDirectoryExists();
 
+  // Changes to it may still be on their way to the file, also when it was
+  // switched away from a moment ago
+  save();
+
   QString sourcePath = getProfileFilePath(sourceName);
   QString destPath = getProfileFilePath(destName);
 
@@ -1693,6 +1396,9 @@ bool Config::deleteProfile(const QString &profileName) {
     }
   }
 
+  // A pending write would otherwise recreate the file
+  save();
+
   QString profilePath = getProfileFilePath(profileName);
   if (QFile::remove(profilePath)) {
     clearProfileHotkey(profileName);
@@ -1725,11 +1431,16 @@ bool Config::renameProfile(const QString &oldName, const QString &newName) {
     return false;
   }
 
+  // A pending write would otherwise recreate the file under the old name
+  save();
+
   QString oldPath = getProfileFilePath(oldName);
   QString newPath = getProfileFilePath(newName);
 
   if (QFile::rename(oldPath, newPath)) {
     if (oldName == m_currentProfileName) {
+      // Later changes would otherwise recreate the file under the old name
+      openProfileSettings(newPath);
       m_currentProfileName = newName;
       saveGlobalSettings();
     }
@@ -1830,15 +1541,6 @@ void Config::clearProfileHotkey(const QString &profileName) {
   qDebug() << "Cleared hotkey for profile" << profileName;
 }
 
-bool Config::enableChatLogMonitoring() const {
-  return m_cachedEnableChatLogMonitoring;
-}
-
-void Config::setEnableChatLogMonitoring(bool enabled) {
-  m_settings->setValue(KEY_CHATLOG_ENABLE_MONITORING, enabled);
-  m_cachedEnableChatLogMonitoring = enabled;
-}
-
 QString Config::chatLogDirectory() const {
   return expandEnvironmentVariables(m_cachedChatLogDirectory);
 }
@@ -1846,7 +1548,7 @@ QString Config::chatLogDirectory() const {
 QString Config::chatLogDirectoryRaw() const { return m_cachedChatLogDirectory; }
 
 void Config::setChatLogDirectory(const QString &directory) {
-  m_settings->setValue(KEY_CHATLOG_DIRECTORY, directory);
+  writeValue(KEY_CHATLOG_DIRECTORY, directory);
   m_cachedChatLogDirectory = directory;
 }
 
@@ -1883,69 +1585,66 @@ QString Config::gameLogDirectory() const {
 QString Config::gameLogDirectoryRaw() const { return m_cachedGameLogDirectory; }
 
 void Config::setGameLogDirectory(const QString &directory) {
-  m_settings->setValue(KEY_GAMELOG_DIRECTORY, directory);
+  writeValue(KEY_GAMELOG_DIRECTORY, directory);
   m_cachedGameLogDirectory = directory;
 }
 
-bool Config::enableGameLogMonitoring() const {
-  return m_cachedEnableGameLogMonitoring;
-}
+QStringList Config::intelChannels() const { return m_cachedIntelChannels; }
 
-void Config::setEnableGameLogMonitoring(bool enabled) {
-  qDebug() << "Config::setEnableGameLogMonitoring called with:" << enabled;
-  m_settings->setValue(KEY_GAMELOG_ENABLE_MONITORING, enabled);
-  m_cachedEnableGameLogMonitoring = enabled;
-  qDebug() << "Config::setEnableGameLogMonitoring - cached value now:"
-           << m_cachedEnableGameLogMonitoring;
+void Config::setIntelChannels(const QStringList &channels) {
+  writeValue(KEY_LOG_INTEL_CHANNELS, channels);
+  m_cachedIntelChannels = channels;
 }
 
-bool Config::showCombatMessages() const { return m_cachedShowCombatMessages; }
-
-void Config::setShowCombatMessages(bool enabled) {
-  m_settings->setValue(KEY_COMBAT_ENABLED, enabled);
-  m_cachedShowCombatMessages = enabled;
+QVector<LogAlertRule> Config::logAlertRules() const {
+  return m_cachedLogAlertRules;
 }
 
-int Config::combatMessagePosition() const {
-  return m_cachedCombatMessagePosition;
-}
+void Config::setLogAlertRules(const QVector<LogAlertRule> &rules) {
+  // Same layout as QSettings::beginWriteArray(), which the writer has no
+  // equivalent of: 1-based index groups plus a size entry
+  removeValue(KEY_LOG_ALERT_RULES);
+  for (int i = 0; i < rules.size(); ++i) {
+    const LogAlertRule &rule = rules[i];
+    const QString prefix =
+        QString("%1/%2/").arg(KEY_LOG_ALERT_RULES).arg(i + 1);
+    writeValue(prefix + "name", rule.name);
+    writeValue(prefix + "pattern", rule.pattern);
+    writeValue(prefix + "regex", rule.isRegex);
+    writeValue(prefix + "channel",
+               rule.channel == LogAlertRule::ChatLog   ? "chat"
+               : rule.channel == LogAlertRule::GameLog ? "game"
+                                                       : "any");
+    writeValue(prefix + "color", rule.color);
+    writeValue(prefix + "enabled", rule.enabled);
+  }
+  writeValue(QString("%1/size").arg(KEY_LOG_ALERT_RULES), rules.size());
+
+  m_cachedLogAlertRules = rules;
+  m_cachedLogAlertColors.clear();
+  for (const LogAlertRule &rule : rules) {
+    if (rule.color.isValid()) {
+      m_cachedLogAlertColors[rule.eventType()] = rule.color;
+    }
+  }
 
-void Config::setCombatMessagePosition(int position) {
-  m_settings->setValue(KEY_COMBAT_POSITION, position);
-  m_cachedCombatMessagePosition = position;
+  // Alert colours are the fallback for combat border colours
+  publishSnapshot();
 }
 
 QFont Config::combatMessageFont() const { return m_cachedCombatMessageFont; }
 
 void Config::setCombatMessageFont(const QFont &font) {
-  m_settings->setValue(KEY_COMBAT_FONT, font);
+  writeValue(KEY_COMBAT_FONT, font);
   m_cachedCombatMessageFont = font;
 }
 
-int Config::combatMessageOffsetX() const {
-  return m_cachedCombatMessageOffsetX;
-}
-
-void Config::setCombatMessageOffsetX(int offset) {
-  m_settings->setValue(KEY_COMBAT_OFFSET_X, offset);
-  m_cachedCombatMessageOffsetX = offset;
-}
-
-int Config::combatMessageOffsetY() const {
-  return m_cachedCombatMessageOffsetY;
-}
-
-void Config::setCombatMessageOffsetY(int offset) {
-  m_settings->setValue(KEY_COMBAT_OFFSET_Y, offset);
-  m_cachedCombatMessageOffsetY = offset;
-}
-
 QStringList Config::enabledCombatEventTypes() const {
   return m_cachedEnabledCombatEventTypes;
 }
 
 void Config::setEnabledCombatEventTypes(const QStringList &types) {
-  m_settings->setValue(KEY_COMBAT_ENABLED_EVENT_TYPES, types);
+  writeValue(KEY_COMBAT_ENABLED_EVENT_TYPES, types);
   m_cachedEnabledCombatEventTypes = types;
 }
 
@@ -1954,26 +1653,27 @@ bool Config::isCombatEventTypeEnabled(const QString &eventType) const {
   return enabled.contains(eventType);
 }
 
-int Config::miningTimeoutSeconds() const {
-  return m_cachedMiningTimeoutSeconds;
-}
+QColor Config::combatEventColor(const QString &eventType) const {
+  auto it = m_cachedCombatEventColors.constFind(eventType);
+  if (it != m_cachedCombatEventColors.constEnd()) {
+    return it.value();
+  }
 
-void Config::setMiningTimeoutSeconds(int seconds) {
-  m_settings->setValue(KEY_MINING_TIMEOUT_SECONDS, seconds);
-  m_cachedMiningTimeoutSeconds = seconds;
-}
+  auto alertIt = m_cachedLogAlertColors.constFind(eventType);
+  if (alertIt != m_cachedLogAlertColors.constEnd()) {
+    return alertIt.value();
+  }
 
-QColor Config::combatEventColor(const QString &eventType) const {
-  return m_cachedCombatEventColors.value(
-      eventType, QColor(DEFAULT_EVENT_COLORS().value(
-                     eventType, DEFAULT_COMBAT_MESSAGE_COLOR)));
+  return QColor(
+      DEFAULT_EVENT_COLORS().value(eventType, DEFAULT_COMBAT_MESSAGE_COLOR));
 }
 
 void Config::setCombatEventColor(const QString &eventType,
                                  const QColor &color) {
   QString key = combatEventColorKey(eventType);
-  m_settings->setValue(key, color);
+  writeValue(key, color);
   m_cachedCombatEventColors[eventType] = color;
+  publishSnapshot();
 }
 
 int Config::combatEventDuration(const QString &eventType) const {
@@ -1984,7 +1684,7 @@ int Config::combatEventDuration(const QString &eventType) const {
 void Config::setCombatEventDuration(const QString &eventType,
                                     int milliseconds) {
   QString key = combatEventDurationKey(eventType);
-  m_settings->setValue(key, milliseconds);
+  writeValue(key, milliseconds);
   m_cachedCombatEventDurations[eventType] = milliseconds;
 }
 
@@ -1996,14 +1696,15 @@ bool Config::combatEventBorderHighlight(const QString &eventType) const {
 void Config::setCombatEventBorderHighlight(const QString &eventType,
                                            bool enabled) {
   QString key = combatEventBorderHighlightKey(eventType);
-  m_settings->setValue(key, enabled);
+  writeValue(key, enabled);
   m_cachedCombatEventBorderHighlights[eventType] = enabled;
+  publishSnapshot();
 }
 
 bool Config::combatEventSuppressFocused(const QString &eventType) const {
   if (!m_cachedCombatEventSuppressFocused.contains(eventType)) {
     QString key = combatEventSuppressFocusedKey(eventType);
-    bool value = m_settings->value(key, false).toBool();
+    bool value = m_values.value(key, false).toBool();
     m_cachedCombatEventSuppressFocused[eventType] = value;
   }
   return m_cachedCombatEventSuppressFocused.value(eventType, false);
@@ -2012,19 +1713,10 @@ bool Config::combatEventSuppressFocused(const QString &eventType) const {
 void Config::setCombatEventSuppressFocused(const QString &eventType,
                                            bool enabled) {
   QString key = combatEventSuppressFocusedKey(eventType);
-  m_settings->setValue(key, enabled);
+  writeValue(key, enabled);
   m_cachedCombatEventSuppressFocused[eventType] = enabled;
 }
 
-bool Config::suppressCombatWhenFocused() const {
-  return m_cachedSuppressCombatWhenFocused;
-}
-
-void Config::setSuppressCombatWhenFocused(bool enabled) {
-  m_settings->setValue(KEY_COMBAT_SUPPRESS_FOCUSED, enabled);
-  m_cachedSuppressCombatWhenFocused = enabled;
-}
-
 BorderStyle Config::combatBorderStyle(const QString &eventType) const {
   return m_cachedCombatBorderStyles.value(
       eventType, static_cast<BorderStyle>(DEFAULT_COMBAT_BORDER_STYLE));
@@ -2032,8 +1724,9 @@ BorderStyle Config::combatBorderStyle(const QString &eventType) const {
 
 void Config::setCombatBorderStyle(const QString &eventType, BorderStyle style) {
   QString key = combatBorderStyleKey(eventType);
-  m_settings->setValue(key, static_cast<int>(style));
+  writeValue(key, static_cast<int>(style));
   m_cachedCombatBorderStyles[eventType] = style;
+  publishSnapshot();
 }
 
 bool Config::combatEventSoundEnabled(const QString &eventType) const {
@@ -2044,7 +1737,7 @@ bool Config::combatEventSoundEnabled(const QString &eventType) const {
 void Config::setCombatEventSoundEnabled(const QString &eventType,
                                         bool enabled) {
   QString key = combatEventSoundEnabledKey(eventType);
-  m_settings->setValue(key, enabled);
+  writeValue(key, enabled);
   m_cachedCombatEventSoundsEnabled[eventType] = enabled;
 }
 
@@ -2055,7 +1748,7 @@ QString Config::combatEventSoundFile(const QString &eventType) const {
 void Config::setCombatEventSoundFile(const QString &eventType,
                                      const QString &filePath) {
   QString key = combatEventSoundFileKey(eventType);
-  m_settings->setValue(key, filePath);
+  writeValue(key, filePath);
   m_cachedCombatEventSoundFiles[eventType] = filePath;
 }
 
@@ -2066,6 +1759,6 @@ int Config::combatEventSoundVolume(const QString &eventType) const {
 
 void Config::setCombatEventSoundVolume(const QString &eventType, int volume) {
   QString key = combatEventSoundVolumeKey(eventType);
-  m_settings->setValue(key, volume);
+  writeValue(key, volume);
   m_cachedCombatEventSoundVolumes[eventType] = volume;
 }
@@ -10,6 +10,7 @@
 #include <Psapi.h>
 #include <QColorDialog>
 #include <QDesktopServices>
+#include <QFile>
 #include <QFileDialog>
 #include <QFontDialog>
 #include <QFrame>
@@ -2615,8 +2616,208 @@ void ConfigDialog::createDataSourcesPage() {
             m_gameLogBrowseButton->setEnabled(checked);
           });
 
+  m_eventDrivenLogMonitoringCheck =
+      new QCheckBox("React to log file changes immediately");
+  m_eventDrivenLogMonitoringCheck->setStyleSheet(
+      StyleSheet::getCheckBoxStyleSheet());
+  m_eventDrivenLogMonitoringCheck->setToolTip(
+      "Read new log lines as soon as the file system reports a change "
+      "instead of waiting for the next poll. Polling is kept as a fallback.");
+  logSectionLayout->addWidget(m_eventDrivenLogMonitoringCheck);
+
+  m_batchedLogEventDeliveryCheck =
+      new QCheckBox("Deliver log events in batches");
+  m_batchedLogEventDeliveryCheck->setStyleSheet(
+      StyleSheet::getCheckBoxStyleSheet());
+  m_batchedLogEventDeliveryCheck->setToolTip(
+      "Hand all events found in one read to the interface at once, so that "
+      "mass jumps and fleet warps update thumbnails in a single pass.");
+  logSectionLayout->addWidget(m_batchedLogEventDeliveryCheck);
+
+  m_combatDamageTrackingCheck =
+      new QCheckBox("Show damage per second from combat logs");
+  m_combatDamageTrackingCheck->setStyleSheet(
+      StyleSheet::getCheckBoxStyleSheet());
+  m_combatDamageTrackingCheck->setToolTip(
+      "Read damage dealt and received from game log combat lines and show "
+      "the rate over the last 5 and 60 seconds on each thumbnail.");
+  logSectionLayout->addWidget(m_combatDamageTrackingCheck);
+
+  QHBoxLayout *workerCountLayout = new QHBoxLayout();
+  m_logWorkerCountLabel = new QLabel("Log reader threads:");
+  m_logWorkerCountLabel->setStyleSheet(StyleSheet::getLabelStyleSheet());
+  m_logWorkerCountLabel->setFixedWidth(150);
+  m_logWorkerCountLabel->setToolTip(
+      "Split characters across several reader threads so that one slow log "
+      "file does not delay updates for everyone else. Useful for large "
+      "multibox setups.");
+
+  m_logWorkerCountSpin = new QSpinBox();
+  m_logWorkerCountSpin->setStyleSheet(StyleSheet::getSpinBoxStyleSheet());
+  m_logWorkerCountSpin->setRange(Config::LOG_WORKER_COUNT_MIN,
+                                 Config::LOG_WORKER_COUNT_MAX);
+  m_logWorkerCountSpin->setFixedWidth(100);
+
+  workerCountLayout->addWidget(m_logWorkerCountLabel);
+  workerCountLayout->addWidget(m_logWorkerCountSpin);
+  workerCountLayout->addStretch();
+  logSectionLayout->addLayout(workerCountLayout);
+
+  QHBoxLayout *statsDumpLayout = new QHBoxLayout();
+  m_logStatsDumpLabel = new QLabel("Write reader statistics:");
+  m_logStatsDumpLabel->setStyleSheet(StyleSheet::getLabelStyleSheet());
+  m_logStatsDumpLabel->setFixedWidth(150);
+  m_logStatsDumpLabel->setToolTip(
+      "Periodically append log reader performance counters to "
+      "profiles/logstats.csv for troubleshooting delayed updates.");
+
+  m_logStatsDumpSpin = new QSpinBox();
+  m_logStatsDumpSpin->setStyleSheet(StyleSheet::getSpinBoxStyleSheet());
+  m_logStatsDumpSpin->setRange(0, 3600);
+  m_logStatsDumpSpin->setSingleStep(10);
+  m_logStatsDumpSpin->setSuffix(" sec");
+  m_logStatsDumpSpin->setSpecialValueText("Off");
+  m_logStatsDumpSpin->setFixedWidth(100);
+
+  statsDumpLayout->addWidget(m_logStatsDumpLabel);
+  statsDumpLayout->addWidget(m_logStatsDumpSpin);
+  statsDumpLayout->addStretch();
+  logSectionLayout->addLayout(statsDumpLayout);
+
+  QHBoxLayout *intelChannelsLayout = new QHBoxLayout();
+  m_intelChannelsLabel = new QLabel("Intel channels:");
+  m_intelChannelsLabel->setStyleSheet(StyleSheet::getLabelStyleSheet());
+  m_intelChannelsLabel->setFixedWidth(150);
+  m_intelChannelsLabel->setToolTip(
+      "Chat channels whose messages are searched for solar system names. "
+      "Reports are shown on the thumbnails of characters in that system.");
+
+  m_intelChannelsEdit = new QLineEdit();
+  m_intelChannelsEdit->setStyleSheet(
+      StyleSheet::getDialogLineEditStyleSheet());
+  m_intelChannelsEdit->setPlaceholderText(
+      "Comma separated, e.g. Delve.Intel, Querious.Intel");
+
+  intelChannelsLayout->addWidget(m_intelChannelsLabel);
+  intelChannelsLayout->addWidget(m_intelChannelsEdit, 1);
+  logSectionLayout->addLayout(intelChannelsLayout);
+
+  QHBoxLayout *intelRangeLayout = new QHBoxLayout();
+  m_intelAlertJumpsLabel = new QLabel("Intel alert range:");
+  m_intelAlertJumpsLabel->setStyleSheet(StyleSheet::getLabelStyleSheet());
+  m_intelAlertJumpsLabel->setFixedWidth(150);
+  m_intelAlertJumpsLabel->setToolTip(
+      "Also show intel on characters up to this many stargate jumps away "
+      "from the reported system.");
+
+  m_intelAlertJumpsSpin = new QSpinBox();
+  m_intelAlertJumpsSpin->setStyleSheet(StyleSheet::getSpinBoxStyleSheet());
+  m_intelAlertJumpsSpin->setRange(0, 20);
+  m_intelAlertJumpsSpin->setSuffix(" jumps");
+  m_intelAlertJumpsSpin->setSpecialValueText("Same system");
+  m_intelAlertJumpsSpin->setFixedWidth(100);
+
+  intelRangeLayout->addWidget(m_intelAlertJumpsLabel);
+  intelRangeLayout->addWidget(m_intelAlertJumpsSpin);
+  intelRangeLayout->addStretch();
+  logSectionLayout->addLayout(intelRangeLayout);
+
+#ifdef MAP_DATA_SAMPLE
+  // Built without the static data export: the bundled system and gate
+  // lists only cover the area around Jita
+  const QString profilesDirectory = Config::instance().getProfilesDirectory();
+  if (!QFile::exists(profilesDirectory + "/solarsystems.txt") ||
+      !QFile::exists(profilesDirectory + "/stargates.txt")) {
+    QLabel *intelMapInfoLabel = new QLabel(
+        "Only a sample map around Jita is included, so intel about other "
+        "systems is not recognized and jump ranges end at its edge. To cover "
+        "all of New Eden, place solarsystems.txt and stargates.txt exported "
+        "from the EVE static data in the profiles folder.");
+    intelMapInfoLabel->setStyleSheet(StyleSheet::getInfoLabelStyleSheet());
+    intelMapInfoLabel->setWordWrap(true);
+    logSectionLayout->addWidget(intelMapInfoLabel);
+  }
+#endif
+
+  QHBoxLayout *maxEventAgeLayout = new QHBoxLayout();
+  m_logMaxEventAgeLabel = new QLabel("Ignore alerts older than:");
+  m_logMaxEventAgeLabel->setStyleSheet(StyleSheet::getLabelStyleSheet());
+  m_logMaxEventAgeLabel->setFixedWidth(150);
+  m_logMaxEventAgeLabel->setToolTip(
+      "While catching up on a log, e.g. after it was attached or "
+      "truncated, lines older than the newest line read by more than this "
+      "do not show event or intel messages. Live lines are always shown, "
+      "and so are system changes.");
+
+  m_logMaxEventAgeSpin = new QSpinBox();
+  m_logMaxEventAgeSpin->setStyleSheet(StyleSheet::getSpinBoxStyleSheet());
+  m_logMaxEventAgeSpin->setRange(0, 3600);
+  m_logMaxEventAgeSpin->setSingleStep(10);
+  m_logMaxEventAgeSpin->setSuffix(" sec");
+  m_logMaxEventAgeSpin->setSpecialValueText("Never");
+  m_logMaxEventAgeSpin->setFixedWidth(100);
+
+  maxEventAgeLayout->addWidget(m_logMaxEventAgeLabel);
+  maxEventAgeLayout->addWidget(m_logMaxEventAgeSpin);
+  maxEventAgeLayout->addStretch();
+  logSectionLayout->addLayout(maxEventAgeLayout);
+
   layout->addWidget(logMonitoringSection);
 
+  QWidget *alertRulesSection = new QWidget();
+  alertRulesSection->setStyleSheet(StyleSheet::getSectionStyleSheet());
+  QVBoxLayout *alertRulesSectionLayout = new QVBoxLayout(alertRulesSection);
+  alertRulesSectionLayout->setContentsMargins(16, 12, 16, 12);
+  alertRulesSectionLayout->setSpacing(10);
+
+  tagWidget(alertRulesSection,
+            {"alert", "rule", "pattern", "regex", "keyword", "log", "custom"});
+
+  QLabel *alertRulesHeader = new QLabel("Log Alert Rules");
+  alertRulesHeader->setStyleSheet(StyleSheet::getSectionHeaderStyleSheet());
+  alertRulesSectionLayout->addWidget(alertRulesHeader);
+
+  QLabel *alertRulesInfoLabel = new QLabel(
+      "Show an event message on a character's thumbnail when one of its log "
+      "lines contains the given text. Text is matched ignoring case; check "
+      "Regex to use a regular expression instead. Matches use the rule's "
+      "color and are shown as combat log events.");
+  alertRulesInfoLabel->setStyleSheet(StyleSheet::getInfoLabelStyleSheet());
+  alertRulesInfoLabel->setWordWrap(true);
+  alertRulesSectionLayout->addWidget(alertRulesInfoLabel);
+
+  m_logAlertRulesScrollArea = new QScrollArea();
+  m_logAlertRulesScrollArea->setWidgetResizable(true);
+  m_logAlertRulesScrollArea->setHorizontalScrollBarPolicy(
+      Qt::ScrollBarAlwaysOff);
+  m_logAlertRulesScrollArea->setVerticalScrollBarPolicy(
+      Qt::ScrollBarAsNeeded);
+  m_logAlertRulesScrollArea->setStyleSheet(
+      "QScrollArea { border: none; background-color: transparent; }");
+
+  m_logAlertRulesContainer = new QWidget();
+  m_logAlertRulesLayout = new QVBoxLayout(m_logAlertRulesContainer);
+  m_logAlertRulesLayout->setContentsMargins(4, 4, 4, 4);
+  m_logAlertRulesLayout->setSpacing(6);
+  m_logAlertRulesLayout->addStretch();
+
+  m_logAlertRulesScrollArea->setWidget(m_logAlertRulesContainer);
+  alertRulesSectionLayout->addWidget(m_logAlertRulesScrollArea);
+
+  updateLogAlertRulesScrollHeight();
+
+  QHBoxLayout *alertRulesButtonLayout = new QHBoxLayout();
+  m_addLogAlertRuleButton = new QPushButton("Add Rule");
+  m_addLogAlertRuleButton->setStyleSheet(
+      StyleSheet::getSecondaryButtonStyleSheet());
+  connect(m_addLogAlertRuleButton, &QPushButton::clicked, this,
+          &ConfigDialog::onAddLogAlertRule);
+  alertRulesButtonLayout->addWidget(m_addLogAlertRuleButton);
+  alertRulesButtonLayout->addStretch();
+  alertRulesSectionLayout->addLayout(alertRulesButtonLayout);
+
+  layout->addWidget(alertRulesSection);
+
   // Combat Log Events Section with Tabs
   QWidget *combatSection = new QWidget();
   combatSection->setStyleSheet(StyleSheet::getSectionStyleSheet());
@@ -2644,6 +2845,16 @@ void ConfigDialog::createDataSourcesPage() {
   m_showCombatMessagesCheck->setStyleSheet(StyleSheet::getCheckBoxStyleSheet());
   combatSectionLayout->addWidget(m_showCombatMessagesCheck);
 
+  m_correlateFleetEventsCheck =
+      new QCheckBox("Combine fleet-wide events across characters");
+  m_correlateFleetEventsCheck->setStyleSheet(
+      StyleSheet::getCheckBoxStyleSheet());
+  m_correlateFleetEventsCheck->setToolTip(
+      "When the same event (e.g. a fleet warp or regroup) shows up for "
+      "several characters at once, play its sound only once and let the "
+      "messages on all thumbnails expire together.");
+  combatSectionLayout->addWidget(m_correlateFleetEventsCheck);
+
   // Global settings
   QHBoxLayout *positionLayout = new QHBoxLayout();
   positionLayout->setContentsMargins(0, 0, 0, 0);
@@ -3415,6 +3626,7 @@ void ConfigDialog::createDataSourcesPage() {
         m_combatEventCrystalBrokeCheck->setEnabled(checked);
         m_combatEventConvoRequestCheck->setEnabled(checked);
         m_combatEventMiningStopCheck->setEnabled(checked);
+        m_correlateFleetEventsCheck->setEnabled(checked);
 
         bool miningStopChecked = m_combatEventMiningStopCheck->isChecked();
         m_miningTimeoutSpin->setEnabled(checked && miningStopChecked);
@@ -4061,11 +4273,59 @@ void ConfigDialog::setupBindings() {
       [&config](bool value) { config.setEnableGameLogMonitoring(value); },
       false));
 
+  m_bindingManager.addBinding(BindingHelpers::bindCheckBox(
+      m_eventDrivenLogMonitoringCheck,
+      [&config]() { return config.eventDrivenLogMonitoring(); },
+      [&config](bool value) { config.setEventDrivenLogMonitoring(value); },
+      Config::DEFAULT_LOG_EVENT_DRIVEN_MONITORING));
+
+  m_bindingManager.addBinding(BindingHelpers::bindCheckBox(
+      m_combatDamageTrackingCheck,
+      [&config]() { return config.combatDamageTracking(); },
+      [&config](bool value) { config.setCombatDamageTracking(value); },
+      Config::DEFAULT_COMBAT_DAMAGE_TRACKING));
+
+  m_bindingManager.addBinding(BindingHelpers::bindCheckBox(
+      m_batchedLogEventDeliveryCheck,
+      [&config]() { return config.batchedLogEventDelivery(); },
+      [&config](bool value) { config.setBatchedLogEventDelivery(value); },
+      Config::DEFAULT_LOG_BATCHED_DELIVERY));
+
+  m_bindingManager.addBinding(BindingHelpers::bindSpinBox(
+      m_logWorkerCountSpin,
+      [&config]() { return config.logWorkerCount(); },
+      [&config](int value) { config.setLogWorkerCount(value); },
+      Config::DEFAULT_LOG_WORKER_COUNT));
+
+  m_bindingManager.addBinding(BindingHelpers::bindSpinBox(
+      m_logStatsDumpSpin,
+      [&config]() { return config.logStatsDumpIntervalSeconds(); },
+      [&config](int value) { config.setLogStatsDumpIntervalSeconds(value); },
+      Config::DEFAULT_LOG_STATS_DUMP_INTERVAL_SECONDS));
+
+  m_bindingManager.addBinding(BindingHelpers::bindSpinBox(
+      m_intelAlertJumpsSpin,
+      [&config]() { return config.intelAlertJumps(); },
+      [&config](int value) { config.setIntelAlertJumps(value); },
+      Config::DEFAULT_INTEL_ALERT_JUMPS));
+
+  m_bindingManager.addBinding(BindingHelpers::bindSpinBox(
+      m_logMaxEventAgeSpin,
+      [&config]() { return config.logMaxEventAgeSeconds(); },
+      [&config](int value) { config.setLogMaxEventAgeSeconds(value); },
+      Config::DEFAULT_LOG_MAX_EVENT_AGE_SECONDS));
+
   m_bindingManager.addBinding(BindingHelpers::bindCheckBox(
       m_showCombatMessagesCheck,
       [&config]() { return config.showCombatMessages(); },
       [&config](bool value) { config.setShowCombatMessages(value); }, true));
 
+  m_bindingManager.addBinding(BindingHelpers::bindCheckBox(
+      m_correlateFleetEventsCheck,
+      [&config]() { return config.correlateFleetEvents(); },
+      [&config](bool value) { config.setCorrelateFleetEvents(value); },
+      Config::DEFAULT_COMBAT_CORRELATE_FLEET_EVENTS));
+
   m_bindingManager.addBinding(BindingHelpers::bindComboBox(
       m_combatMessagePositionCombo,
       [&config]() { return config.combatMessagePosition(); },
@@ -4372,6 +4632,26 @@ void ConfigDialog::loadSettings() {
 
   m_gameLogDirectoryEdit->setText(config.gameLogDirectoryRaw());
 
+  m_intelChannelsEdit->setText(config.intelChannels().join(", "));
+
+  while (m_logAlertRulesLayout->count() > 1) {
+    QLayoutItem *item = m_logAlertRulesLayout->takeAt(0);
+    if (item->widget()) {
+      QWidget *widget = item->widget();
+      widget->setParent(nullptr);
+      delete widget;
+    }
+    delete item;
+  }
+
+  for (const LogAlertRule &rule : config.logAlertRules()) {
+    QWidget *formRow = createLogAlertRuleFormRow(rule);
+    int count = m_logAlertRulesLayout->count();
+    m_logAlertRulesLayout->insertWidget(count - 1, formRow);
+  }
+
+  updateLogAlertRulesScrollHeight();
+
   for (auto it = m_eventColorButtons.constBegin();
        it != m_eventColorButtons.constEnd(); ++it) {
     QString eventType = it.key();
@@ -5023,6 +5303,49 @@ void ConfigDialog::saveSettings() {
   Config::instance().setGameLogDirectory(
       m_gameLogDirectoryEdit->text().trimmed());
 
+  QStringList intelChannels;
+  for (const QString &channel : m_intelChannelsEdit->text().split(',')) {
+    if (!channel.trimmed().isEmpty()) {
+      intelChannels.append(channel.trimmed());
+    }
+  }
+  Config::instance().setIntelChannels(intelChannels);
+
+  QVector<LogAlertRule> logAlertRules;
+  for (int i = 0; i < m_logAlertRulesLayout->count() - 1; ++i) {
+    QWidget *rowWidget =
+        qobject_cast<QWidget *>(m_logAlertRulesLayout->itemAt(i)->widget());
+    if (!rowWidget)
+      continue;
+
+    // Widgets in creation order: enabled and regex checkboxes, name and
+    // pattern edits
+    QList<QCheckBox *> checkBoxes = rowWidget->findChildren<QCheckBox *>();
+    QList<QLineEdit *> lineEdits = rowWidget->findChildren<QLineEdit *>();
+    QComboBox *channelCombo = rowWidget->findChild<QComboBox *>();
+    if (checkBoxes.size() < 2 || lineEdits.size() < 2 || !channelCombo)
+      continue;
+
+    LogAlertRule rule;
+    rule.enabled = checkBoxes[0]->isChecked();
+    rule.name = lineEdits[0]->text().trimmed();
+    rule.pattern = lineEdits[1]->text();
+    rule.isRegex = checkBoxes[1]->isChecked();
+    rule.channel =
+        static_cast<LogAlertRule::Channel>(channelCombo->currentData().toInt());
+    for (QPushButton *btn : rowWidget->findChildren<QPushButton *>()) {
+      if (btn->property("color").isValid()) {
+        rule.color = btn->property("color").value<QColor>();
+      }
+    }
+
+    if (rule.name.isEmpty() || rule.pattern.isEmpty())
+      continue;
+
+    logAlertRules.append(rule);
+  }
+  Config::instance().setLogAlertRules(logAlertRules);
+
   Config &cfg = Config::instance();
 
   QHash<QString, QSize> existingSizes = cfg.getAllCustomThumbnailSizes();
@@ -6257,6 +6580,111 @@ QWidget *ConfigDialog::createCharacterColorFormRow(const QString &characterName,
   return rowWidget;
 }
 
+QWidget *ConfigDialog::createLogAlertRuleFormRow(const LogAlertRule &rule) {
+  QWidget *rowWidget = new QWidget();
+  rowWidget->setStyleSheet(
+      "QWidget { background-color: #2a2a2a; border: 1px solid #3a3a3a; "
+      "border-radius: 4px; padding: 4px; }");
+
+  QHBoxLayout *rowLayout = new QHBoxLayout(rowWidget);
+  rowLayout->setContentsMargins(8, 4, 8, 4);
+  rowLayout->setSpacing(8);
+
+  QCheckBox *enabledCheck = new QCheckBox();
+  enabledCheck->setChecked(rule.enabled);
+  enabledCheck->setStyleSheet(StyleSheet::getCheckBoxStyleSheet());
+  enabledCheck->setToolTip("Check lines against this rule");
+  rowLayout->addWidget(enabledCheck);
+
+  QLineEdit *nameEdit = new QLineEdit();
+  nameEdit->setText(rule.name);
+  nameEdit->setPlaceholderText("Name");
+  nameEdit->setStyleSheet(StyleSheet::getTableCellEditorStyleSheet());
+  nameEdit->setMaximumWidth(120);
+  rowLayout->addWidget(nameEdit);
+
+  QLineEdit *patternEdit = new QLineEdit();
+  patternEdit->setText(rule.pattern);
+  patternEdit->setPlaceholderText("Text to look for");
+  patternEdit->setStyleSheet(StyleSheet::getTableCellEditorStyleSheet());
+  rowLayout->addWidget(patternEdit, 1);
+
+  QCheckBox *regexCheck = new QCheckBox("Regex");
+  regexCheck->setChecked(rule.isRegex);
+  regexCheck->setStyleSheet(StyleSheet::getCheckBoxStyleSheet());
+  rowLayout->addWidget(regexCheck);
+
+  QComboBox *channelCombo = new QComboBox();
+  channelCombo->setStyleSheet(StyleSheet::getComboBoxStyleSheet());
+  channelCombo->addItem("Any log", LogAlertRule::AnyLog);
+  channelCombo->addItem("Chat logs", LogAlertRule::ChatLog);
+  channelCombo->addItem("Game logs", LogAlertRule::GameLog);
+  channelCombo->setCurrentIndex(channelCombo->findData(rule.channel));
+  rowLayout->addWidget(channelCombo);
+
+  const QColor color = rule.color.isValid() ? rule.color : QColor("#FFA500");
+  QPushButton *colorButton = new QPushButton("Color");
+  colorButton->setFixedSize(80, 32);
+  colorButton->setCursor(Qt::PointingHandCursor);
+  colorButton->setProperty("color", color);
+  updateColorButton(colorButton, color);
+  connect(colorButton, &QPushButton::clicked, this, [this, colorButton]() {
+    QColor newColor = QColorDialog::getColor(
+        colorButton->property("color").value<QColor>(), this,
+        "Select Alert Color");
+    if (newColor.isValid()) {
+      colorButton->setProperty("color", newColor);
+      updateColorButton(colorButton, newColor);
+    }
+  });
+  rowLayout->addWidget(colorButton);
+
+  QPushButton *deleteButton = new QPushButton("×");
+  deleteButton->setFixedSize(32, 32);
+  deleteButton->setStyleSheet("QPushButton {"
+                              "    background-color: #3a3a3a;"
+                              "    color: #ffffff;"
+                              "    border: 1px solid #555555;"
+                              "    border-radius: 4px;"
+                              "    font-size: 18px;"
+                              "    font-weight: bold;"
+                              "    padding: 0px;"
+                              "}"
+                              "QPushButton:hover {"
+                              "    background-color: #e74c3c;"
+                              "    border: 1px solid #c0392b;"
+                              "}"
+                              "QPushButton:pressed {"
+                              "    background-color: #c0392b;"
+                              "}");
+  deleteButton->setToolTip("Remove this rule");
+  deleteButton->setCursor(Qt::PointingHandCursor);
+
+  connect(deleteButton, &QPushButton::clicked, this, [this, rowWidget]() {
+    m_logAlertRulesLayout->removeWidget(rowWidget);
+    rowWidget->deleteLater();
+    QTimer::singleShot(0, this, &ConfigDialog::updateLogAlertRulesScrollHeight);
+  });
+
+  rowLayout->addWidget(deleteButton);
+
+  return rowWidget;
+}
+
+void ConfigDialog::updateLogAlertRulesScrollHeight() {
+  if (m_logAlertRulesScrollArea && m_logAlertRulesLayout) {
+    int rowCount = m_logAlertRulesLayout->count() - 1;
+
+    if (rowCount <= 0) {
+      m_logAlertRulesScrollArea->setFixedHeight(10);
+    } else {
+      int calculatedHeight = (rowCount * 48) + 10;
+      int finalHeight = qMin(202, qMax(50, calculatedHeight));
+      m_logAlertRulesScrollArea->setFixedHeight(finalHeight);
+    }
+  }
+}
+
 void ConfigDialog::updateCharacterColorsScrollHeight() {
   if (m_characterColorsScrollArea && m_characterColorsLayout) {
     int rowCount = m_characterColorsLayout->count() - 1;
@@ -7217,6 +7645,28 @@ void ConfigDialog::onPopulateHiddenCharacters() {
   }
 }
 
+void ConfigDialog::onAddLogAlertRule() {
+  QWidget *formRow = createLogAlertRuleFormRow();
+
+  int count = m_logAlertRulesLayout->count();
+  m_logAlertRulesLayout->insertWidget(count - 1, formRow);
+
+  m_logAlertRulesContainer->updateGeometry();
+  m_logAlertRulesLayout->activate();
+
+  QLineEdit *nameEdit = formRow->findChild<QLineEdit *>();
+  if (nameEdit) {
+    nameEdit->setFocus();
+  }
+
+  updateLogAlertRulesScrollHeight();
+
+  QTimer::singleShot(0, [this]() {
+    m_logAlertRulesScrollArea->verticalScrollBar()->setValue(
+        m_logAlertRulesScrollArea->verticalScrollBar()->maximum());
+  });
+}
+
 void ConfigDialog::onAddCharacterColor() {
   QWidget *formRow = createCharacterColorFormRow();
 
@@ -8402,6 +8852,8 @@ void ConfigDialog::onResetCombatMessagesDefaults() {
   if (msgBox.exec() == QMessageBox::Yes) {
     m_showCombatMessagesCheck->setChecked(
         Config::DEFAULT_COMBAT_MESSAGES_ENABLED);
+    m_correlateFleetEventsCheck->setChecked(
+        Config::DEFAULT_COMBAT_CORRELATE_FLEET_EVENTS);
 
     m_combatMessagePositionCombo->setCurrentIndex(
         Config::DEFAULT_COMBAT_MESSAGE_POSITION);
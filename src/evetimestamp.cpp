@@ -0,0 +1,81 @@
+#include "evetimestamp.h"
+#include <QDate>
+
+namespace {
+
+/// Value of count decimal digits starting at p, or -1
+inline int readDigits(const QChar *p, int count) {
+  int value = 0;
+  for (int i = 0; i < count; ++i) {
+    const char16_t c = p[i].unicode();
+    if (c < '0' || c > '9') {
+      return -1;
+    }
+    value = value * 10 + (c - '0');
+  }
+  return value;
+}
+
+/// Days between 1970-01-01 and a valid proleptic Gregorian date
+constexpr qint64 daysFromCivil(int year, int month, int day) {
+  year -= month <= 2 ? 1 : 0;
+  const int era = (year >= 0 ? year : year - 399) / 400;
+  const int yearOfEra = year - era * 400;
+  const int dayOfYear =
+      (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+  const int dayOfEra =
+      yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+  return qint64(era) * 146097 + dayOfEra - 719468;
+}
+
+static_assert(daysFromCivil(1970, 1, 1) == 0);
+static_assert(daysFromCivil(2000, 3, 1) == 11017);
+
+} // namespace
+
+qint64 EveTimestamp::parse(QStringView text) {
+  if (text.size() != LENGTH) {
+    return -1;
+  }
+
+  const QChar *p = text.data();
+  if (p[4] != '.' || p[7] != '.' || p[10] != ' ' || p[13] != ':' ||
+      p[16] != ':') {
+    return -1;
+  }
+
+  const int year = readDigits(p, 4);
+  const int month = readDigits(p + 5, 2);
+  const int day = readDigits(p + 8, 2);
+  const int hour = readDigits(p + 11, 2);
+  const int minute = readDigits(p + 14, 2);
+  const int second = readDigits(p + 17, 2);
+
+  if (year < 2000 || year > 2100 || !QDate::isValid(year, month, day) ||
+      hour < 0 || hour > 23 || minute < 0 || minute > 59 || second < 0 ||
+      second > 59) {
+    return -1;
+  }
+
+  const qint64 seconds =
+      ((daysFromCivil(year, month, day) * 24 + hour) * 60 + minute) * 60 +
+      second;
+  return seconds * 1000;
+}
+
+qint64 EveTimestamp::parseLine(QStringView line) {
+  // Chat log lines start with a byte order mark
+  qsizetype pos = 0;
+  if (pos < line.size() && line[pos] == QChar(0xFEFF)) {
+    ++pos;
+  }
+  if (pos >= line.size() || line[pos] != '[') {
+    return -1;
+  }
+  ++pos;
+  while (pos < line.size() && line[pos] == ' ') {
+    ++pos;
+  }
+
+  return parse(line.mid(pos, LENGTH));
+}
@@ -2,12 +2,25 @@
 #include "config.h"
 #include "hookthread.h"
 #include "windowcapture.h"
+#include "settingsmap.h"
 #include <Psapi.h>
-#include <QSettings>
 #include <QStringList>
 
 #define WM_MOUSEBUTTON_HOTKEY (WM_USER + 1)
 
+namespace {
+
+/// Whether the two groups register the same hotkeys; the rest of a group is
+/// read when one of them is pressed
+bool sameBindings(const CycleGroup &a, const CycleGroup &b) {
+  return a.forwardBindings == b.forwardBindings &&
+         a.backwardBindings == b.backwardBindings &&
+         a.forwardBinding == b.forwardBinding &&
+         a.backwardBinding == b.backwardBinding;
+}
+
+} // namespace
+
 QPointer<HotkeyManager> HotkeyManager::s_instance;
 HHOOK HotkeyManager::s_mouseHook = nullptr;
 
@@ -143,19 +156,46 @@ void HotkeyManager::unregisterAndReset(int &hotkeyId) {
   }
 }
 
-void HotkeyManager::saveHotkeyList(QSettings &settings, const QString &key,
+void HotkeyManager::updateHotkeyList(
+    const QVector<HotkeyBinding> &oldHotkeys,
+    const QVector<HotkeyBinding> &multiHotkeys, QSet<int> &hotkeyIds,
+    bool allowWildcard) {
+  if (multiHotkeys == oldHotkeys) {
+    return;
+  }
+  unregisterHotkeyIds(hotkeyIds);
+  registerHotkeyList(multiHotkeys, hotkeyIds, allowWildcard);
+}
+
+void HotkeyManager::unregisterHotkeyIds(const QSet<int> &hotkeyIds) {
+  for (int hotkeyId : hotkeyIds) {
+    if (hotkeyId != -1) {
+      unregisterHotkey(hotkeyId);
+    }
+  }
+
+  for (auto it = m_wildcardAliases.begin(); it != m_wildcardAliases.end();) {
+    if (hotkeyIds.contains(it.value())) {
+      unregisterHotkey(it.key());
+      it = m_wildcardAliases.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+void HotkeyManager::saveHotkeyList(const QString &key,
                                    const QVector<HotkeyBinding> &multiHotkeys) {
-  settings.remove(key);
   QStringList bindingStrs;
   for (const HotkeyBinding &binding : multiHotkeys) {
     bindingStrs.append(binding.toString());
   }
-  settings.setValue(key, bindingStrs.join('|'));
+  Config::instance().writeValue(key, bindingStrs.join('|'));
 }
 
-QVector<HotkeyBinding> HotkeyManager::loadHotkeyList(QSettings &settings,
+QVector<HotkeyBinding> HotkeyManager::loadHotkeyList(const SettingsMap &values,
                                                      const QString &key) {
-  QString value = settings.value(key, QString()).toString();
+  QString value = values.value(key, QString()).toString();
   QVector<HotkeyBinding> result;
 
   QStringList bindingStrs = value.split('|', Qt::SkipEmptyParts);
@@ -177,6 +217,7 @@ bool HotkeyManager::registerHotkeys() {
   m_hotkeyIdToCharacters.clear();
   m_hotkeyIdToCycleGroup.clear();
   m_hotkeyIdIsForward.clear();
+  m_registeredWildcard = Config::instance().wildcardHotkeys();
 
   // Clear mouse button hash maps
   m_mouseButtonToCharacter.clear();
@@ -197,6 +238,50 @@ bool HotkeyManager::registerHotkeys() {
     return true;
   }
 
+  const QHash<HotkeyBinding, QVector<QString>> bindingToCharacters =
+      characterBindings();
+  for (auto it = bindingToCharacters.begin(); it != bindingToCharacters.end();
+       ++it) {
+    registerCharacterBinding(it.key(), it.value());
+  }
+
+  for (auto it = m_cycleGroups.begin(); it != m_cycleGroups.end(); ++it) {
+    registerCycleGroup(it.key(), it.value());
+  }
+
+  registerHotkeyList(m_notLoggedInForwardHotkeys,
+                     m_notLoggedInForwardHotkeyIds);
+  registerHotkeyList(m_notLoggedInBackwardHotkeys,
+                     m_notLoggedInBackwardHotkeyIds);
+
+  registerHotkeyList(m_nonEVEForwardHotkeys, m_nonEVEForwardHotkeyIds);
+  registerHotkeyList(m_nonEVEBackwardHotkeys, m_nonEVEBackwardHotkeyIds);
+
+  registerHotkeyList(m_closeAllClientsHotkeys, m_closeAllClientsHotkeyIds,
+                     false);
+
+  registerHotkeyList(m_minimizeAllClientsHotkeys, m_minimizeAllClientsHotkeyIds,
+                     false);
+
+  registerHotkeyList(m_toggleThumbnailsVisibilityHotkeys,
+                     m_toggleThumbnailsVisibilityHotkeyIds, false);
+
+  registerHotkeyList(m_cycleProfileForwardHotkeys,
+                     m_cycleProfileForwardHotkeyIds, false);
+  registerHotkeyList(m_cycleProfileBackwardHotkeys,
+                     m_cycleProfileBackwardHotkeyIds, false);
+
+  registerProfileHotkeys();
+
+  if (hasMouseButtonHotkeys()) {
+    installMouseHook();
+  }
+
+  return true;
+}
+
+QHash<HotkeyBinding, QVector<QString>>
+HotkeyManager::characterBindings() const {
   QHash<HotkeyBinding, QVector<QString>> bindingToCharacters;
 
   for (auto it = m_characterMultiHotkeys.begin();
@@ -226,126 +311,134 @@ bool HotkeyManager::registerHotkeys() {
     bindingToCharacters[binding].append(characterName);
   }
 
-  for (auto it = bindingToCharacters.begin(); it != bindingToCharacters.end();
-       ++it) {
-    const HotkeyBinding &binding = it.key();
-    const QVector<QString> &characters = it.value();
+  return bindingToCharacters;
+}
 
-    int hotkeyId;
-    if (registerHotkey(binding, hotkeyId)) {
+void HotkeyManager::registerCharacterBinding(
+    const HotkeyBinding &binding, const QVector<QString> &characters) {
+  int hotkeyId;
+  if (registerHotkey(binding, hotkeyId)) {
+    m_characterBindingIds.insert(binding, hotkeyId);
+    if (characters.size() == 1) {
+      m_hotkeyIdToCharacter.insert(hotkeyId, characters.first());
+    } else {
+      m_hotkeyIdToCharacters.insert(hotkeyId, characters);
+    }
+
+    // Build mouse button hash maps for O(1) lookup
+    if (isMouseButton(binding.keyCode)) {
       if (characters.size() == 1) {
-        m_hotkeyIdToCharacter.insert(hotkeyId, characters.first());
+        m_mouseButtonToCharacter.insert(binding, characters.first());
       } else {
-        m_hotkeyIdToCharacters.insert(hotkeyId, characters);
-      }
-
-      // Build mouse button hash maps for O(1) lookup
-      if (isMouseButton(binding.keyCode)) {
-        if (characters.size() == 1) {
-          m_mouseButtonToCharacter.insert(binding, characters.first());
-        } else {
-          m_mouseButtonToCharacters.insert(binding, characters);
-        }
+        m_mouseButtonToCharacters.insert(binding, characters);
       }
     }
   }
+}
 
-  for (auto it = m_cycleGroups.begin(); it != m_cycleGroups.end(); ++it) {
-    const QString &groupName = it.key();
-    const CycleGroup &group = it.value();
+void HotkeyManager::unregisterCharacterBinding(const HotkeyBinding &binding) {
+  auto it = m_characterBindingIds.constFind(binding);
+  if (it == m_characterBindingIds.cend()) {
+    return;
+  }
+
+  const int hotkeyId = *it;
+  m_characterBindingIds.erase(it);
+  if (hotkeyId != -1) {
+    unregisterHotkeyIds({hotkeyId});
+    m_hotkeyIdToCharacter.remove(hotkeyId);
+    m_hotkeyIdToCharacters.remove(hotkeyId);
+  }
+  m_mouseButtonToCharacter.remove(binding);
+  m_mouseButtonToCharacters.remove(binding);
+}
+
+void HotkeyManager::registerCycleGroup(const QString &groupName,
+                                       const CycleGroup &group) {
+  if (!group.forwardBindings.isEmpty()) {
+    for (const HotkeyBinding &binding : group.forwardBindings) {
+      if (!binding.enabled)
+        continue;
 
-    if (!group.forwardBindings.isEmpty()) {
-      for (const HotkeyBinding &binding : group.forwardBindings) {
-        if (!binding.enabled)
-          continue;
-
-        int hotkeyId;
-        if (registerHotkey(binding, hotkeyId)) {
-          m_hotkeyIdToCycleGroup.insert(hotkeyId, groupName);
-          m_hotkeyIdIsForward.insert(hotkeyId, true);
-
-          // Build mouse button hash map for O(1) lookup
-          if (isMouseButton(binding.keyCode)) {
-            m_mouseButtonToCycleGroup.insert(binding,
-                                             qMakePair(groupName, true));
-          }
-        }
-      }
-    } else if (group.forwardBinding.enabled) {
       int hotkeyId;
-      if (registerHotkey(group.forwardBinding, hotkeyId)) {
+      if (registerHotkey(binding, hotkeyId)) {
         m_hotkeyIdToCycleGroup.insert(hotkeyId, groupName);
         m_hotkeyIdIsForward.insert(hotkeyId, true);
 
         // Build mouse button hash map for O(1) lookup
-        if (isMouseButton(group.forwardBinding.keyCode)) {
-          m_mouseButtonToCycleGroup.insert(group.forwardBinding,
-                                           qMakePair(groupName, true));
+        if (isMouseButton(binding.keyCode)) {
+          m_mouseButtonToCycleGroup.insert(binding, qMakePair(groupName, true));
         }
       }
     }
-
-    if (!group.backwardBindings.isEmpty()) {
-      for (const HotkeyBinding &binding : group.backwardBindings) {
-        if (!binding.enabled)
-          continue;
-
-        int hotkeyId;
-        if (registerHotkey(binding, hotkeyId)) {
-          m_hotkeyIdToCycleGroup.insert(hotkeyId, groupName);
-          m_hotkeyIdIsForward.insert(hotkeyId, false);
-
-          // Build mouse button hash map for O(1) lookup
-          if (isMouseButton(binding.keyCode)) {
-            m_mouseButtonToCycleGroup.insert(binding,
-                                             qMakePair(groupName, false));
-          }
-        }
+  } else if (group.forwardBinding.enabled) {
+    int hotkeyId;
+    if (registerHotkey(group.forwardBinding, hotkeyId)) {
+      m_hotkeyIdToCycleGroup.insert(hotkeyId, groupName);
+      m_hotkeyIdIsForward.insert(hotkeyId, true);
+
+      // Build mouse button hash map for O(1) lookup
+      if (isMouseButton(group.forwardBinding.keyCode)) {
+        m_mouseButtonToCycleGroup.insert(group.forwardBinding,
+                                         qMakePair(groupName, true));
       }
-    } else if (group.backwardBinding.enabled) {
+    }
+  }
+
+  if (!group.backwardBindings.isEmpty()) {
+    for (const HotkeyBinding &binding : group.backwardBindings) {
+      if (!binding.enabled)
+        continue;
+
       int hotkeyId;
-      if (registerHotkey(group.backwardBinding, hotkeyId)) {
+      if (registerHotkey(binding, hotkeyId)) {
         m_hotkeyIdToCycleGroup.insert(hotkeyId, groupName);
         m_hotkeyIdIsForward.insert(hotkeyId, false);
 
         // Build mouse button hash map for O(1) lookup
-        if (isMouseButton(group.backwardBinding.keyCode)) {
-          m_mouseButtonToCycleGroup.insert(group.backwardBinding,
+        if (isMouseButton(binding.keyCode)) {
+          m_mouseButtonToCycleGroup.insert(binding,
                                            qMakePair(groupName, false));
         }
       }
     }
+  } else if (group.backwardBinding.enabled) {
+    int hotkeyId;
+    if (registerHotkey(group.backwardBinding, hotkeyId)) {
+      m_hotkeyIdToCycleGroup.insert(hotkeyId, groupName);
+      m_hotkeyIdIsForward.insert(hotkeyId, false);
+
+      // Build mouse button hash map for O(1) lookup
+      if (isMouseButton(group.backwardBinding.keyCode)) {
+        m_mouseButtonToCycleGroup.insert(group.backwardBinding,
+                                         qMakePair(groupName, false));
+      }
+    }
   }
+}
 
-  registerHotkeyList(m_notLoggedInForwardHotkeys,
-                     m_notLoggedInForwardHotkeyIds);
-  registerHotkeyList(m_notLoggedInBackwardHotkeys,
-                     m_notLoggedInBackwardHotkeyIds);
-
-  registerHotkeyList(m_nonEVEForwardHotkeys, m_nonEVEForwardHotkeyIds);
-  registerHotkeyList(m_nonEVEBackwardHotkeys, m_nonEVEBackwardHotkeyIds);
-
-  registerHotkeyList(m_closeAllClientsHotkeys, m_closeAllClientsHotkeyIds,
-                     false);
-
-  registerHotkeyList(m_minimizeAllClientsHotkeys, m_minimizeAllClientsHotkeyIds,
-                     false);
-
-  registerHotkeyList(m_toggleThumbnailsVisibilityHotkeys,
-                     m_toggleThumbnailsVisibilityHotkeyIds, false);
-
-  registerHotkeyList(m_cycleProfileForwardHotkeys,
-                     m_cycleProfileForwardHotkeyIds, false);
-  registerHotkeyList(m_cycleProfileBackwardHotkeys,
-                     m_cycleProfileBackwardHotkeyIds, false);
-
-  registerProfileHotkeys();
-
-  if (hasMouseButtonHotkeys()) {
-    installMouseHook();
+void HotkeyManager::unregisterCycleGroup(const QString &groupName) {
+  QSet<int> hotkeyIds;
+  for (auto it = m_hotkeyIdToCycleGroup.begin();
+       it != m_hotkeyIdToCycleGroup.end();) {
+    if (it.value() == groupName) {
+      hotkeyIds.insert(it.key());
+      m_hotkeyIdIsForward.remove(it.key());
+      it = m_hotkeyIdToCycleGroup.erase(it);
+    } else {
+      ++it;
+    }
   }
+  unregisterHotkeyIds(hotkeyIds);
 
-  return true;
+  for (auto it = m_mouseButtonToCycleGroup.begin();
+       it != m_mouseButtonToCycleGroup.end();) {
+    if (it.value().first == groupName) {
+      it = m_mouseButtonToCycleGroup.erase(it);
+    } else {
+      ++it;
+    }
+  }
 }
 
 void HotkeyManager::unregisterHotkeys() {
@@ -422,9 +515,10 @@ void HotkeyManager::unregisterHotkeys() {
   m_hotkeyIdToCycleGroup.clear();
   m_hotkeyIdIsForward.clear();
   m_wildcardAliases.clear();
+  m_characterBindingIds.clear();
 }
 
-static bool isForegroundWindowEVEClient() {
+static bool isForegroundWindowEVEClient(const QStringList &processNames) {
   HWND foregroundWindow = GetForegroundWindow();
   if (!foregroundWindow)
     return false;
@@ -447,8 +541,7 @@ static bool isForegroundWindowEVEClient() {
   if (processName.isEmpty())
     return false;
 
-  QStringList allowedProcessNames = Config::instance().processNames();
-  for (const QString &allowedName : allowedProcessNames) {
+  for (const QString &allowedName : processNames) {
     if (processName.compare(allowedName, Qt::CaseInsensitive) == 0) {
       return true;
     }
@@ -727,12 +820,126 @@ QString HotkeyManager::getCharacterForWindow(HWND hwnd) const {
 int HotkeyManager::generateHotkeyId() { return m_nextHotkeyId++; }
 
 void HotkeyManager::loadFromConfig() {
-  QSettings settings(Config::instance().configFilePath(), QSettings::IniFormat);
+  readHotkeys(Config::instance().currentProfileValues());
+
+  // Load cycle profile hotkeys from global settings
+  m_cycleProfileForwardHotkeys.clear();
+  m_cycleProfileBackwardHotkeys.clear();
+  m_cycleProfileForwardHotkeys =
+      Config::instance().getCycleProfileForwardHotkeys();
+  m_cycleProfileBackwardHotkeys =
+      Config::instance().getCycleProfileBackwardHotkeys();
 
+  m_profileHotkeys.clear();
+  QStringList profiles = Config::instance().listProfiles();
+  for (const QString &profileName : profiles) {
+    QVector<HotkeyBinding> bindings =
+        Config::instance().getProfileHotkeys(profileName);
+    if (!bindings.isEmpty()) {
+      m_profileHotkeys.insert(profileName, bindings);
+    }
+  }
+
+  registerHotkeys();
+}
+
+void HotkeyManager::applyProfileHotkeys(const SettingsMap &values) {
+  const bool hadMouseButtonHotkeys = hasMouseButtonHotkeys();
+  const QVector<HotkeyBinding> oldSuspendHotkeys = m_suspendHotkeys;
+  const QHash<HotkeyBinding, QVector<QString>> oldCharacterBindings =
+      characterBindings();
+  const QHash<QString, CycleGroup> oldCycleGroups = m_cycleGroups;
+  const QVector<HotkeyBinding> oldNotLoggedInForwardHotkeys =
+      m_notLoggedInForwardHotkeys;
+  const QVector<HotkeyBinding> oldNotLoggedInBackwardHotkeys =
+      m_notLoggedInBackwardHotkeys;
+  const QVector<HotkeyBinding> oldNonEVEForwardHotkeys = m_nonEVEForwardHotkeys;
+  const QVector<HotkeyBinding> oldNonEVEBackwardHotkeys =
+      m_nonEVEBackwardHotkeys;
+  const QVector<HotkeyBinding> oldCloseAllClientsHotkeys =
+      m_closeAllClientsHotkeys;
+  const QVector<HotkeyBinding> oldMinimizeAllClientsHotkeys =
+      m_minimizeAllClientsHotkeys;
+  const QVector<HotkeyBinding> oldToggleThumbnailsVisibilityHotkeys =
+      m_toggleThumbnailsVisibilityHotkeys;
+
+  readHotkeys(values);
+
+  // Cycle profile and profile hotkeys are global and stay registered. A
+  // change of wildcard mode changes every registration.
+  if (m_suspended ||
+      Config::instance().wildcardHotkeys() != m_registeredWildcard) {
+    registerHotkeys();
+    return;
+  }
+
+  if (m_suspendHotkeys != oldSuspendHotkeys) {
+    unregisterHotkeyIds(
+        QSet<int>(m_suspendHotkeyIds.cbegin(), m_suspendHotkeyIds.cend()));
+    m_suspendHotkeyIds.clear();
+    for (const HotkeyBinding &binding : m_suspendHotkeys) {
+      int hotkeyId;
+      if (registerHotkey(binding, hotkeyId)) {
+        m_suspendHotkeyIds.append(hotkeyId);
+      }
+    }
+  }
+
+  const QHash<HotkeyBinding, QVector<QString>> newCharacterBindings =
+      characterBindings();
+  for (auto it = oldCharacterBindings.cbegin();
+       it != oldCharacterBindings.cend(); ++it) {
+    auto now = newCharacterBindings.constFind(it.key());
+    if (now == newCharacterBindings.cend() || *now != it.value()) {
+      unregisterCharacterBinding(it.key());
+    }
+  }
+  for (auto it = newCharacterBindings.cbegin();
+       it != newCharacterBindings.cend(); ++it) {
+    auto old = oldCharacterBindings.constFind(it.key());
+    if (old == oldCharacterBindings.cend() || *old != it.value()) {
+      registerCharacterBinding(it.key(), it.value());
+    }
+  }
+
+  for (auto it = oldCycleGroups.cbegin(); it != oldCycleGroups.cend(); ++it) {
+    auto now = m_cycleGroups.constFind(it.key());
+    if (now == m_cycleGroups.cend() || !sameBindings(*now, it.value())) {
+      unregisterCycleGroup(it.key());
+    }
+  }
+  for (auto it = m_cycleGroups.cbegin(); it != m_cycleGroups.cend(); ++it) {
+    auto old = oldCycleGroups.constFind(it.key());
+    if (old == oldCycleGroups.cend() || !sameBindings(*old, it.value())) {
+      registerCycleGroup(it.key(), it.value());
+    }
+  }
+
+  updateHotkeyList(oldNotLoggedInForwardHotkeys, m_notLoggedInForwardHotkeys,
+                   m_notLoggedInForwardHotkeyIds, true);
+  updateHotkeyList(oldNotLoggedInBackwardHotkeys, m_notLoggedInBackwardHotkeys,
+                   m_notLoggedInBackwardHotkeyIds, true);
+  updateHotkeyList(oldNonEVEForwardHotkeys, m_nonEVEForwardHotkeys,
+                   m_nonEVEForwardHotkeyIds, true);
+  updateHotkeyList(oldNonEVEBackwardHotkeys, m_nonEVEBackwardHotkeys,
+                   m_nonEVEBackwardHotkeyIds, true);
+  updateHotkeyList(oldCloseAllClientsHotkeys, m_closeAllClientsHotkeys,
+                   m_closeAllClientsHotkeyIds, false);
+  updateHotkeyList(oldMinimizeAllClientsHotkeys, m_minimizeAllClientsHotkeys,
+                   m_minimizeAllClientsHotkeyIds, false);
+  updateHotkeyList(oldToggleThumbnailsVisibilityHotkeys,
+                   m_toggleThumbnailsVisibilityHotkeys,
+                   m_toggleThumbnailsVisibilityHotkeyIds, false);
+
+  if (!hadMouseButtonHotkeys && hasMouseButtonHotkeys()) {
+    installMouseHook();
+  }
+}
+
+void HotkeyManager::readHotkeys(const SettingsMap &values) {
   m_suspendHotkeys.clear();
 
-  settings.beginGroup("hotkeys");
-  QVariant suspendVar = settings.value("suspendHotkey");
+  QVariant suspendVar = values.value("hotkeys/suspendHotkey");
 
   QString suspendStr;
   if (suspendVar.canConvert<QStringList>()) {
@@ -752,14 +959,12 @@ void HotkeyManager::loadFromConfig() {
       }
     }
   }
-  settings.endGroup();
 
   m_characterHotkeys.clear();
   m_characterMultiHotkeys.clear();
-  settings.beginGroup("characterHotkeys");
-  QStringList characterKeys = settings.childKeys();
+  QStringList characterKeys = values.childKeys("characterHotkeys");
   for (const QString &characterName : characterKeys) {
-    QVariant value = settings.value(characterName);
+    QVariant value = values.value("characterHotkeys/" + characterName);
 
     QString valueStr;
     if (value.canConvert<QStringList>()) {
@@ -785,14 +990,12 @@ void HotkeyManager::loadFromConfig() {
       m_characterHotkeys.insert(characterName, bindings.first());
     }
   }
-  settings.endGroup();
 
   m_cycleGroups.clear();
 
-  settings.beginGroup("cycleGroups");
-  QStringList groupKeys = settings.childKeys();
+  QStringList groupKeys = values.childKeys("cycleGroups");
   for (const QString &groupName : groupKeys) {
-    QVariant groupValue = settings.value(groupName);
+    QVariant groupValue = values.value("cycleGroups/" + groupName);
 
     QString groupStr;
     if (groupValue.canConvert<QStringList>()) {
@@ -843,73 +1046,33 @@ void HotkeyManager::loadFromConfig() {
       m_cycleGroups.insert(groupName, group);
     }
   }
-  settings.endGroup();
 
-  m_notLoggedInForwardHotkeys.clear();
-  m_notLoggedInBackwardHotkeys.clear();
-  settings.beginGroup("notLoggedInHotkeys");
-  m_notLoggedInForwardHotkeys = loadHotkeyList(settings, "forward");
-  m_notLoggedInBackwardHotkeys = loadHotkeyList(settings, "backward");
-  settings.endGroup();
+  m_notLoggedInForwardHotkeys =
+      loadHotkeyList(values, "notLoggedInHotkeys/forward");
+  m_notLoggedInBackwardHotkeys =
+      loadHotkeyList(values, "notLoggedInHotkeys/backward");
 
-  m_nonEVEForwardHotkeys.clear();
-  m_nonEVEBackwardHotkeys.clear();
-  settings.beginGroup("nonEVEHotkeys");
-  m_nonEVEForwardHotkeys = loadHotkeyList(settings, "forward");
-  m_nonEVEBackwardHotkeys = loadHotkeyList(settings, "backward");
-  settings.endGroup();
+  m_nonEVEForwardHotkeys = loadHotkeyList(values, "nonEVEHotkeys/forward");
+  m_nonEVEBackwardHotkeys = loadHotkeyList(values, "nonEVEHotkeys/backward");
 
-  m_closeAllClientsHotkeys.clear();
-  settings.beginGroup("closeAllHotkeys");
-  m_closeAllClientsHotkeys = loadHotkeyList(settings, "closeAllClients");
-  settings.endGroup();
+  m_closeAllClientsHotkeys =
+      loadHotkeyList(values, "closeAllHotkeys/closeAllClients");
 
-  m_minimizeAllClientsHotkeys.clear();
-  settings.beginGroup("minimizeAllHotkeys");
-  m_minimizeAllClientsHotkeys = loadHotkeyList(settings, "minimizeAllClients");
-  settings.endGroup();
+  m_minimizeAllClientsHotkeys =
+      loadHotkeyList(values, "minimizeAllHotkeys/minimizeAllClients");
 
-  m_toggleThumbnailsVisibilityHotkeys.clear();
-  settings.beginGroup("toggleThumbnailsVisibilityHotkeys");
-  m_toggleThumbnailsVisibilityHotkeys =
-      loadHotkeyList(settings, "toggleThumbnailsVisibility");
-  settings.endGroup();
-
-  // Load cycle profile hotkeys from global settings
-  m_cycleProfileForwardHotkeys.clear();
-  m_cycleProfileBackwardHotkeys.clear();
-  m_cycleProfileForwardHotkeys =
-      Config::instance().getCycleProfileForwardHotkeys();
-  m_cycleProfileBackwardHotkeys =
-      Config::instance().getCycleProfileBackwardHotkeys();
-
-  m_profileHotkeys.clear();
-  QStringList profiles = Config::instance().listProfiles();
-  for (const QString &profileName : profiles) {
-    QVector<HotkeyBinding> bindings =
-        Config::instance().getProfileHotkeys(profileName);
-    if (!bindings.isEmpty()) {
-      m_profileHotkeys.insert(profileName, bindings);
-    }
-  }
-
-  registerHotkeys();
+  m_toggleThumbnailsVisibilityHotkeys = loadHotkeyList(
+      values, "toggleThumbnailsVisibilityHotkeys/toggleThumbnailsVisibility");
 }
 
 void HotkeyManager::saveToConfig() {
-  QSettings settings(Config::instance().configFilePath(), QSettings::IniFormat);
+  // Through Config, which keeps the profile in memory and writes it on a
+  // background thread
+  Config &cfg = Config::instance();
 
-  settings.beginGroup("hotkeys");
-  settings.remove("suspendHotkey");
-  QStringList suspendBindingStrs;
-  for (const HotkeyBinding &binding : m_suspendHotkeys) {
-    suspendBindingStrs.append(binding.toString());
-  }
-  settings.setValue("suspendHotkey", suspendBindingStrs.join('|'));
-  settings.endGroup();
+  saveHotkeyList("hotkeys/suspendHotkey", m_suspendHotkeys);
 
-  settings.beginGroup("characterHotkeys");
-  settings.remove("");
+  cfg.removeValue("characterHotkeys");
 
   for (auto it = m_characterMultiHotkeys.begin();
        it != m_characterMultiHotkeys.end(); ++it) {
@@ -917,19 +1080,17 @@ void HotkeyManager::saveToConfig() {
     for (const HotkeyBinding &binding : it.value()) {
       bindingStrs.append(binding.toString());
     }
-    settings.setValue(it.key(), bindingStrs.join('|'));
+    cfg.writeValue("characterHotkeys/" + it.key(), bindingStrs.join('|'));
   }
 
   for (auto it = m_characterHotkeys.begin(); it != m_characterHotkeys.end();
        ++it) {
     if (!m_characterMultiHotkeys.contains(it.key())) {
-      settings.setValue(it.key(), it.value().toString());
+      cfg.writeValue("characterHotkeys/" + it.key(), it.value().toString());
     }
   }
-  settings.endGroup();
 
-  settings.beginGroup("cycleGroups");
-  settings.remove("");
+  cfg.removeValue("cycleGroups");
   for (auto it = m_cycleGroups.begin(); it != m_cycleGroups.end(); ++it) {
     const CycleGroup &group = it.value();
     QStringList charNames;
@@ -960,34 +1121,23 @@ void HotkeyManager::saveToConfig() {
                        backwardBindingStrs.join(';') + "|" +
                        QString::number(group.includeNotLoggedIn ? 1 : 0) + "|" +
                        QString::number(group.noLoop ? 1 : 0);
-    settings.setValue(it.key(), groupStr);
+    cfg.writeValue("cycleGroups/" + it.key(), groupStr);
   }
-  settings.endGroup();
-
-  settings.beginGroup("notLoggedInHotkeys");
-  saveHotkeyList(settings, "forward", m_notLoggedInForwardHotkeys);
-  saveHotkeyList(settings, "backward", m_notLoggedInBackwardHotkeys);
-  settings.endGroup();
 
-  settings.beginGroup("nonEVEHotkeys");
-  saveHotkeyList(settings, "forward", m_nonEVEForwardHotkeys);
-  saveHotkeyList(settings, "backward", m_nonEVEBackwardHotkeys);
-  settings.endGroup();
+  saveHotkeyList("notLoggedInHotkeys/forward", m_notLoggedInForwardHotkeys);
+  saveHotkeyList("notLoggedInHotkeys/backward", m_notLoggedInBackwardHotkeys);
 
-  settings.beginGroup("closeAllHotkeys");
-  saveHotkeyList(settings, "closeAllClients", m_closeAllClientsHotkeys);
-  settings.endGroup();
+  saveHotkeyList("nonEVEHotkeys/forward", m_nonEVEForwardHotkeys);
+  saveHotkeyList("nonEVEHotkeys/backward", m_nonEVEBackwardHotkeys);
 
-  settings.beginGroup("minimizeAllHotkeys");
-  saveHotkeyList(settings, "minimizeAllClients", m_minimizeAllClientsHotkeys);
-  settings.endGroup();
+  saveHotkeyList("closeAllHotkeys/closeAllClients", m_closeAllClientsHotkeys);
 
-  settings.beginGroup("toggleThumbnailsVisibilityHotkeys");
-  saveHotkeyList(settings, "toggleThumbnailsVisibility",
-                 m_toggleThumbnailsVisibilityHotkeys);
-  settings.endGroup();
+  saveHotkeyList("minimizeAllHotkeys/minimizeAllClients",
+                 m_minimizeAllClientsHotkeys);
 
-  settings.sync();
+  saveHotkeyList(
+      "toggleThumbnailsVisibilityHotkeys/toggleThumbnailsVisibility",
+      m_toggleThumbnailsVisibilityHotkeys);
 }
 
 bool HotkeyBinding::operator<(const HotkeyBinding &other) const {
@@ -1054,8 +1204,10 @@ LRESULT CALLBACK HotkeyManager::MessageWindowProc(HWND hwnd, UINT msg,
   if (msg == WM_HOTKEY) {
     if (manager && !s_instance.isNull()) {
       // Check EVE focus requirement first, before any hotkey processing
-      bool onlyWhenEVEFocused = Config::instance().hotkeysOnlyWhenEVEFocused();
-      if (onlyWhenEVEFocused && !isForegroundWindowEVEClient()) {
+      const std::shared_ptr<const ConfigSnapshot> cfg =
+          Config::instance().snapshot();
+      if (cfg->hotkeysOnlyWhenEVEFocused &&
+          !isForegroundWindowEVEClient(cfg->processNames)) {
         return 0;
       }
 
@@ -1340,8 +1492,10 @@ LRESULT CALLBACK HotkeyManager::LowLevelMouseProc(int nCode, WPARAM wParam,
 void HotkeyManager::checkMouseButtonBindings(int vkCode, bool ctrl, bool alt,
                                              bool shift) {
   // Check EVE focus requirement first, before any hotkey processing
-  bool onlyWhenEVEFocused = Config::instance().hotkeysOnlyWhenEVEFocused();
-  if (onlyWhenEVEFocused && !isForegroundWindowEVEClient()) {
+  const std::shared_ptr<const ConfigSnapshot> cfg =
+      Config::instance().snapshot();
+  if (cfg->hotkeysOnlyWhenEVEFocused &&
+      !isForegroundWindowEVEClient(cfg->processNames)) {
     return;
   }
 
@@ -0,0 +1,336 @@
+#include "logalertmatcher.h"
+#include <QDebug>
+#include <QStringList>
+#include <QVarLengthArray>
+#include <QtAlgorithms>
+#include <algorithm>
+
+LogAlertMatcher::LogAlertMatcher() { compile({}); }
+
+int LogAlertMatcher::symbolFor(ushort c) {
+  if (c >= 128) {
+    return OTHER_SYMBOL;
+  }
+  if (c >= 'A' && c <= 'Z') {
+    return c | 0x20;
+  }
+  return c;
+}
+
+void LogAlertMatcher::compile(const QVector<LogAlertRule> &rules) {
+  m_rules.clear();
+  m_compiled.clear();
+  m_unanchoredRules.clear();
+  m_unanchoredAny = QRegularExpression();
+  m_channels = 0;
+
+  QVector<QVector<int>> trie;
+  QVector<QVector<int>> outputs;
+  trie.append(QVector<int>(SYMBOL_COUNT, -1));
+  outputs.append(QVector<int>());
+
+  QStringList unanchoredPatterns;
+
+  for (const LogAlertRule &rule : rules) {
+    if (!rule.enabled || rule.pattern.isEmpty()) {
+      continue;
+    }
+
+    CompiledRule compiled;
+    compiled.channels = rule.channel == LogAlertRule::ChatLog ? CHAT_BIT
+                        : rule.channel == LogAlertRule::GameLog
+                            ? GAME_BIT
+                            : quint8(CHAT_BIT | GAME_BIT);
+
+    QString literal;
+    if (rule.isRegex) {
+      compiled.regex = QRegularExpression(rule.pattern);
+      if (!compiled.regex.isValid()) {
+        qWarning() << "LogAlertMatcher: Skipping rule" << rule.name
+                   << "with invalid regex:" << compiled.regex.errorString();
+        continue;
+      }
+      compiled.regex.optimize();
+      compiled.check = Check::Regex;
+      literal = requiredLiteral(rule.pattern);
+    } else {
+      literal = rule.pattern;
+      for (QChar c : literal) {
+        if (c.unicode() >= 128) {
+          compiled.check = Check::Contains;
+          break;
+        }
+      }
+    }
+
+    const int ruleIndex = m_rules.size();
+    if (literal.isEmpty()) {
+      m_unanchoredRules.append(ruleIndex);
+      unanchoredPatterns.append(QStringLiteral("(?:%1)").arg(rule.pattern));
+    } else {
+      addLiteral(literal, ruleIndex, trie, outputs);
+    }
+
+    m_rules.append(rule);
+    m_compiled.append(compiled);
+    m_channels |= compiled.channels;
+  }
+
+  buildTransitions(trie, outputs);
+
+  if (!unanchoredPatterns.isEmpty()) {
+    // Branch reset keeps each rule's group numbers, so backreferences in
+    // the alternation still refer to the rule's own groups
+    m_unanchoredAny = QRegularExpression(
+        QStringLiteral("(?|%1)").arg(unanchoredPatterns.join('|')));
+    if (m_unanchoredAny.isValid()) {
+      m_unanchoredAny.optimize();
+    } else {
+      // E.g. the same group name in two rules. The empty pattern matches
+      // every line, so each rule is then checked on its own.
+      m_unanchoredAny = QRegularExpression();
+    }
+  }
+
+  if (m_rules.isEmpty()) {
+    return;
+  }
+  qDebug() << "LogAlertMatcher: Compiled" << m_rules.size() << "rules,"
+           << m_outputStart.size() - 1 << "automaton states,"
+           << m_unanchoredRules.size() << "regexes without a literal";
+}
+
+bool LogAlertMatcher::hasRulesFor(bool isChatLog) const {
+  return m_channels & (isChatLog ? CHAT_BIT : GAME_BIT);
+}
+
+QString LogAlertMatcher::requiredLiteral(const QString &regex) {
+  // Inline options such as (?x) change how the rest of the pattern reads
+  if (regex.contains(QLatin1String("(?"))) {
+    return QString();
+  }
+
+  // Longest run of plain characters outside any group or class that every
+  // match has to contain
+  QString best;
+  QString run;
+  auto endRun = [&]() {
+    if (run.size() > best.size()) {
+      best = run;
+    }
+    run.clear();
+  };
+
+  int depth = 0;
+  bool inClass = false;
+  const int length = regex.size();
+
+  for (int i = 0; i < length; ++i) {
+    const QChar c = regex[i];
+
+    if (inClass) {
+      if (c == '\\') {
+        ++i;
+      } else if (c == ']') {
+        inClass = false;
+      }
+      continue;
+    }
+
+    QChar literal;
+    switch (c.unicode()) {
+    case '\\': {
+      if (i + 1 >= length) {
+        return QString();
+      }
+      const QChar escaped = regex[++i];
+      if (!escaped.isLetterOrNumber()) {
+        literal = escaped;
+        break;
+      }
+      // Single-character classes and assertions; anything else (\x41,
+      // \p{..}, backreferences) could hide literal text
+      if (!QStringLiteral("dDwWsSbBAzZGntr").contains(escaped)) {
+        return QString();
+      }
+      endRun();
+      continue;
+    }
+    case '[':
+      inClass = true;
+      endRun();
+      continue;
+    case '(':
+      ++depth;
+      endRun();
+      continue;
+    case ')':
+      --depth;
+      endRun();
+      continue;
+    case '|':
+      if (depth == 0) {
+        return QString(); // No part is required by every alternative
+      }
+      continue;
+    case '.':
+    case '^':
+    case '$':
+    case '*':
+    case '+':
+    case '?':
+    case '{':
+    case '}':
+      endRun();
+      continue;
+    default:
+      literal = c;
+      break;
+    }
+
+    if (depth > 0) {
+      continue;
+    }
+
+    // An optional or counted character is not required as part of the run
+    const QChar next = i + 1 < length ? regex[i + 1] : QChar();
+    if (next == '?' || next == '*' || next == '{') {
+      endRun();
+      continue;
+    }
+
+    run.append(literal);
+    if (next == '+') {
+      endRun();
+    }
+  }
+  endRun();
+
+  return best.size() >= MIN_REQUIRED_LITERAL ? best : QString();
+}
+
+void LogAlertMatcher::addLiteral(const QString &text, int ruleIndex,
+                                 QVector<QVector<int>> &trie,
+                                 QVector<QVector<int>> &outputs) {
+  int state = 0;
+  for (QChar c : text) {
+    const int symbol = symbolFor(c.unicode());
+    int next = trie[state][symbol];
+    if (next < 0) {
+      next = trie.size();
+      trie[state][symbol] = next;
+      trie.append(QVector<int>(SYMBOL_COUNT, -1));
+      outputs.append(QVector<int>());
+    }
+    state = next;
+  }
+  outputs[state].append(ruleIndex);
+}
+
+void LogAlertMatcher::buildTransitions(const QVector<QVector<int>> &trie,
+                                       QVector<QVector<int>> &outputs) {
+  const int stateCount = trie.size();
+  m_next.fill(0, stateCount * SYMBOL_COUNT);
+
+  QVector<int> fail(stateCount, 0);
+  QVector<int> queue;
+  queue.reserve(stateCount);
+
+  for (int symbol = 0; symbol < SYMBOL_COUNT; ++symbol) {
+    const int child = trie[0][symbol];
+    if (child >= 0) {
+      m_next[symbol] = child;
+      queue.append(child);
+    }
+  }
+
+  // Breadth-first, so a state's failure target is always complete before
+  // the state itself inherits its outputs
+  for (int head = 0; head < queue.size(); ++head) {
+    const int state = queue[head];
+    outputs[state].append(outputs[fail[state]]);
+
+    for (int symbol = 0; symbol < SYMBOL_COUNT; ++symbol) {
+      const int fallback = m_next[fail[state] * SYMBOL_COUNT + symbol];
+      const int child = trie[state][symbol];
+      if (child >= 0) {
+        fail[child] = fallback;
+        m_next[state * SYMBOL_COUNT + symbol] = child;
+        queue.append(child);
+      } else {
+        m_next[state * SYMBOL_COUNT + symbol] = fallback;
+      }
+    }
+  }
+
+  m_outputStart.clear();
+  m_outputStart.reserve(stateCount + 1);
+  m_outputs.clear();
+  for (const QVector<int> &stateOutputs : std::as_const(outputs)) {
+    m_outputStart.append(m_outputs.size());
+    m_outputs.append(stateOutputs);
+  }
+  m_outputStart.append(m_outputs.size());
+}
+
+void LogAlertMatcher::match(const QString &line, bool isChatLog,
+                            QVector<int> &matched, int from) const {
+  const quint8 channel = isChatLog ? CHAT_BIT : GAME_BIT;
+  if (!(m_channels & channel)) {
+    return;
+  }
+
+  // Rules whose literal occurs in the line, one bit per rule
+  QVarLengthArray<quint64, 4> seen((m_rules.size() + 63) / 64);
+  std::fill(seen.begin(), seen.end(), 0);
+  bool anySeen = false;
+
+  const QChar *data = line.constData();
+  const int length = line.size();
+  int state = 0;
+  for (int i = from; i < length; ++i) {
+    state = m_next[state * SYMBOL_COUNT + symbolFor(data[i].unicode())];
+    for (int o = m_outputStart[state]; o < m_outputStart[state + 1]; ++o) {
+      const int rule = m_outputs[o];
+      seen[rule >> 6] |= quint64(1) << (rule & 63);
+      anySeen = true;
+    }
+  }
+
+  for (int word = 0; anySeen && word < seen.size(); ++word) {
+    quint64 bits = seen[word];
+    while (bits) {
+      const int rule = word * 64 + qCountTrailingZeroBits(bits);
+      bits &= bits - 1;
+
+      const CompiledRule &compiled = m_compiled[rule];
+      if (!(compiled.channels & channel)) {
+        continue;
+      }
+
+      bool isMatch = true;
+      if (compiled.check == Check::Contains) {
+        isMatch = line.indexOf(m_rules[rule].pattern, from,
+                               Qt::CaseInsensitive) >= 0;
+      } else if (compiled.check == Check::Regex) {
+        isMatch = compiled.regex.match(line, from).hasMatch();
+      }
+      if (isMatch) {
+        matched.append(rule);
+      }
+    }
+  }
+
+  if (m_unanchoredRules.isEmpty() ||
+      !m_unanchoredAny.match(line, from).hasMatch()) {
+    return;
+  }
+
+  for (int rule : m_unanchoredRules) {
+    const CompiledRule &compiled = m_compiled[rule];
+    if ((compiled.channels & channel) &&
+        compiled.regex.match(line, from).hasMatch()) {
+      matched.append(rule);
+    }
+  }
+}
@@ -0,0 +1,38 @@
+#include "logdirectorydiff.h"
+
+LogDirectoryDiff::Changes LogDirectoryDiff::update(const QDir &dir,
+                                                   const QStringList &filters) {
+  Changes changes;
+
+  // Names only; the listing is neither sorted nor stat'ed per file
+  const QStringList names = dir.entryList(filters, QDir::Files, QDir::NoSort);
+
+  QSet<QString> current;
+  current.reserve(names.size());
+  for (const QString &name : names) {
+    current.insert(dir.absoluteFilePath(name));
+  }
+
+  if (m_seeded) {
+    for (const QString &path : std::as_const(current)) {
+      if (!m_entries.contains(path)) {
+        changes.added.append(path);
+      }
+    }
+    for (const QString &path : std::as_const(m_entries)) {
+      if (!current.contains(path)) {
+        changes.removed.append(path);
+      }
+    }
+  }
+
+  m_entries.swap(current);
+  m_seeded = true;
+
+  return changes;
+}
+
+void LogDirectoryDiff::reset() {
+  m_entries.clear();
+  m_seeded = false;
+}
@@ -0,0 +1,39 @@
+#include "logeventcorrelator.h"
+
+LogEventCorrelator::LogEventCorrelator(qint64 windowMs)
+    : m_windowMs(windowMs), m_nextGroupId(1) {}
+
+LogEventCorrelator::Result LogEventCorrelator::add(const QString &eventType,
+                                                   const QString &text,
+                                                   qint64 timeMs) {
+  expire(timeMs);
+
+  const QString key = eventType + QChar('\n') + normalize(text);
+
+  auto it = m_open.constFind(key);
+  if (it != m_open.constEnd()) {
+    return {it->id, false};
+  }
+
+  const quint64 groupId = m_nextGroupId++;
+  m_open.insert(key, {groupId, timeMs});
+  m_openOrder.enqueue(key);
+  return {groupId, true};
+}
+
+void LogEventCorrelator::clear() {
+  m_open.clear();
+  m_openOrder.clear();
+}
+
+void LogEventCorrelator::expire(qint64 timeMs) {
+  // Every queued key is open, and the oldest group is at the head
+  while (!m_openOrder.isEmpty() &&
+         timeMs - m_open.value(m_openOrder.head()).openedAt >= m_windowMs) {
+    m_open.remove(m_openOrder.dequeue());
+  }
+}
+
+QString LogEventCorrelator::normalize(const QString &text) {
+  return text.simplified().toCaseFolded();
+}
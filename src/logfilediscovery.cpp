@@ -0,0 +1,535 @@
+#include "logfilediscovery.h"
+#include <QDebug>
+#include <QFile>
+#include <QRegularExpression>
+#include <QTextStream>
+#include <QThread>
+#include <QtConcurrent>
+
+LogFileDiscovery::LogFileDiscovery(QObject *parent)
+    : QObject(parent), m_scanTimer(new QTimer(this)),
+      m_directoryWatcher(new QFileSystemWatcher(this)),
+      m_headerWatcher(new QFutureWatcher<QPair<QString, QString>>(this)) {
+
+  // Scan timer for finding new log files (as backup)
+  connect(m_scanTimer, &QTimer::timeout, this,
+          &LogFileDiscovery::checkForNewFiles);
+  m_scanTimer->setInterval(SCAN_INTERVAL_MS);
+
+  // Directory watcher for immediate new file detection
+  connect(m_directoryWatcher, &QFileSystemWatcher::directoryChanged, this,
+          &LogFileDiscovery::onDirectoryChanged);
+
+  // Header extraction for unindexed log files runs on a small pool so the
+  // discovery thread stays responsive to directory events
+  m_headerPool.setMaxThreadCount(
+      qBound(1, QThread::idealThreadCount(), MAX_HEADER_SCAN_THREADS));
+  connect(m_headerWatcher, &QFutureWatcher<QPair<QString, QString>>::finished,
+          this, &LogFileDiscovery::onHeaderScanFinished);
+}
+
+LogFileDiscovery::~LogFileDiscovery() {
+  stopMonitoring();
+
+  // Header scan tasks only touch their own results
+  m_headerWatcher->waitForFinished();
+}
+
+void LogFileDiscovery::setLogDirectory(const QString &directory) {
+  QMutexLocker locker(&m_mutex);
+  m_logDirectory = directory;
+}
+
+void LogFileDiscovery::setGameLogDirectory(const QString &directory) {
+  QMutexLocker locker(&m_mutex);
+  m_gameLogDirectory = directory;
+}
+
+void LogFileDiscovery::setEnableChatLogMonitoring(bool enabled) {
+  QMutexLocker locker(&m_mutex);
+  m_enableChatLogMonitoring = enabled;
+}
+
+void LogFileDiscovery::setEnableGameLogMonitoring(bool enabled) {
+  QMutexLocker locker(&m_mutex);
+  m_enableGameLogMonitoring = enabled;
+}
+
+void LogFileDiscovery::setIntelChannels(const QStringList &channels) {
+  QMutexLocker locker(&m_mutex);
+  m_intelChannels = channels;
+
+  // The diff filters are derived from the channel names
+  m_intelDirDiff.reset();
+}
+
+void LogFileDiscovery::setDataDirectory(const QString &directory) {
+  QMutexLocker locker(&m_mutex);
+  m_dataDirectory = directory;
+}
+
+void LogFileDiscovery::startMonitoring() {
+  QMutexLocker locker(&m_mutex);
+
+  if (m_running) {
+    return;
+  }
+
+  m_running = true;
+
+  // Set up directory watching for instant new file detection
+  QStringList watchedDirs = m_directoryWatcher->directories();
+  if (!watchedDirs.isEmpty()) {
+    m_directoryWatcher->removePaths(watchedDirs);
+  }
+
+  if (m_enableChatLogMonitoring && QDir(m_logDirectory).exists()) {
+    m_directoryWatcher->addPath(m_logDirectory);
+    qDebug() << "LogFileDiscovery: Watching chatlog directory:"
+             << m_logDirectory;
+  }
+
+  if (m_enableGameLogMonitoring && QDir(m_gameLogDirectory).exists()) {
+    m_directoryWatcher->addPath(m_gameLogDirectory);
+    qDebug() << "LogFileDiscovery: Watching gamelog directory:"
+             << m_gameLogDirectory;
+  }
+
+  // Listener headers parsed in earlier sessions
+  if (!m_listenerIndex.isLoaded() && !m_dataDirectory.isEmpty()) {
+    m_listenerIndex.load(m_dataDirectory + "/logindex.dat");
+  }
+
+  // Seed the directory listings before the full scan; files created in
+  // between show up as added on the next directory event
+  if (m_enableChatLogMonitoring) {
+    applyDirectoryChanges(true);
+  }
+  if (m_enableGameLogMonitoring) {
+    applyDirectoryChanges(false);
+  }
+
+  scan();
+
+  m_scanTimer->start();
+}
+
+void LogFileDiscovery::stopMonitoring() {
+  QMutexLocker locker(&m_mutex);
+
+  if (!m_running) {
+    return;
+  }
+
+  m_running = false;
+  m_scanTimer->stop();
+
+  QStringList watchedDirs = m_directoryWatcher->directories();
+  if (!watchedDirs.isEmpty()) {
+    m_directoryWatcher->removePaths(watchedDirs);
+  }
+
+  m_lastChatDirScanTime = QDateTime();
+  m_lastGameDirScanTime = QDateTime();
+  m_cachedChatListenerMap.clear();
+  m_cachedGameListenerMap.clear();
+  m_chatDirDiff.reset();
+  m_gameDirDiff.reset();
+  m_intelDirDiff.reset();
+  m_headerlessNewFiles.clear();
+
+  m_listenerIndex.save();
+}
+
+void LogFileDiscovery::refreshMonitoring() {
+  QMutexLocker locker(&m_mutex);
+
+  if (!m_running) {
+    return;
+  }
+
+  // Enabled log types or intel channels may have changed
+  m_lastChatDirScanTime = QDateTime();
+  m_lastGameDirScanTime = QDateTime();
+  scan();
+}
+
+void LogFileDiscovery::checkForNewFiles() {
+  QMutexLocker locker(&m_mutex);
+
+  if (!m_running) {
+    return;
+  }
+
+  bool changed = false;
+
+  if (m_enableChatLogMonitoring) {
+    changed |= applyDirectoryChanges(true);
+  }
+
+  if (m_enableGameLogMonitoring) {
+    changed |= applyDirectoryChanges(false);
+  }
+
+  if (changed) {
+    qDebug() << "LogFileDiscovery: Log files changed, rescanning";
+    scan();
+  }
+}
+
+void LogFileDiscovery::onDirectoryChanged(const QString &path) {
+  QMutexLocker locker(&m_mutex);
+
+  if (!m_running) {
+    return;
+  }
+
+  // Only the changed directory is diffed against its previous listing, so
+  // new character logs are assigned within this event
+  const QString changedDir = QDir(path).absolutePath();
+  bool changed = false;
+
+  if (m_enableChatLogMonitoring &&
+      changedDir == QDir(m_logDirectory).absolutePath()) {
+    changed |= applyDirectoryChanges(true);
+  }
+
+  if (m_enableGameLogMonitoring &&
+      changedDir == QDir(m_gameLogDirectory).absolutePath()) {
+    changed |= applyDirectoryChanges(false);
+  }
+
+  if (changed) {
+    qDebug() << "LogFileDiscovery: Directory change in" << path
+             << "- rescanning";
+    scan();
+  }
+}
+
+void LogFileDiscovery::scan() {
+  QElapsedTimer totalTimer;
+  totalTimer.start();
+
+  LogFileAssignment files;
+
+  // Build chat listener map (scan directory for Local_*.txt files)
+  if (m_enableChatLogMonitoring) {
+    QDir d(m_logDirectory);
+    if (!d.exists()) {
+      m_cachedChatListenerMap.clear();
+    } else {
+      QDateTime dirLastMod = QFileInfo(d.absolutePath()).lastModified();
+      if (m_lastChatDirScanTime.isNull() ||
+          dirLastMod > m_lastChatDirScanTime) {
+        bool complete = true;
+        m_cachedChatListenerMap = buildListenerToFileMap(
+            d, QStringList() << "Local_*.txt", 24, &complete);
+        if (complete) {
+          m_lastChatDirScanTime = dirLastMod;
+        }
+      }
+      files.chatLogs = m_cachedChatListenerMap;
+    }
+
+    for (const QString &channel : std::as_const(m_intelChannels)) {
+      const QString intelLogFile = findIntelLogFile(channel);
+      if (!intelLogFile.isEmpty()) {
+        files.intelLogs.insert(channel, intelLogFile);
+      }
+    }
+  }
+
+  // Build game listener map (scan directory for *.txt game logs)
+  if (m_enableGameLogMonitoring) {
+    QDir gd(m_gameLogDirectory);
+    if (!gd.exists()) {
+      m_cachedGameListenerMap.clear();
+    } else {
+      QDateTime dirLastMod = QFileInfo(gd.absolutePath()).lastModified();
+      if (m_lastGameDirScanTime.isNull() ||
+          dirLastMod > m_lastGameDirScanTime) {
+        bool complete = true;
+        m_cachedGameListenerMap = buildListenerToFileMap(
+            gd, QStringList() << "*.txt", 24, &complete);
+        if (complete) {
+          m_lastGameDirScanTime = dirLastMod;
+        }
+      }
+      files.gameLogs = m_cachedGameListenerMap;
+    }
+  }
+
+  // Characters missing from the maps may still be resolved by a running
+  // header scan, which scans again when it finishes
+  files.complete = m_pendingHeaderFiles.isEmpty();
+
+  // Persist headers parsed during this scan
+  m_listenerIndex.save();
+
+  startHeaderScan();
+
+  qDebug() << "LogFileDiscovery: Scan found" << files.chatLogs.size()
+           << "chat," << files.gameLogs.size() << "game and"
+           << files.intelLogs.size() << "intel logs in" << totalTimer.elapsed()
+           << "ms" << (files.complete ? "" : "(headers pending)");
+
+  emit logFilesChanged(files);
+}
+
+bool LogFileDiscovery::applyDirectoryChanges(bool isChatLog) {
+  QDir dir(isChatLog ? m_logDirectory : m_gameLogDirectory);
+  if (!dir.exists()) {
+    return false;
+  }
+
+  LogDirectoryDiff &dirDiff = isChatLog ? m_chatDirDiff : m_gameDirDiff;
+  QHash<QString, QString> &listenerMap =
+      isChatLog ? m_cachedChatListenerMap : m_cachedGameListenerMap;
+  QDateTime &lastScanTime =
+      isChatLog ? m_lastChatDirScanTime : m_lastGameDirScanTime;
+
+  // New sessions of intel channels only need a rescan
+  bool intelChanged = false;
+  if (isChatLog && !m_intelChannels.isEmpty()) {
+    QStringList intelFilters;
+    for (const QString &channel : std::as_const(m_intelChannels)) {
+      intelFilters << channel + "_*.txt";
+    }
+    intelChanged = !m_intelDirDiff.update(dir, intelFilters).added.isEmpty();
+  }
+
+  const bool seeded = dirDiff.isSeeded();
+  const LogDirectoryDiff::Changes changes = dirDiff.update(
+      dir, QStringList() << (isChatLog ? "Local_*.txt" : "*.txt"));
+
+  // The first listing has nothing to compare with; the full scan covers it
+  if (!seeded) {
+    return true;
+  }
+
+  // Files created before EVE wrote their header are retried on every event
+  QStringList addedFiles = changes.added;
+  for (const QString &path : std::as_const(m_headerlessNewFiles)) {
+    if (QFileInfo(path).absolutePath() == dir.absolutePath() &&
+        !changes.removed.contains(path) && !addedFiles.contains(path)) {
+      addedFiles.append(path);
+    }
+  }
+
+  if (addedFiles.isEmpty() && changes.removed.isEmpty()) {
+    return intelChanged;
+  }
+
+  bool mapChanged = false;
+  bool needsRebuild = false;
+
+  for (const QString &path : changes.removed) {
+    m_headerlessNewFiles.remove(path);
+
+    // An older log of the same character may take over, which only a full
+    // listing can tell
+    if (!listenerMap.key(path).isEmpty()) {
+      needsRebuild = true;
+    }
+  }
+
+  for (const QString &path : std::as_const(addedFiles)) {
+    QFileInfo fi(path);
+
+    // A handful of new files is cheaper to read here than to hand to the
+    // header pool and wait for its rescan
+    QString listener;
+    if (!m_listenerIndex.lookup(fi, listener)) {
+      listener = readListenerFromLogFile(path);
+      m_listenerIndex.insert(fi, listener);
+    }
+
+    if (listener.isEmpty()) {
+      m_headerlessNewFiles.insert(path);
+      continue;
+    }
+    m_headerlessNewFiles.remove(path);
+
+    // The newest log of a character is the one it writes to
+    const QString key = listener.toLower();
+    const QString current = listenerMap.value(key);
+    if (current == path || (!current.isEmpty() &&
+                            QFileInfo(current).lastModified() >
+                                fi.lastModified())) {
+      continue;
+    }
+
+    qDebug() << "LogFileDiscovery: New" << (isChatLog ? "chat" : "game")
+             << "log for" << listener << ":" << path;
+    listenerMap.insert(key, path);
+    mapChanged = true;
+  }
+
+  if (needsRebuild) {
+    lastScanTime = QDateTime();
+  } else if (!lastScanTime.isNull()) {
+    // The cached map is current; keep scan() from relisting
+    lastScanTime = QFileInfo(dir.absolutePath()).lastModified();
+  }
+
+  return mapChanged || needsRebuild || intelChanged;
+}
+
+QHash<QString, QString>
+LogFileDiscovery::buildListenerToFileMap(const QDir &dir,
+                                         const QStringList &filters,
+                                         int maxAgeHours, bool *complete) {
+  QHash<QString, QString> result;
+
+  if (complete) {
+    *complete = true;
+  }
+
+  if (!dir.exists()) {
+    return result;
+  }
+
+  QFileInfoList files = dir.entryInfoList(filters, QDir::Files, QDir::Time);
+
+  // Files are sorted newest first and the first file seen for a character
+  // wins. Once a file's header is unknown, older files can no longer be
+  // attributed, since that file may belong to the same character.
+  bool resolvedSoFar = true;
+
+  for (const QFileInfo &fi : files) {
+    QDateTime lastModified = fi.lastModified();
+    qint64 hoursSinceModified =
+        lastModified.secsTo(QDateTime::currentDateTime()) / 3600;
+    if (hoursSinceModified > maxAgeHours) {
+      continue;
+    }
+
+    QString character;
+    if (!m_listenerIndex.lookup(fi, character)) {
+      // Parsed in parallel by startHeaderScan()
+      QString path = fi.absoluteFilePath();
+      if (!m_pendingHeaderFiles.contains(path)) {
+        m_pendingHeaderFiles.insert(path, fi);
+        m_headerQueue.append(path);
+      }
+      resolvedSoFar = false;
+      continue;
+    }
+
+    if (resolvedSoFar && !character.isEmpty()) {
+      QString key = character.toLower();
+      if (!result.contains(key)) {
+        result.insert(key, fi.absoluteFilePath());
+      }
+    }
+  }
+
+  if (complete) {
+    *complete = resolvedSoFar;
+  }
+
+  return result;
+}
+
+QString LogFileDiscovery::findIntelLogFile(const QString &channel) const {
+  QDir chatLogDir(m_logDirectory);
+  if (!chatLogDir.exists()) {
+    return QString();
+  }
+
+  // Every character in the channel writes its own copy of the log; the
+  // newest one is enough
+  QFileInfoList intelFiles = chatLogDir.entryInfoList(
+      QStringList() << channel + "_*.txt", QDir::Files, QDir::Time);
+
+  if (intelFiles.isEmpty()) {
+    return QString();
+  }
+
+  const QFileInfo &newest = intelFiles.first();
+  if (newest.lastModified().secsTo(QDateTime::currentDateTime()) / 3600 > 24) {
+    return QString();
+  }
+
+  return newest.absoluteFilePath();
+}
+
+void LogFileDiscovery::startHeaderScan() {
+  if (m_headerQueue.isEmpty() || m_headerWatcher->isRunning()) {
+    return;
+  }
+
+  QStringList batch;
+  batch.swap(m_headerQueue);
+
+  qDebug() << "LogFileDiscovery: Reading" << batch.size()
+           << "log headers on up to" << m_headerPool.maxThreadCount()
+           << "threads";
+
+  m_headerScanTimer.start();
+  m_headerWatcher->setFuture(QtConcurrent::mapped(
+      &m_headerPool, std::move(batch), [](const QString &path) {
+        return qMakePair(path, readListenerFromLogFile(path));
+      }));
+}
+
+void LogFileDiscovery::onHeaderScanFinished() {
+  QMutexLocker locker(&m_mutex);
+
+  const QList<QPair<QString, QString>> results =
+      m_headerWatcher->future().results();
+
+  for (const QPair<QString, QString> &result : results) {
+    auto it = m_pendingHeaderFiles.find(result.first);
+    if (it != m_pendingHeaderFiles.end()) {
+      m_listenerIndex.insert(it.value(), result.second);
+      m_pendingHeaderFiles.erase(it);
+    }
+  }
+
+  qDebug() << "LogFileDiscovery: Header scan of" << results.size()
+           << "files took" << m_headerScanTimer.elapsed() << "ms";
+
+  if (!m_running) {
+    m_pendingHeaderFiles.clear();
+    m_headerQueue.clear();
+    m_listenerIndex.save();
+    return;
+  }
+
+  // Resolve the remaining characters now that their headers are indexed
+  scan();
+}
+
+QString LogFileDiscovery::readListenerFromLogFile(const QString &filePath) {
+  // Runs on the header scan thread pool, so it must not touch member state
+  QFile file(filePath);
+  if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+    return QString();
+  }
+
+  QTextStream in(&file);
+  in.setAutoDetectUnicode(true);
+
+  static const QRegularExpression listenerPattern(R"(Listener:\s+(.+))");
+
+  QString fileName = QFileInfo(filePath).fileName();
+  bool isChatLog = fileName.startsWith("Local_", Qt::CaseInsensitive);
+
+  // The listener is on line 9 of a chatlog and line 3 of a gamelog
+  const int skippedLines = isChatLog ? 8 : 2;
+  for (int i = 1; i <= skippedLines && !in.atEnd(); ++i) {
+    in.readLine();
+  }
+
+  QString characterName;
+  if (!in.atEnd()) {
+    QString line = in.readLine();
+    QRegularExpressionMatch match = listenerPattern.match(line);
+    if (match.hasMatch()) {
+      characterName = match.captured(1).trimmed();
+    }
+  }
+
+  return characterName;
+}
@@ -0,0 +1,140 @@
+#include "logfileindex.h"
+#include <QDataStream>
+#include <QDateTime>
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QSaveFile>
+
+void LogFileIndex::load(const QString &filePath) {
+  m_filePath = filePath;
+  m_entries.clear();
+  m_dirty = false;
+
+  QFile file(filePath);
+  if (!file.open(QIODevice::ReadOnly)) {
+    return;
+  }
+
+  QDataStream in(&file);
+  in.setVersion(QDataStream::Qt_6_0);
+
+  quint32 magic = 0;
+  quint32 version = 0;
+  in >> magic >> version;
+  if (magic != FILE_MAGIC || version != FILE_VERSION) {
+    qDebug() << "LogFileIndex: Ignoring incompatible index" << filePath;
+    return;
+  }
+
+  quint32 count = 0;
+  in >> count;
+  m_entries.reserve(count);
+
+  for (quint32 i = 0; i < count && in.status() == QDataStream::Ok; ++i) {
+    QString path;
+    Entry entry;
+    in >> path >> entry.listener >> entry.fileId >> entry.size >>
+        entry.indexedAt;
+    if (in.status() == QDataStream::Ok) {
+      m_entries.insert(path, entry);
+    }
+  }
+
+  if (in.status() != QDataStream::Ok) {
+    qDebug() << "LogFileIndex: Index" << filePath
+             << "is truncated, keeping" << m_entries.size() << "entries";
+    m_dirty = true;
+  }
+
+  prune();
+}
+
+void LogFileIndex::save() {
+  if (!m_dirty || m_filePath.isEmpty()) {
+    return;
+  }
+
+  prune();
+
+  QDir().mkpath(QFileInfo(m_filePath).absolutePath());
+
+  QSaveFile file(m_filePath);
+  if (!file.open(QIODevice::WriteOnly)) {
+    qWarning() << "LogFileIndex: Failed to write" << m_filePath;
+    return;
+  }
+
+  QDataStream out(&file);
+  out.setVersion(QDataStream::Qt_6_0);
+  out << FILE_MAGIC << FILE_VERSION << quint32(m_entries.size());
+
+  for (auto it = m_entries.constBegin(); it != m_entries.constEnd(); ++it) {
+    const Entry &entry = it.value();
+    out << it.key() << entry.listener << entry.fileId << entry.size
+        << entry.indexedAt;
+  }
+
+  if (file.commit()) {
+    m_dirty = false;
+  } else {
+    qWarning() << "LogFileIndex: Failed to commit" << m_filePath;
+  }
+}
+
+bool LogFileIndex::lookup(const QFileInfo &fileInfo, QString &listener) {
+  auto it = m_entries.find(fileInfo.absoluteFilePath());
+  if (it == m_entries.end()) {
+    return false;
+  }
+
+  // A grown file still has the same header; anything else is a new file.
+  // Files without a header may have been written to since, so retry them.
+  const qint64 size = fileInfo.size();
+  if (size < it->size || (it->listener.isEmpty() && size != it->size) ||
+      it->fileId != fileIdFor(fileInfo)) {
+    m_entries.erase(it);
+    m_dirty = true;
+    return false;
+  }
+
+  it->used = true;
+  listener = it->listener;
+  return true;
+}
+
+void LogFileIndex::insert(const QFileInfo &fileInfo,
+                          const QString &listener) {
+  Entry entry;
+  entry.listener = listener;
+  entry.fileId = fileIdFor(fileInfo);
+  entry.size = fileInfo.size();
+  entry.indexedAt = QDateTime::currentMSecsSinceEpoch();
+  entry.used = true;
+
+  m_entries.insert(fileInfo.absoluteFilePath(), entry);
+  m_dirty = true;
+}
+
+qint64 LogFileIndex::fileIdFor(const QFileInfo &fileInfo) {
+  // Qt has no portable inode / file index; the birth time comes from the
+  // same directory entry query as size and mtime and changes when a file is
+  // recreated under the same name
+  QDateTime birthTime = fileInfo.birthTime();
+  return birthTime.isValid() ? birthTime.toMSecsSinceEpoch() : 0;
+}
+
+void LogFileIndex::prune() {
+  const qint64 cutoff = QDateTime::currentMSecsSinceEpoch() - RETENTION_MS;
+
+  // Entries still in use are kept, or a log open for longer than the
+  // window would be dropped and re-added on every save
+  for (auto it = m_entries.begin(); it != m_entries.end();) {
+    if (!it->used && it->indexedAt < cutoff) {
+      it = m_entries.erase(it);
+      m_dirty = true;
+    } else {
+      ++it;
+    }
+  }
+}
@@ -0,0 +1,267 @@
+#include "loglineclassifier.h"
+#include <algorithm>
+#include <bit>
+#include <utility>
+
+LogLineClassifier::LogLineClassifier() {
+  m_trie.append(QVector<int>(SYMBOL_COUNT, -1));
+  m_output.append(0);
+
+  addLiteral("EVE System", EveSystem);
+  addLiteral("(question)", Question);
+  addLiteral("(notify)", Notify);
+  addLiteral("(mining)", MiningMarker);
+  addLiteral("(None)", NoneMarker);
+  addLiteral("Following", Following);
+  addLiteral("Regrouping", Regrouping);
+  addLiteral("compressed", Compressed);
+  addLiteral("cloak deactivates", CloakDeactivates);
+  addLiteral("deactivates due to the destruction", CrystalDestruction);
+  addLiteral("pale shadow of its former glory", PaleShadow);
+  addLiteral("Conduit Field", ConduitField);
+  addLiteral("Jumping", Jumping);
+  addLiteral("conversation", Conversation);
+
+  buildTransitions();
+
+  // The goto function is only needed while building
+  m_trie.clear();
+  m_trie.squeeze();
+}
+
+int LogLineClassifier::symbolFor(ushort c) {
+  if (c >= 128) {
+    return OTHER_SYMBOL;
+  }
+  if (c >= 'A' && c <= 'Z') {
+    return c | 0x20;
+  }
+  return c;
+}
+
+int LogLineClassifier::indexOf(Literal literal) {
+  return std::countr_zero(static_cast<quint32>(literal));
+}
+
+bool LogLineClassifier::Occurrences::has(Literal literal) const {
+  return first[indexOf(literal)] >= 0;
+}
+
+bool LogLineClassifier::Occurrences::follows(Literal keyword,
+                                             Literal marker) const {
+  // As indexOf(keyword, markerPos) did: any occurrence of the keyword at or
+  // after the first marker
+  return has(keyword) && has(marker) &&
+         last[indexOf(keyword)] >= first[indexOf(marker)];
+}
+
+void LogLineClassifier::addLiteral(const char *text, Literal literal) {
+  m_lengths[indexOf(literal)] = static_cast<int>(qstrlen(text));
+
+  int state = 0;
+  for (const char *p = text; *p; ++p) {
+    int symbol = symbolFor(static_cast<uchar>(*p));
+    int next = m_trie[state][symbol];
+    if (next < 0) {
+      next = m_trie.size();
+      m_trie[state][symbol] = next;
+      m_trie.append(QVector<int>(SYMBOL_COUNT, -1));
+      m_output.append(0);
+    }
+    state = next;
+  }
+  m_output[state] |= literal;
+}
+
+void LogLineClassifier::buildTransitions() {
+  const int stateCount = m_trie.size();
+  m_next.fill(0, stateCount * SYMBOL_COUNT);
+
+  QVector<int> fail(stateCount, 0);
+  QVector<int> queue;
+  queue.reserve(stateCount);
+
+  for (int symbol = 0; symbol < SYMBOL_COUNT; ++symbol) {
+    int child = m_trie[0][symbol];
+    if (child >= 0) {
+      m_next[symbol] = child;
+      queue.append(child);
+    }
+  }
+
+  // Breadth-first, so a state's failure target is always complete before
+  // the state itself inherits its outputs
+  for (int head = 0; head < queue.size(); ++head) {
+    const int state = queue[head];
+    m_output[state] |= m_output[fail[state]];
+
+    for (int symbol = 0; symbol < SYMBOL_COUNT; ++symbol) {
+      const int fallback = m_next[fail[state] * SYMBOL_COUNT + symbol];
+      const int child = m_trie[state][symbol];
+      if (child >= 0) {
+        fail[child] = fallback;
+        m_next[state * SYMBOL_COUNT + symbol] = child;
+        queue.append(child);
+      } else {
+        m_next[state * SYMBOL_COUNT + symbol] = fallback;
+      }
+    }
+  }
+}
+
+LogLineClassifier::Kinds LogLineClassifier::classify(const QString &line,
+                                                     int from) const {
+  const QChar *data = line.constData();
+  const int length = line.size();
+
+  Occurrences seen;
+  std::fill(std::begin(seen.first), std::end(seen.first), -1);
+  std::fill(std::begin(seen.last), std::end(seen.last), -1);
+
+  int state = 0;
+  for (int i = from; i < length; ++i) {
+    state = m_next[state * SYMBOL_COUNT + symbolFor(data[i].unicode())];
+
+    // Outputs are rare, so the offsets are only worked out when one is hit
+    for (quint32 output = m_output[state]; output; output &= output - 1) {
+      const int literal = std::countr_zero(output);
+      const int start = i + 1 - m_lengths[literal];
+      if (seen.first[literal] < 0) {
+        seen.first[literal] = start;
+      }
+      seen.last[literal] = start;
+    }
+  }
+
+  return kindsFor(seen);
+}
+
+LogLineClassifier::Kinds
+LogLineClassifier::kindsFor(const Occurrences &seen) {
+  // Same precedence and fall-through as the marker checks that
+  // ChatLogWorker::parseLogLine used before the classifier: the first
+  // marker found decides the block, and inside a block every keyword
+  // after the marker is tried in turn
+  Kinds kinds;
+
+  if (seen.has(EveSystem)) {
+    kinds.append(LogLineKind::SystemChange);
+    return kinds;
+  }
+
+  if (seen.has(Question)) {
+    kinds.append(LogLineKind::FleetInvite);
+    return kinds;
+  }
+
+  if (seen.has(Notify)) {
+    static constexpr struct {
+      Literal keyword;
+      LogLineKind kind;
+    } notifyKeywords[] = {
+        {Following, LogLineKind::FollowWarp},
+        {Regrouping, LogLineKind::Regroup},
+        {Compressed, LogLineKind::Compression},
+        {CloakDeactivates, LogLineKind::Decloak},
+        {CrystalDestruction, LogLineKind::CrystalBroke},
+        {PaleShadow, LogLineKind::AsteroidDepleted},
+        {ConduitField, LogLineKind::ConduitJump},
+    };
+    for (const auto &entry : notifyKeywords) {
+      if (seen.follows(entry.keyword, Notify)) {
+        kinds.append(entry.kind);
+      }
+    }
+    return kinds;
+  }
+
+  if (seen.has(MiningMarker)) {
+    kinds.append(LogLineKind::Mining);
+    return kinds;
+  }
+
+  if (seen.follows(Jumping, NoneMarker)) {
+    kinds.append(LogLineKind::Jump);
+  }
+  if (seen.follows(Conversation, NoneMarker)) {
+    kinds.append(LogLineKind::ConvoRequest);
+  }
+
+  return kinds;
+}
+
+LogLineClassifier::Extraction
+LogLineClassifier::extract(const Kinds &candidates, const QString &line) {
+  Extraction extraction;
+  for (LogLineKind kind : candidates) {
+    QRegularExpressionMatch match = patternFor(kind).match(line);
+    if (match.hasMatch()) {
+      extraction.kind = kind;
+      extraction.match = std::move(match);
+      break;
+    }
+  }
+  return extraction;
+}
+
+const QRegularExpression &LogLineClassifier::patternFor(LogLineKind kind) {
+  static const QRegularExpression systemChange(
+      R"(\[\s*([\d.\s:]+)\]\s*EVE System\s*>\s*Channel changed to Local\s*:\s*(.+))",
+      QRegularExpression::CaseInsensitiveOption |
+          QRegularExpression::UseUnicodePropertiesOption);
+  static const QRegularExpression fleetInvite(
+      R"(\[\s*[\d.\s:]+\]\s*\(question\)\s*<a href="[^"]+">([^<]+)</a>\s*wants you to join their fleet)");
+  static const QRegularExpression followWarp(
+      R"(\[\s*[\d.\s:]+\]\s*\(notify\)\s*Following\s+(.+?)\s+in warp)");
+  static const QRegularExpression regroup(
+      R"(\[\s*[\d.\s:]+\]\s*\(notify\)\s*Regrouping to\s+(.+?)(?:\.|$))");
+  static const QRegularExpression compression(
+      R"(\[\s*[\d.\s:]+\]\s*\(notify\)\s*Successfully compressed\s+(.+?)\s+into\s+(\d+)\s+(.+))");
+  static const QRegularExpression decloak(
+      R"(\[\s*[\d.\s:]+\]\s*\(notify\)\s*Your cloak deactivates due to proximity to (?:a nearby )?(.+?)\.)");
+  static const QRegularExpression crystalBroke(
+      R"(\[\s*[\d.\s:]+\]\s*\(notify\)\s*(.+?)\s+deactivates due to the destruction of the\s+(.+?)\s+it was fitted with)");
+  static const QRegularExpression asteroidDepleted(
+      R"(\[\s*[\d.\s:]+\]\s*\(notify\)\s*(.+?)\s+deactivates as it finds the resource it was harvesting a pale shadow of its former glory)");
+  // "(notify) A Conduit Field activated by ... jumps you to [system]"
+  static const QRegularExpression conduitJump(
+      R"(\[\s*([\d.\s:]+)\]\s*\(notify\)\s*A Conduit Field activated by .+ jumps you to\s+(.+))");
+  static const QRegularExpression mining(R"(\[\s*[\d.\s:]+\]\s*\(mining\))");
+  static const QRegularExpression jump(
+      R"(\[\s*([\d.\s:]+)\]\s*\(None\)\s*Jumping from\s+(.+?)\s+to\s+(.+))");
+  // "(None) <a href=showinfo:...> ... </a> is inviting you to a
+  // conversation". Only sent by pilots not in the receiver's contacts.
+  static const QRegularExpression convoRequest(
+      R"(\[ ([^\]]+) \] \(None\) <a href=showinfo:\d+//\d+>([^<]+)</a> is inviting you to a conversation\.)");
+  static const QRegularExpression never(R"((?!))");
+
+  switch (kind) {
+  case LogLineKind::SystemChange:
+    return systemChange;
+  case LogLineKind::FleetInvite:
+    return fleetInvite;
+  case LogLineKind::FollowWarp:
+    return followWarp;
+  case LogLineKind::Regroup:
+    return regroup;
+  case LogLineKind::Compression:
+    return compression;
+  case LogLineKind::Decloak:
+    return decloak;
+  case LogLineKind::CrystalBroke:
+    return crystalBroke;
+  case LogLineKind::AsteroidDepleted:
+    return asteroidDepleted;
+  case LogLineKind::ConduitJump:
+    return conduitJump;
+  case LogLineKind::Mining:
+    return mining;
+  case LogLineKind::Jump:
+    return jump;
+  case LogLineKind::ConvoRequest:
+    return convoRequest;
+  case LogLineKind::Unrecognized:
+    break;
+  }
+  return never;
+}
@@ -0,0 +1,129 @@
+#include "logpipelinestats.h"
+#include <QDateTime>
+#include <QStringList>
+#include <QtAlgorithms>
+
+void LogLatencyHistogram::record(qint64 micros) {
+  const quint64 value = micros > 0 ? quint64(micros) : 0;
+
+  // Index of the first power of two above the value
+  int bucket = value == 0 ? 0 : 64 - qCountLeadingZeroBits(value);
+  if (bucket >= BUCKET_COUNT) {
+    bucket = BUCKET_COUNT - 1;
+  }
+
+  m_buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+  m_count.fetch_add(1, std::memory_order_relaxed);
+  m_totalMicros.fetch_add(value, std::memory_order_relaxed);
+
+  quint64 currentMax = m_maxMicros.load(std::memory_order_relaxed);
+  while (value > currentMax &&
+         !m_maxMicros.compare_exchange_weak(currentMax, value,
+                                            std::memory_order_relaxed)) {
+  }
+}
+
+LogLatencyHistogram::Snapshot LogLatencyHistogram::snapshot() const {
+  Snapshot result;
+  for (int i = 0; i < BUCKET_COUNT; ++i) {
+    result.buckets[i] = m_buckets[i].load(std::memory_order_relaxed);
+  }
+  result.count = m_count.load(std::memory_order_relaxed);
+  result.totalMicros = m_totalMicros.load(std::memory_order_relaxed);
+  result.maxMicros = m_maxMicros.load(std::memory_order_relaxed);
+  return result;
+}
+
+double LogLatencyHistogram::Snapshot::meanMicros() const {
+  return count == 0 ? 0.0 : double(totalMicros) / double(count);
+}
+
+quint64
+LogLatencyHistogram::Snapshot::percentileMicros(double percentile) const {
+  // Buckets are read one by one while other threads record, so their sum
+  // rather than count is the population
+  quint64 population = 0;
+  for (quint64 bucketCount : buckets) {
+    population += bucketCount;
+  }
+  if (population == 0) {
+    return 0;
+  }
+
+  const quint64 rank = qMax<quint64>(
+      1, quint64(double(population) * qBound(0.0, percentile, 100.0) / 100.0));
+
+  quint64 seen = 0;
+  for (int i = 0; i < BUCKET_COUNT; ++i) {
+    seen += buckets[i];
+    if (seen >= rank) {
+      return i == BUCKET_COUNT - 1 ? maxMicros : (quint64(1) << i);
+    }
+  }
+  return maxMicros;
+}
+
+LogPipelineStatsSnapshot LogPipelineStats::snapshot() const {
+  LogPipelineStatsSnapshot result;
+  result.timestamp = QDateTime::currentMSecsSinceEpoch();
+  result.bytesRead = bytesRead.load(std::memory_order_relaxed);
+  result.linesScanned = linesScanned.load(std::memory_order_relaxed);
+  result.linesPrefiltered = linesPrefiltered.load(std::memory_order_relaxed);
+  result.linesParsed = linesParsed.load(std::memory_order_relaxed);
+  result.eventsEmitted = eventsEmitted.load(std::memory_order_relaxed);
+  result.eventsDroppedStale =
+      eventsDroppedStale.load(std::memory_order_relaxed);
+  result.polls = polls.load(std::memory_order_relaxed);
+  result.parseTime = parseTime.snapshot();
+  result.fileReadLatency = fileReadLatency.snapshot();
+  result.pollDuration = pollDuration.snapshot();
+  result.eventDelay = eventDelay.snapshot();
+  result.deliveryDelay = deliveryDelay.snapshot();
+  result.profileSwitch = profileSwitch.snapshot();
+  return result;
+}
+
+QString LogPipelineStatsSnapshot::csvHeader() {
+  QStringList columns = {"timestamp",      "bytes_read",
+                         "lines_scanned",  "lines_prefiltered",
+                         "lines_parsed",   "events_emitted",
+                         "events_stale",   "polls"};
+
+  const QStringList histograms = {"parse",          "file_read",
+                                  "poll",           "event_delay",
+                                  "delivery_delay", "profile_switch"};
+  const QStringList fields = {"count", "mean_us", "p50_us", "p99_us",
+                              "max_us"};
+
+  for (const QString &histogram : histograms) {
+    for (const QString &field : fields) {
+      columns.append(histogram + '_' + field);
+    }
+  }
+
+  return columns.join(',');
+}
+
+QString LogPipelineStatsSnapshot::toCsvRow() const {
+  QStringList values = {
+      QDateTime::fromMSecsSinceEpoch(timestamp).toString(Qt::ISODateWithMs),
+      QString::number(bytesRead),
+      QString::number(linesScanned),
+      QString::number(linesPrefiltered),
+      QString::number(linesParsed),
+      QString::number(eventsEmitted),
+      QString::number(eventsDroppedStale),
+      QString::number(polls)};
+
+  for (const LogLatencyHistogram::Snapshot *histogram :
+       {&parseTime, &fileReadLatency, &pollDuration, &eventDelay,
+        &deliveryDelay, &profileSwitch}) {
+    values.append(QString::number(histogram->count));
+    values.append(QString::number(histogram->meanMicros(), 'f', 1));
+    values.append(QString::number(histogram->percentileMicros(50)));
+    values.append(QString::number(histogram->percentileMicros(99)));
+    values.append(QString::number(histogram->maxMicros));
+  }
+
+  return values.join(',');
+}
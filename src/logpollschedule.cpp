@@ -0,0 +1,20 @@
+#include "logpollschedule.h"
+
+bool LogPollSchedule::isLive(bool clientRunning, qint64 lastWriteMs,
+                             qint64 nowMs) {
+  return clientRunning || nowMs - lastWriteMs < RECENT_WRITE_MS;
+}
+
+int LogPollSchedule::intervalMs(int idlePolls, bool live, bool notified) {
+  const int maxLevel = live ? LIVE_MAX_LEVEL : DORMANT_MAX_LEVEL;
+  const int level = qMin(idlePolls / IDLE_POLLS_PER_LEVEL, maxLevel);
+  int interval = TICK_MS << level;
+
+  // Polling only catches missed notifications. Until they are seen the
+  // file keeps its normal rate, as the watcher may never fire for it.
+  if (notified) {
+    interval = qMax(interval, NOTIFIED_FALLBACK_MS);
+  }
+
+  return interval;
+}
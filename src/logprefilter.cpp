@@ -0,0 +1,216 @@
+#include "logprefilter.h"
+#include <QtAlgorithms>
+#include <iterator>
+
+#if defined(__SSE2__) || defined(_M_X64) ||                                    \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define LOGPREFILTER_USE_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+struct Needle {
+  const char *text; // ASCII only
+  int length;       // In characters
+};
+
+constexpr Needle CHAT_NEEDLES[] = {{"EVE System", 10}};
+
+constexpr Needle GAME_NEEDLES[] = {{"(notify)", 8},   {"(None)", 6},
+                                   {"(question)", 10}, {"(mining)", 8},
+                                   {"Jumping", 7},     {"Undocking", 9}};
+
+constexpr Needle COMBAT_NEEDLE = {"(combat)", 8};
+
+inline unsigned char foldAscii(unsigned char c) {
+  return (c >= 'A' && c <= 'Z') ? static_cast<unsigned char>(c | 0x20) : c;
+}
+
+/// Exact check of a needle at p; unit is the code unit size in bytes
+inline bool matchesAt(const char *p, const Needle &needle, int unit) {
+  for (int k = 0; k < needle.length; ++k) {
+    const unsigned char c = static_cast<unsigned char>(p[k * unit]);
+    if (foldAscii(c) != foldAscii(static_cast<unsigned char>(needle.text[k]))) {
+      return false;
+    }
+    if (unit == 2 && p[k * 2 + 1] != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/// Finds the next '\n' code unit at or after from, or -1 if the rest of the
+/// data holds no complete line. from must be aligned to the code unit size.
+qsizetype findNewline(const char *data, qsizetype size, qsizetype from,
+                      int unit) {
+  qsizetype i = from;
+
+#ifdef LOGPREFILTER_USE_SSE2
+  const __m128i newline = _mm_set1_epi8('\n');
+  while (i + 16 <= size) {
+    const __m128i block =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+    unsigned int mask = static_cast<unsigned int>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(block, newline)));
+    while (mask) {
+      const qsizetype pos = i + qCountTrailingZeroBits(mask);
+      if (unit == 1) {
+        return pos;
+      }
+      // UTF-16LE: low byte on an even offset, high byte zero
+      if (((pos - from) & 1) == 0 && pos + 1 < size && data[pos + 1] == 0) {
+        return pos;
+      }
+      mask &= mask - 1;
+    }
+    i += 16;
+  }
+#endif
+
+  for (; i < size; ++i) {
+    if (data[i] != '\n') {
+      continue;
+    }
+    if (unit == 1) {
+      return i;
+    }
+    if (((i - from) & 1) == 0 && i + 1 < size && data[i + 1] == 0) {
+      return i;
+    }
+  }
+
+  return -1;
+}
+
+/// Searches [start, end) for needle. Candidates are found by comparing the
+/// first and last character of the needle at once (both case-folded with
+/// 0x20, which over-matches a few punctuation bytes) and are then verified
+/// exactly.
+bool containsNeedle(const char *data, qsizetype start, qsizetype end,
+                    const Needle &needle, int unit) {
+  const qsizetype needleBytes = qsizetype(needle.length) * unit;
+  if (end - start < needleBytes) {
+    return false;
+  }
+
+  const qsizetype lastOffset = needleBytes - unit;
+  const qsizetype limit = end - needleBytes; // Last valid start (inclusive)
+  qsizetype i = start;
+
+#ifdef LOGPREFILTER_USE_SSE2
+  const __m128i caseBit = _mm_set1_epi8(0x20);
+  const __m128i first = _mm_set1_epi8(static_cast<char>(needle.text[0] | 0x20));
+  const __m128i last =
+      _mm_set1_epi8(static_cast<char>(needle.text[needle.length - 1] | 0x20));
+
+  while (i + 15 <= limit) {
+    const __m128i a = _mm_or_si128(
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i)), caseBit);
+    const __m128i b = _mm_or_si128(
+        _mm_loadu_si128(
+            reinterpret_cast<const __m128i *>(data + i + lastOffset)),
+        caseBit);
+    unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(
+        _mm_and_si128(_mm_cmpeq_epi8(a, first), _mm_cmpeq_epi8(b, last))));
+    while (mask) {
+      const qsizetype pos = i + qCountTrailingZeroBits(mask);
+      if ((pos - start) % unit == 0 && matchesAt(data + pos, needle, unit)) {
+        return true;
+      }
+      mask &= mask - 1;
+    }
+    i += 16;
+  }
+#endif
+
+  for (; i <= limit; i += unit) {
+    if (matchesAt(data + i, needle, unit)) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+} // namespace
+
+LogPrefilter::ScanResult
+LogPrefilter::scan(QByteArrayView data, bool isChatLog,
+                   QVector<LineRange> &candidates, qsizetype searchFrom,
+                   bool includeCombat) {
+  ScanResult result{0, 0};
+
+  const char *bytes = data.data();
+  const qsizetype size = data.size();
+  const int unit = isChatLog ? 2 : 1;
+
+  const Needle *needles = isChatLog ? CHAT_NEEDLES : GAME_NEEDLES;
+  const int needleCount =
+      isChatLog ? int(std::size(CHAT_NEEDLES)) : int(std::size(GAME_NEEDLES));
+
+  // Combat lines dominate game logs in a fight, so they are tested first
+  const bool checkCombat = includeCombat && !isChatLog;
+
+  qsizetype lineStart = 0;
+  while (lineStart < size) {
+    const qsizetype newline =
+        findNewline(bytes, size, qMax(lineStart, searchFrom), unit);
+    if (newline < 0) {
+      break;
+    }
+
+    ++result.linesScanned;
+
+    bool candidate =
+        checkCombat &&
+        containsNeedle(bytes, lineStart, newline, COMBAT_NEEDLE, unit);
+    for (int n = 0; !candidate && n < needleCount; ++n) {
+      candidate = containsNeedle(bytes, lineStart, newline, needles[n], unit);
+    }
+    if (candidate) {
+      candidates.append({lineStart, newline - lineStart});
+    }
+
+    lineStart = newline + unit;
+  }
+
+  result.consumed = lineStart;
+  return result;
+}
+
+LogPrefilter::ScanResult
+LogPrefilter::splitLines(QByteArrayView data, bool isChatLog,
+                         QVector<LineRange> &lines, qsizetype searchFrom) {
+  ScanResult result{0, 0};
+
+  const int unit = isChatLog ? 2 : 1;
+
+  qsizetype lineStart = 0;
+  while (lineStart < data.size()) {
+    const qsizetype newline = findNewline(data.data(), data.size(),
+                                          qMax(lineStart, searchFrom), unit);
+    if (newline < 0) {
+      break;
+    }
+
+    ++result.linesScanned;
+    lines.append({lineStart, newline - lineStart});
+    lineStart = newline + unit;
+  }
+
+  result.consumed = lineStart;
+  return result;
+}
+
+qsizetype LogPrefilter::searchedTail(qsizetype tailSize, bool isChatLog) {
+  // A trailing half UTF-16 code unit has not been checked yet
+  return isChatLog ? (tailSize & ~qsizetype(1)) : tailSize;
+}
+
+qsizetype LogPrefilter::nextLineStart(QByteArrayView data, bool isChatLog) {
+  const int unit = isChatLog ? 2 : 1;
+  const qsizetype newline = findNewline(data.data(), data.size(), 0, unit);
+  return newline < 0 ? -1 : newline + unit;
+}
@@ -9,7 +9,9 @@
 #include "windowcapture.h"
 #include <QAction>
 #include <QCoreApplication>
+#include <QDateTime>
 #include <QDir>
+#include <QElapsedTimer>
 #include <QFile>
 #include <QFileInfo>
 #include <QFont>
@@ -205,6 +207,7 @@ MainWindow::MainWindow(QObject *parent)
   m_chatLogReader = std::make_unique<ChatLogReader>();
 
   const Config &cfgChatLog = Config::instance();
+  m_chatLogReader->setDataDirectory(cfgChatLog.getProfilesDirectory());
   QString chatLogDirectory = cfgChatLog.chatLogDirectory();
   QString gameLogDirectory = cfgChatLog.gameLogDirectory();
   m_chatLogReader->setLogDirectory(chatLogDirectory);
@@ -214,6 +217,18 @@ MainWindow::MainWindow(QObject *parent)
   bool enableGameLog = cfgChatLog.enableGameLogMonitoring();
   m_chatLogReader->setEnableChatLogMonitoring(enableChatLog);
   m_chatLogReader->setEnableGameLogMonitoring(enableGameLog);
+  m_chatLogReader->setEventDrivenMonitoring(
+      cfgChatLog.eventDrivenLogMonitoring());
+  m_chatLogReader->setMiningTimeout(cfgChatLog.miningTimeoutSeconds());
+  m_chatLogReader->setCustomNames(cfgChatLog.getAllCustomThumbnailNames());
+  m_chatLogReader->setWorkerCount(cfgChatLog.logWorkerCount());
+  m_chatLogReader->setBatchedDelivery(cfgChatLog.batchedLogEventDelivery());
+  m_chatLogReader->setStatsDumpInterval(
+      cfgChatLog.logStatsDumpIntervalSeconds());
+  m_chatLogReader->setIntelChannels(cfgChatLog.intelChannels());
+  m_chatLogReader->setCombatDamageTracking(cfgChatLog.combatDamageTracking());
+  m_chatLogReader->setLogAlertRules(cfgChatLog.logAlertRules());
+  m_chatLogReader->setMaxEventAge(cfgChatLog.logMaxEventAgeSeconds());
 
   QDir chatLogDir(chatLogDirectory);
   if (chatLogDir.exists()) {
@@ -233,6 +248,12 @@ MainWindow::MainWindow(QObject *parent)
           &MainWindow::onCharacterSystemChanged);
   connect(m_chatLogReader.get(), &ChatLogReader::combatEventDetected, this,
           &MainWindow::onCombatEventDetected);
+  connect(m_chatLogReader.get(), &ChatLogReader::eventsBatched, this,
+          &MainWindow::onLogEventsBatched);
+  connect(m_chatLogReader.get(), &ChatLogReader::intelReported, this,
+          &MainWindow::onIntelReported);
+  connect(m_chatLogReader.get(), &ChatLogReader::combatStatsUpdated, this,
+          &MainWindow::onCombatStatsUpdated);
 
   if (enableChatLog || enableGameLog) {
     m_chatLogReader->start();
@@ -2085,6 +2106,9 @@ void MainWindow::showSettings() {
       it.value()->forceOverlayRender();
     }
     updateProfilesMenu();
+
+    // Profiles may have been edited, created or removed in the dialog
+    Config::instance().preloadProfiles();
   });
 
   m_configDialog->show();
@@ -2101,17 +2125,36 @@ void MainWindow::handleProfileSwitch(const QString &profileName) {
 
   qDebug() << "Switching from profile" << currentProfile << "to" << profileName;
 
-  cfg.save();
-  hotkeyManager->saveToConfig();
+  QElapsedTimer switchTimer;
+  switchTimer.start();
+
+  // Both profiles come from memory: the current one with the changes
+  // still being written, the other one as preloaded. Nothing is written or
+  // read here; only what differs between them is applied.
+  const SettingsMap from = cfg.currentProfileValues();
+  const SettingsMap to = cfg.profileValues(profileName);
 
   if (cfg.loadProfile(profileName)) {
-    applySettings();
+    const ProfileDiff diff = Config::diffProfiles(from, to);
+    applyProfileDiff(diff, to);
+
+    const qint64 elapsedMicros = switchTimer.nsecsElapsed() / 1000;
+    if (m_chatLogReader) {
+      m_chatLogReader->recordProfileSwitch(elapsedMicros);
+    }
 
     emit profileSwitchedExternally(profileName);
 
     updateProfilesMenu();
 
-    qDebug() << "Successfully switched to profile:" << profileName;
+    qDebug() << "Successfully switched to profile:" << profileName << "in"
+             << elapsedMicros << "us (hotkeys:" << diff.hotkeys
+             << "layout:" << diff.layout << "overlays:" << diff.overlays
+             << "logs:" << diff.logMonitoring
+             << "thumbnails:" << diff.thumbnails.size() << ")";
+
+    // Profiles written since they were last read are parsed again
+    cfg.preloadProfiles();
   } else {
     qWarning() << "Failed to switch to profile:" << profileName;
   }
@@ -2172,7 +2215,6 @@ void MainWindow::handleCycleProfileBackward() {
 void MainWindow::applySettings() {
   qDebug()
       << "MainWindow::applySettings - updating thumbnails and overlay caches";
-  const Config &cfg = Config::instance();
   m_cycleIndexByGroup.clear();
   m_lastActivatedWindowByGroup.clear();
   m_notLoggedInCycleIndex = -1;
@@ -2182,7 +2224,61 @@ void MainWindow::applySettings() {
 
   hotkeyManager->loadFromConfig();
 
-  if (!cfg.minimizeInactiveClients()) {
+  applyThumbnailSettings(nullptr);
+
+  applyLogMonitoringSettings();
+
+  updateActiveWindow();
+
+  refreshWindows();
+}
+
+void MainWindow::applyProfileDiff(const ProfileDiff &diff,
+                                  const SettingsMap &to) {
+  if (diff.hotkeys) {
+    m_cycleIndexByGroup.clear();
+    m_lastActivatedWindowByGroup.clear();
+    m_notLoggedInCycleIndex = -1;
+    m_nonEVECycleIndex = -1;
+
+    hotkeyManager->applyProfileHotkeys(to);
+  }
+
+  if (diff.layout) {
+    m_clientLocationMoveAttempted.clear();
+    m_clientLocationRetryCount.clear();
+  }
+
+  // Thumbnails may have been moved or resized since the profile was saved,
+  // so geometry and visibility are checked against every thumbnail
+  applyThumbnailSettings(&diff);
+
+  if (diff.logMonitoring) {
+    applyLogMonitoringSettings();
+  } else if (!diff.thumbnails.isEmpty() && m_chatLogReader) {
+    m_chatLogReader->setCustomNames(
+        Config::instance().getAllCustomThumbnailNames());
+  }
+
+  if (diff.layout || diff.overlays) {
+    updateActiveWindow();
+  }
+
+  if (diff.layout) {
+    refreshWindows();
+  }
+}
+
+void MainWindow::applyThumbnailSettings(const ProfileDiff *diff) {
+  const Config &cfg = Config::instance();
+
+  // Without a diff every setting is applied to every thumbnail. With one,
+  // thumbnails are only resized, moved, shown or hidden where that differs
+  // from their current state, and restyled where their settings changed.
+  const bool applyAll = !diff || diff->layout;
+  const bool restyleAll = applyAll || diff->overlays;
+
+  if (applyAll && !cfg.minimizeInactiveClients()) {
     for (auto it = thumbnails.begin(); it != thumbnails.end(); ++it) {
       HWND hwnd = it.key();
       if (IsWindow(hwnd) && IsIconic(hwnd)) {
@@ -2213,6 +2309,9 @@ void MainWindow::applySettings() {
   const HWND currentActiveWindow = GetForegroundWindow();
   const bool isEVECurrentlyFocused = thumbnails.contains(currentActiveWindow);
 
+  const qreal opacity = cfg.thumbnailOpacity() / 100.0;
+  const bool alwaysOnTop = cfg.alwaysOnTop();
+
   for (auto it = thumbnails.begin(); it != thumbnails.end(); ++it) {
     HWND hwnd = it.key();
     ThumbnailWidget *thumb = it.value();
@@ -2221,6 +2320,13 @@ void MainWindow::applySettings() {
     bool isEVEClient =
         processName.compare("exefile.exe", Qt::CaseInsensitive) == 0;
 
+    // Characters and processes whose own settings differ between profiles
+    const QString ownSettingsKey =
+        isEVEClient ? m_windowToCharacter.value(hwnd) : processName;
+    const bool applyThis =
+        applyAll || (!ownSettingsKey.isEmpty() &&
+                     diff->thumbnails.contains(ownSettingsKey.toLower()));
+
     QSize newSize(thumbWidth, thumbHeight);
     if (isEVEClient) {
       QString characterName = m_windowToCharacter.value(hwnd);
@@ -2229,11 +2335,13 @@ void MainWindow::applySettings() {
           newSize = cfg.getThumbnailSize(characterName);
         }
 
-        QString customName = cfg.getCustomThumbnailName(characterName);
-        if (!customName.isEmpty()) {
-          thumb->setCustomName(customName);
-        } else {
-          thumb->setCustomName(QString());
+        if (applyThis) {
+          QString customName = cfg.getCustomThumbnailName(characterName);
+          if (!customName.isEmpty()) {
+            thumb->setCustomName(customName);
+          } else {
+            thumb->setCustomName(QString());
+          }
         }
       }
     } else if (!isEVEClient && cfg.hasCustomProcessThumbnailSize(processName)) {
@@ -2246,9 +2354,15 @@ void MainWindow::applySettings() {
       thumb->forceUpdate();
     }
 
-    thumb->setWindowOpacity(cfg.thumbnailOpacity() / 100.0);
+    if (!diff || !qFuzzyCompare(thumb->windowOpacity(), opacity)) {
+      thumb->setWindowOpacity(opacity);
+    }
 
-    thumb->updateWindowFlags(cfg.alwaysOnTop());
+    // Changing window flags recreates the native window
+    if (!diff || thumb->windowFlags().testFlag(Qt::WindowStaysOnTopHint) !=
+                     alwaysOnTop) {
+      thumb->updateWindowFlags(alwaysOnTop);
+    }
 
     QPoint savedPos(-1, -1);
     bool hasSavedPosition = false;
@@ -2270,6 +2384,7 @@ void MainWindow::applySettings() {
       }
     }
 
+    QPoint targetPos;
     if (hasSavedPosition) {
       QRect thumbRect(savedPos, newSize);
       QScreen *targetScreen = nullptr;
@@ -2281,7 +2396,7 @@ void MainWindow::applySettings() {
       }
 
       if (targetScreen) {
-        thumb->move(savedPos);
+        targetPos = savedPos;
       } else {
         hasSavedPosition = false;
       }
@@ -2292,8 +2407,7 @@ void MainWindow::applySettings() {
       bool isNotLoggedIn = isEVEClient && characterName.isEmpty();
 
       if (isNotLoggedIn) {
-        QPoint pos = calculateNotLoggedInPosition(notLoggedInCount);
-        thumb->move(pos);
+        targetPos = calculateNotLoggedInPosition(notLoggedInCount);
         notLoggedInCount++;
       } else {
         if (xOffset + thumbWidth > screenWidth - margin) {
@@ -2305,21 +2419,33 @@ void MainWindow::applySettings() {
           yOffset = margin;
         }
 
-        thumb->move(xOffset, yOffset);
+        targetPos = QPoint(xOffset, yOffset);
         xOffset += thumbWidth + margin;
       }
     }
 
-    thumb->refreshSystemColor();
-    thumb->updateOverlays();
-    thumb->forceOverlayRender();
+    // Every thumbnail's slot is worked out above, as automatic placement
+    // depends on the ones before it, but only those that end up elsewhere
+    // are moved
+    if (thumb->pos() != targetPos) {
+      thumb->move(targetPos);
+    }
+
+    if (restyleAll || applyThis) {
+      thumb->refreshSystemColor();
+      thumb->updateOverlays();
+      thumb->forceOverlayRender();
 
-    thumb->QWidget::update();
+      thumb->QWidget::update();
+    }
 
     // Apply visibility using centralized logic
     updateThumbnailVisibility(hwnd);
   }
+}
 
+void MainWindow::applyLogMonitoringSettings() {
+  const Config &cfg = Config::instance();
   if (m_chatLogReader) {
     QString chatLogDirectory = cfg.chatLogDirectory();
     QString gameLogDirectory = cfg.gameLogDirectory();
@@ -2330,6 +2456,16 @@ void MainWindow::applySettings() {
     bool enableGameLog = cfg.enableGameLogMonitoring();
     m_chatLogReader->setEnableChatLogMonitoring(enableChatLog);
     m_chatLogReader->setEnableGameLogMonitoring(enableGameLog);
+    m_chatLogReader->setEventDrivenMonitoring(cfg.eventDrivenLogMonitoring());
+    m_chatLogReader->setWorkerCount(cfg.logWorkerCount());
+    m_chatLogReader->setBatchedDelivery(cfg.batchedLogEventDelivery());
+    m_chatLogReader->setStatsDumpInterval(cfg.logStatsDumpIntervalSeconds());
+    m_chatLogReader->setIntelChannels(cfg.intelChannels());
+    m_chatLogReader->setCombatDamageTracking(cfg.combatDamageTracking());
+    m_chatLogReader->setLogAlertRules(cfg.logAlertRules());
+    m_chatLogReader->setMaxEventAge(cfg.logMaxEventAgeSeconds());
+    m_chatLogReader->setMiningTimeout(cfg.miningTimeoutSeconds());
+    m_chatLogReader->setCustomNames(cfg.getAllCustomThumbnailNames());
 
     bool shouldMonitor = enableChatLog || enableGameLog;
 
@@ -2351,10 +2487,6 @@ void MainWindow::applySettings() {
                << enableChatLog << ", GameLog:" << enableGameLog << ")";
     }
   }
-
-  updateActiveWindow();
-
-  refreshWindows();
 }
 
 void MainWindow::restartApplication() {
@@ -2371,6 +2503,7 @@ void MainWindow::reloadThumbnails() {
   m_characterToWindow.clear();
   m_windowToCharacter.clear();
   m_characterSystems.clear();
+  m_characterSystemTimes.clear();
   m_cycleIndexByGroup.clear();
   m_lastActivatedWindowByGroup.clear();
   m_windowCreationTimes.clear();
@@ -2430,7 +2563,16 @@ void MainWindow::exitApplication() {
 }
 
 void MainWindow::onCharacterSystemChanged(const QString &characterName,
-                                          const QString &systemName) {
+                                          const QString &systemName,
+                                          qint64 timestamp) {
+  // The chatlog and the gamelog of a character both report its system; a
+  // line read later must not undo a newer one from the other log
+  auto known = m_characterSystemTimes.constFind(characterName);
+  if (known != m_characterSystemTimes.constEnd() && *known > timestamp) {
+    return;
+  }
+  m_characterSystemTimes[characterName] = timestamp;
+
   qDebug() << "MainWindow: Character" << characterName << "moved to system"
            << systemName;
 
@@ -2447,7 +2589,8 @@ void MainWindow::onCharacterSystemChanged(const QString &characterName,
 
 void MainWindow::onCombatEventDetected(const QString &characterName,
                                        const QString &eventType,
-                                       const QString &eventText) {
+                                       const QString &eventText,
+                                       qint64 timestamp) {
   qDebug() << "MainWindow: Combat event for" << characterName
            << "- Type:" << eventType << "- Text:" << eventText;
 
@@ -2457,7 +2600,9 @@ void MainWindow::onCombatEventDetected(const QString &characterName,
     return;
   }
 
-  if (!cfg.isCombatEventTypeEnabled(eventType)) {
+  // Alert rules are enabled one by one in the profile
+  const bool isAlert = eventType.startsWith(LogAlertRule::EVENT_TYPE_PREFIX);
+  if (!isAlert && !cfg.isCombatEventTypeEnabled(eventType)) {
     qDebug() << "MainWindow: Event type" << eventType
              << "is disabled in settings";
     return;
@@ -2473,12 +2618,27 @@ void MainWindow::onCombatEventDetected(const QString &characterName,
     }
 
     ThumbnailWidget *widget = thumbnails[hwnd];
-    widget->setCombatMessage(eventText, eventType);
+
+    // A fleet warp or regroup reaches every member's gamelog; only the
+    // first of them plays a sound and all messages expire together. The
+    // lines are matched by their log time, however late a log was read.
+    const bool fleetEvent =
+        eventType == "follow_warp" || eventType == "regroup";
+    bool firstOfGroup = true;
+    if (fleetEvent && cfg.correlateFleetEvents()) {
+      const LogEventCorrelator::Result group =
+          m_eventCorrelator.add(eventType, eventText, timestamp);
+      firstOfGroup = group.opened;
+      widget->setCombatMessage(eventText, eventType,
+                               fleetEventTimer(group.groupId, eventType));
+    } else {
+      widget->setCombatMessage(eventText, eventType);
+    }
     qDebug() << "MainWindow: Updated thumbnail for" << characterName
              << "with combat message:" << eventText;
 
     // Play sound notification if enabled
-    if (cfg.combatEventSoundEnabled(eventType)) {
+    if (firstOfGroup && cfg.combatEventSoundEnabled(eventType)) {
       QString soundFile = cfg.combatEventSoundFile(eventType);
       if (!soundFile.isEmpty() && QFile::exists(soundFile)) {
         m_soundEffect->setSource(QUrl::fromLocalFile(soundFile));
@@ -2495,6 +2655,122 @@ void MainWindow::onCombatEventDetected(const QString &characterName,
   }
 }
 
+QTimer *MainWindow::fleetEventTimer(quint64 groupId,
+                                    const QString &eventType) {
+  QTimer *timer = m_fleetEventTimers.value(groupId, nullptr);
+  if (timer) {
+    return timer;
+  }
+
+  timer = new QTimer(this);
+  timer->setSingleShot(true);
+  connect(timer, &QTimer::timeout, this, [this, groupId, timer]() {
+    m_fleetEventTimers.remove(groupId);
+    timer->deleteLater();
+  });
+  timer->start(Config::instance().combatEventDuration(eventType));
+
+  m_fleetEventTimers.insert(groupId, timer);
+  return timer;
+}
+
+void MainWindow::onLogEventsBatched(const LogEventBatch &events) {
+  // One pass over the batch: combat events in order, and only the last
+  // system of each character, so each thumbnail is given its system once.
+  // Thumbnails only schedule a repaint, so every affected thumbnail is
+  // painted once after the whole batch has been applied.
+  QHash<QString, const LogEvent *> systemChanges;
+  for (const LogEvent &event : events) {
+    if (event.type == LogEvent::SystemChange) {
+      systemChanges[event.characterName] = &event;
+    } else {
+      onCombatEventDetected(event.characterName, event.eventType, event.text,
+                            event.timestamp);
+    }
+  }
+
+  for (const LogEvent *event : std::as_const(systemChanges)) {
+    onCharacterSystemChanged(event->characterName, event->text,
+                             event->timestamp);
+  }
+}
+
+void MainWindow::onIntelReported(const QString &channel,
+                                 const QString &systemName,
+                                 const QString &text) {
+  qDebug() << "MainWindow: Intel in" << channel << "for" << systemName << "-"
+           << text;
+
+  const Config &cfg = Config::instance();
+  if (!cfg.showCombatMessages()) {
+    return;
+  }
+
+  const int alertJumps = cfg.intelAlertJumps();
+  if (alertJumps > 0 && !m_starMap) {
+    // A gate list in the profiles directory replaces the bundled one
+    QString starMapPath = cfg.getProfilesDirectory() + "/stargates.txt";
+    if (!QFile::exists(starMapPath)) {
+      starMapPath = ":/stargates.txt";
+    }
+    m_starMap = std::make_unique<StarMap>();
+    m_starMap->load(starMapPath);
+  }
+
+  const QStringList characters = m_characterSystems.keys();
+  QStringList systems;
+  systems.reserve(characters.size());
+  for (const QString &characterName : characters) {
+    systems.append(m_characterSystems.value(characterName));
+  }
+
+  // One search from the reported system covers every character
+  QVector<int> jumps(systems.size(), -1);
+  if (alertJumps > 0) {
+    jumps = m_starMap->jumpDistancesTo(systemName, systems, alertJumps);
+  }
+
+  for (int i = 0; i < characters.size(); ++i) {
+    // Systems missing from the star map still match by name
+    const int distance =
+        systems[i].compare(systemName, Qt::CaseInsensitive) == 0 ? 0
+                                                                 : jumps[i];
+    if (distance < 0) {
+      continue;
+    }
+
+    HWND hwnd = m_characterToWindow.value(characters[i]);
+    if (hwnd && thumbnails.contains(hwnd)) {
+      const QString message =
+          distance == 0
+              ? QString("%1: %2").arg(channel, text)
+              : QString("%1 (%2j): %3")
+                    .arg(channel, QString::number(distance), text);
+      thumbnails[hwnd]->setCombatMessage(message, "intel");
+    }
+  }
+}
+
+void MainWindow::onCombatStatsUpdated(const CombatDamageStatsList &stats) {
+  for (const CombatDamageStats &entry : stats) {
+    HWND hwnd = m_characterToWindow.value(entry.characterName);
+    if (!hwnd || !thumbnails.contains(hwnd)) {
+      continue;
+    }
+
+    // 5 s rate first, 60 s average in parentheses
+    QString text;
+    if (!entry.isIdle()) {
+      text = QString("DPS out %1 (%2)  in %3 (%4)")
+                 .arg(qRound(entry.dpsOutShort))
+                 .arg(qRound(entry.dpsOutLong))
+                 .arg(qRound(entry.dpsInShort))
+                 .arg(qRound(entry.dpsInLong));
+    }
+    thumbnails[hwnd]->setDamageText(text);
+  }
+}
+
 void MainWindow::updateProfilesMenu() {
   if (!m_profilesMenu) {
     return;
@@ -0,0 +1,103 @@
+#include "profilepreloader.h"
+#include <QDebug>
+#include <QFileInfo>
+#include <QMutexLocker>
+
+ProfilePreloader::ProfilePreloader() { m_readPool.setMaxThreadCount(1); }
+
+ProfilePreloader::~ProfilePreloader() {
+  m_readPool.clear();
+  m_readPool.waitForDone();
+}
+
+ProfilePreloader::Entry ProfilePreloader::read(const QString &fileName) {
+  // Stat before reading: a file replaced while it is being read then looks
+  // out of date rather than current
+  const QFileInfo info(fileName);
+
+  Entry entry;
+  entry.size = info.size();
+  entry.modified = info.lastModified();
+  entry.values = SettingsMap::read(fileName);
+  return entry;
+}
+
+bool ProfilePreloader::isCurrent(const Entry &entry, const QString &fileName) {
+  const QFileInfo info(fileName);
+  return info.exists() && info.size() == entry.size &&
+         info.lastModified() == entry.modified;
+}
+
+void ProfilePreloader::insert(const QString &fileName, Entry entry) {
+  // A copy stored since the read started describes the same file at least
+  // as well as the read
+  QMutexLocker locker(&m_mutex);
+  auto it = m_entries.constFind(fileName);
+  if (it != m_entries.constEnd() && it->size == entry.size &&
+      it->modified == entry.modified) {
+    return;
+  }
+  m_entries.insert(fileName, std::move(entry));
+}
+
+void ProfilePreloader::preload(const QStringList &fileNames) {
+  QStringList stale;
+  {
+    QMutexLocker locker(&m_mutex);
+    for (auto it = m_entries.begin(); it != m_entries.end();) {
+      if (!fileNames.contains(it.key())) {
+        it = m_entries.erase(it);
+      } else {
+        ++it;
+      }
+    }
+
+    for (const QString &fileName : fileNames) {
+      auto it = m_entries.constFind(fileName);
+      if (it == m_entries.constEnd() || !isCurrent(*it, fileName)) {
+        stale.append(fileName);
+      }
+    }
+  }
+
+  if (stale.isEmpty()) {
+    return;
+  }
+
+  m_readPool.start([this, stale]() {
+    for (const QString &fileName : stale) {
+      insert(fileName, read(fileName));
+    }
+  });
+}
+
+SettingsMap ProfilePreloader::values(const QString &fileName) {
+  {
+    QMutexLocker locker(&m_mutex);
+    auto it = m_entries.constFind(fileName);
+    if (it != m_entries.constEnd() && isCurrent(*it, fileName)) {
+      return it->values;
+    }
+  }
+
+  qDebug() << "ProfilePreloader: Reading" << fileName << "on demand";
+  Entry entry = read(fileName);
+  SettingsMap values = entry.values;
+
+  QMutexLocker locker(&m_mutex);
+  m_entries.insert(fileName, std::move(entry));
+  return values;
+}
+
+void ProfilePreloader::store(const QString &fileName,
+                             const SettingsMap &values) {
+  const QFileInfo info(fileName);
+
+  Entry entry;
+  entry.size = info.size();
+  entry.modified = info.lastModified();
+  entry.values = values;
+
+  QMutexLocker locker(&m_mutex);
+  m_entries.insert(fileName, std::move(entry));
+}
@@ -0,0 +1,101 @@
+#include "settingsmap.h"
+#include <QSettings>
+
+QString SettingsMap::lookupKey(const QString &key) {
+#ifdef Q_OS_WIN
+  return key.toLower();
+#else
+  return key;
+#endif
+}
+
+SettingsMap SettingsMap::read(QSettings &settings) {
+  SettingsMap map;
+  const QStringList keys = settings.allKeys();
+  map.m_entries.reserve(keys.size());
+  for (const QString &key : keys) {
+    map.m_entries.insert(lookupKey(key), {key, settings.value(key)});
+  }
+  return map;
+}
+
+SettingsMap SettingsMap::read(const QString &fileName) {
+  QSettings settings(fileName, QSettings::IniFormat);
+  return read(settings);
+}
+
+bool SettingsMap::contains(const QString &key) const {
+  return m_entries.contains(lookupKey(key));
+}
+
+QVariant SettingsMap::value(const QString &key,
+                            const QVariant &defaultValue) const {
+  auto it = m_entries.constFind(lookupKey(key));
+  return it != m_entries.constEnd() ? it->value : defaultValue;
+}
+
+QStringList SettingsMap::childKeys(const QString &group) const {
+  const QString prefix = lookupKey(group) + '/';
+
+  QStringList children;
+  for (auto it = m_entries.cbegin(); it != m_entries.cend(); ++it) {
+    if (!it.key().startsWith(prefix) ||
+        it.key().indexOf('/', prefix.size()) >= 0) {
+      continue;
+    }
+    children.append(it->key.mid(prefix.size()));
+  }
+  return children;
+}
+
+void SettingsMap::setValue(const QString &key, const QVariant &value) {
+  m_entries.insert(lookupKey(key), {key, value});
+}
+
+void SettingsMap::remove(const QString &key) {
+  const QString removed = lookupKey(key);
+  const QString prefix = removed + '/';
+  for (auto it = m_entries.begin(); it != m_entries.end();) {
+    if (it.key() == removed || it.key().startsWith(prefix)) {
+      it = m_entries.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+bool SettingsMap::sameValue(const QVariant &a, const QVariant &b) {
+  if (a.metaType() == b.metaType()) {
+    return a == b;
+  }
+
+  // A value set in memory against the same value read back from the file,
+  // where numbers and booleans are strings and strings with commas lists
+  auto text = [](const QVariant &value) {
+    return value.metaType().id() == QMetaType::QStringList
+               ? value.toStringList().join(',')
+               : value.toString();
+  };
+  const bool aIsText = a.canConvert<QString>() ||
+                       a.metaType().id() == QMetaType::QStringList;
+  const bool bIsText = b.canConvert<QString>() ||
+                       b.metaType().id() == QMetaType::QStringList;
+  return aIsText && bIsText && text(a) == text(b);
+}
+
+QStringList SettingsMap::changedKeys(const SettingsMap &from,
+                                     const SettingsMap &to) {
+  QStringList changed;
+  for (auto it = to.m_entries.cbegin(); it != to.m_entries.cend(); ++it) {
+    auto old = from.m_entries.constFind(it.key());
+    if (old == from.m_entries.constEnd() || !sameValue(old->value, it->value)) {
+      changed.append(it->key);
+    }
+  }
+  for (auto it = from.m_entries.cbegin(); it != from.m_entries.cend(); ++it) {
+    if (!to.m_entries.contains(it.key())) {
+      changed.append(it->key);
+    }
+  }
+  return changed;
+}
@@ -0,0 +1,107 @@
+#include "settingswriter.h"
+#include <QDebug>
+#include <QSettings>
+
+SettingsWriter::SettingsWriter(const QString &fileName)
+    : m_fileName(fileName) {
+  m_debounceTimer.setSingleShot(true);
+  QObject::connect(&m_debounceTimer, &QTimer::timeout,
+                   [this]() { onDebounceTimeout(); });
+
+  m_writePool.setMaxThreadCount(1);
+}
+
+SettingsWriter::~SettingsWriter() { flushAndWait(); }
+
+void SettingsWriter::setFileName(const QString &fileName) {
+  flush();
+  m_fileName = fileName;
+}
+
+void SettingsWriter::setValue(const QString &key, const QVariant &value) {
+  m_pending.values.insert(key, value);
+  markDirty();
+}
+
+void SettingsWriter::remove(const QString &key) {
+  // Earlier values below the key must not be written after the removal
+  const QString prefix = key + '/';
+  for (auto it = m_pending.values.begin(); it != m_pending.values.end();) {
+    if (it.key() == key || it.key().startsWith(prefix)) {
+      it = m_pending.values.erase(it);
+    } else {
+      ++it;
+    }
+  }
+
+  m_pending.removals.insert(key);
+  markDirty();
+}
+
+void SettingsWriter::markDirty() {
+  m_sinceLastChange.start();
+
+  // The timer is armed once per burst rather than restarted on every
+  // change; onDebounceTimeout() extends it while changes keep coming
+  if (!m_debounceTimer.isActive()) {
+    m_sinceFirstChange.start();
+    m_debounceTimer.start(DEBOUNCE_MS);
+  }
+}
+
+void SettingsWriter::onDebounceTimeout() {
+  const qint64 quiet = m_sinceLastChange.elapsed();
+  if (quiet < DEBOUNCE_MS && m_sinceFirstChange.elapsed() < MAX_DELAY_MS) {
+    m_debounceTimer.start(int(DEBOUNCE_MS - quiet));
+    return;
+  }
+
+  flush();
+}
+
+void SettingsWriter::flush() {
+  m_debounceTimer.stop();
+  if (m_pending.isEmpty()) {
+    return;
+  }
+
+  Changes changes = std::move(m_pending);
+  m_pending = Changes();
+
+  const QString fileName = m_fileName;
+  m_writePool.start([fileName, changes = std::move(changes)]() {
+    write(fileName, changes);
+  });
+}
+
+void SettingsWriter::flushAndWait() {
+  m_debounceTimer.stop();
+  m_writePool.waitForDone();
+
+  if (m_pending.isEmpty()) {
+    return;
+  }
+
+  write(m_fileName, m_pending);
+  m_pending = Changes();
+}
+
+void SettingsWriter::afterWrites(std::function<void()> task) {
+  m_writePool.start(std::move(task));
+}
+
+void SettingsWriter::write(const QString &fileName, const Changes &changes) {
+  QSettings settings(fileName, QSettings::IniFormat);
+
+  for (const QString &key : changes.removals) {
+    settings.remove(key);
+  }
+  for (auto it = changes.values.cbegin(); it != changes.values.cend(); ++it) {
+    settings.setValue(it.key(), it.value());
+  }
+
+  settings.sync();
+  if (settings.status() != QSettings::NoError) {
+    qWarning() << "SettingsWriter: Failed to write" << fileName;
+  }
+}
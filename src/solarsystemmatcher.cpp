@@ -0,0 +1,169 @@
+#include "solarsystemmatcher.h"
+#include <QDebug>
+#include <QFile>
+#include <QMap>
+#include <QSet>
+#include <QTextStream>
+#include <algorithm>
+
+void SolarSystemMatcher::build(const QStringList &names) {
+  m_names.clear();
+  m_edgeStart.clear();
+  m_edgeSymbols.clear();
+  m_edgeTargets.clear();
+  m_fail.clear();
+  m_outputLink.clear();
+  m_rootNext.fill(0);
+
+  // Plain trie first; QMap keeps each state's children sorted by symbol
+  QVector<QMap<ushort, int>> children(1);
+  QVector<int> output(1, -1);
+  QSet<QString> seen;
+
+  for (const QString &rawName : names) {
+    const QString name = rawName.trimmed();
+    if (name.isEmpty() || seen.contains(name.toLower())) {
+      continue;
+    }
+    seen.insert(name.toLower());
+
+    int state = 0;
+    for (QChar c : name) {
+      const ushort symbol = fold(c.unicode());
+      const int next = children[state].value(symbol, -1);
+      if (next >= 0) {
+        state = next;
+        continue;
+      }
+
+      const int created = children.size();
+      children[state].insert(symbol, created);
+      children.append(QMap<ushort, int>());
+      output.append(-1);
+      state = created;
+    }
+
+    output[state] = m_names.size();
+    m_names.append(name);
+  }
+
+  // Compress the children maps into flat edge arrays
+  const int stateCount = children.size();
+  m_edgeStart.resize(stateCount + 1);
+  for (int state = 0; state < stateCount; ++state) {
+    m_edgeStart[state] = m_edgeSymbols.size();
+    for (auto it = children[state].cbegin(); it != children[state].cend();
+         ++it) {
+      m_edgeSymbols.append(it.key());
+      m_edgeTargets.append(it.value());
+    }
+  }
+  m_edgeStart[stateCount] = m_edgeSymbols.size();
+  m_output = output;
+
+  for (int e = m_edgeStart[0]; e < m_edgeStart[1]; ++e) {
+    if (m_edgeSymbols[e] < m_rootNext.size()) {
+      m_rootNext[m_edgeSymbols[e]] = m_edgeTargets[e];
+    }
+  }
+
+  // Failure links breadth-first, so the failure target of a state's parent
+  // is complete before the state's own link is derived from it
+  m_fail.fill(0, stateCount);
+  m_outputLink.fill(0, stateCount);
+
+  QVector<int> queue;
+  queue.reserve(stateCount);
+  for (int e = m_edgeStart[0]; e < m_edgeStart[1]; ++e) {
+    queue.append(m_edgeTargets[e]);
+  }
+
+  for (int head = 0; head < queue.size(); ++head) {
+    const int state = queue[head];
+    for (int e = m_edgeStart[state]; e < m_edgeStart[state + 1]; ++e) {
+      const int child = m_edgeTargets[e];
+      const int fail = step(m_fail[state], m_edgeSymbols[e]);
+      m_fail[child] = fail;
+      m_outputLink[child] = m_output[fail] >= 0 ? fail : m_outputLink[fail];
+      queue.append(child);
+    }
+  }
+
+  qDebug() << "SolarSystemMatcher: Compiled" << m_names.size()
+           << "system names into" << stateCount << "states";
+}
+
+QStringList SolarSystemMatcher::readNames(const QString &filePath) {
+  QStringList names;
+
+  QFile file(filePath);
+  if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+    qWarning() << "SolarSystemMatcher: Failed to read" << filePath;
+    return names;
+  }
+
+  QTextStream in(&file);
+  while (!in.atEnd()) {
+    const QString line = in.readLine().trimmed();
+    if (!line.isEmpty() && !line.startsWith('#')) {
+      names.append(line);
+    }
+  }
+
+  return names;
+}
+
+bool SolarSystemMatcher::isWordChar(QChar c) {
+  return c.isLetterOrNumber() || c == '-';
+}
+
+int SolarSystemMatcher::findEdge(int state, ushort symbol) const {
+  const auto begin = m_edgeSymbols.cbegin() + m_edgeStart[state];
+  const auto end = m_edgeSymbols.cbegin() + m_edgeStart[state + 1];
+  const auto it = std::lower_bound(begin, end, symbol);
+  if (it == end || *it != symbol) {
+    return -1;
+  }
+  return m_edgeTargets[int(it - m_edgeSymbols.cbegin())];
+}
+
+int SolarSystemMatcher::step(int state, ushort symbol) const {
+  while (state != 0) {
+    const int next = findEdge(state, symbol);
+    if (next >= 0) {
+      return next;
+    }
+    state = m_fail[state];
+  }
+
+  if (symbol < m_rootNext.size()) {
+    return m_rootNext[symbol];
+  }
+  return qMax(0, findEdge(0, symbol));
+}
+
+void SolarSystemMatcher::findAll(QStringView text,
+                                 QVector<Match> &matches) const {
+  if (m_names.isEmpty()) {
+    return;
+  }
+
+  const qsizetype length = text.size();
+  int state = 0;
+
+  for (qsizetype i = 0; i < length; ++i) {
+    state = step(state, fold(text[i].unicode()));
+
+    int found = m_output[state] >= 0 ? state : m_outputLink[state];
+    for (; found != 0; found = m_outputLink[found]) {
+      const int systemIndex = m_output[found];
+      const qsizetype nameLength = m_names[systemIndex].size();
+      const qsizetype start = i + 1 - nameLength;
+
+      if ((start == 0 || !isWordChar(text[start - 1])) &&
+          (i + 1 == length || !isWordChar(text[i + 1]))) {
+        matches.append({int(start), int(nameLength), systemIndex});
+      }
+    }
+  }
+}
@@ -0,0 +1,229 @@
+#include "starmap.h"
+#include <QDebug>
+#include <QFile>
+#include <QPair>
+#include <QTextStream>
+#include <algorithm>
+
+bool StarMap::load(const QString &filePath) {
+  m_names.clear();
+  m_indexByName.clear();
+  m_offsets.clear();
+  m_neighbours.clear();
+  m_distanceCache.clear();
+
+  QFile file(filePath);
+  if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+    qWarning() << "StarMap: Failed to read" << filePath;
+    return false;
+  }
+
+  auto indexFor = [this](const QString &name) {
+    const QString key = name.toLower();
+    auto it = m_indexByName.constFind(key);
+    if (it != m_indexByName.constEnd()) {
+      return it.value();
+    }
+    const int index = m_names.size();
+    m_names.append(name);
+    m_indexByName.insert(key, index);
+    return index;
+  };
+
+  // Gates are listed once per pair or once per direction; both work
+  QVector<QPair<int, int>> edges;
+
+  QTextStream in(&file);
+  while (!in.atEnd()) {
+    const QString line = in.readLine().trimmed();
+    if (line.isEmpty() || line.startsWith('#')) {
+      continue;
+    }
+
+    const QStringList ends = line.split(',');
+    if (ends.size() != 2 || ends[0].trimmed().isEmpty() ||
+        ends[1].trimmed().isEmpty()) {
+      qDebug() << "StarMap: Skipping malformed line" << line;
+      continue;
+    }
+
+    const int a = indexFor(ends[0].trimmed());
+    const int b = indexFor(ends[1].trimmed());
+    if (a != b) {
+      edges.append({a, b});
+      edges.append({b, a});
+    }
+  }
+
+  std::sort(edges.begin(), edges.end());
+  edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+  const int systemCount = m_names.size();
+  m_offsets.fill(0, systemCount + 1);
+  m_neighbours.reserve(edges.size());
+  for (const QPair<int, int> &edge : std::as_const(edges)) {
+    ++m_offsets[edge.first + 1];
+    m_neighbours.append(edge.second);
+  }
+  for (int i = 0; i < systemCount; ++i) {
+    m_offsets[i + 1] += m_offsets[i];
+  }
+
+  m_stamp = 0;
+  m_forwardStamp.fill(0, systemCount);
+  m_backwardStamp.fill(0, systemCount);
+  m_forwardDepth.fill(0, systemCount);
+  m_backwardDepth.fill(0, systemCount);
+
+  qDebug() << "StarMap: Loaded" << systemCount << "systems and"
+           << m_neighbours.size() / 2 << "stargates from" << filePath;
+
+  return systemCount > 0;
+}
+
+int StarMap::systemIndex(const QString &name) const {
+  return m_indexByName.value(name.trimmed().toLower(), -1);
+}
+
+int StarMap::jumpDistance(const QString &from, const QString &to) const {
+  const int a = systemIndex(from);
+  const int b = systemIndex(to);
+  if (a < 0 || b < 0) {
+    return -1;
+  }
+
+  const quint64 key = (quint64(qMin(a, b)) << 32) | quint64(qMax(a, b));
+  auto it = m_distanceCache.constFind(key);
+  if (it != m_distanceCache.constEnd()) {
+    return it.value();
+  }
+
+  if (m_distanceCache.size() >= DISTANCE_CACHE_LIMIT) {
+    m_distanceCache.clear();
+  }
+
+  const int distance = bidirectionalSearch(a, b);
+  m_distanceCache.insert(key, distance);
+  return distance;
+}
+
+QVector<int> StarMap::jumpDistancesTo(const QString &target,
+                                      const QStringList &systems,
+                                      int maxJumps) const {
+  QVector<int> distances(systems.size(), -1);
+
+  const int start = systemIndex(target);
+  if (start < 0) {
+    return distances;
+  }
+
+  // Systems still to be reached, by graph index
+  QHash<int, QVector<int>> wanted;
+  for (int i = 0; i < systems.size(); ++i) {
+    const int index = systemIndex(systems[i]);
+    if (index >= 0) {
+      wanted[index].append(i);
+    }
+  }
+
+  nextStamp();
+  m_frontier.clear();
+  m_frontier.append(start);
+  m_forwardStamp[start] = m_stamp;
+
+  for (int depth = 0; depth <= maxJumps && !m_frontier.isEmpty() &&
+                      !wanted.isEmpty();
+       ++depth) {
+    m_nextFrontier.clear();
+
+    for (int system : std::as_const(m_frontier)) {
+      auto found = wanted.find(system);
+      if (found != wanted.end()) {
+        for (int i : std::as_const(found.value())) {
+          distances[i] = depth;
+        }
+        wanted.erase(found);
+      }
+
+      for (int e = m_offsets[system]; e < m_offsets[system + 1]; ++e) {
+        const int neighbour = m_neighbours[e];
+        if (m_forwardStamp[neighbour] != m_stamp) {
+          m_forwardStamp[neighbour] = m_stamp;
+          m_nextFrontier.append(neighbour);
+        }
+      }
+    }
+
+    m_frontier.swap(m_nextFrontier);
+  }
+
+  return distances;
+}
+
+int StarMap::bidirectionalSearch(int from, int to) const {
+  if (from == to) {
+    return 0;
+  }
+
+  nextStamp();
+
+  m_frontier.clear();
+  m_frontier.append(from);
+  m_forwardStamp[from] = m_stamp;
+  m_forwardDepth[from] = 0;
+
+  m_otherFrontier.clear();
+  m_otherFrontier.append(to);
+  m_backwardStamp[to] = m_stamp;
+  m_backwardDepth[to] = 0;
+
+  while (!m_frontier.isEmpty() && !m_otherFrontier.isEmpty()) {
+    // Grow the smaller side by one whole level
+    const bool forward = m_frontier.size() <= m_otherFrontier.size();
+    QVector<int> &frontier = forward ? m_frontier : m_otherFrontier;
+    QVector<quint32> &ownStamp = forward ? m_forwardStamp : m_backwardStamp;
+    QVector<int> &ownDepth = forward ? m_forwardDepth : m_backwardDepth;
+    const QVector<quint32> &otherStamp =
+        forward ? m_backwardStamp : m_forwardStamp;
+    const QVector<int> &otherDepth = forward ? m_backwardDepth : m_forwardDepth;
+
+    int best = -1;
+    m_nextFrontier.clear();
+
+    for (int system : std::as_const(frontier)) {
+      for (int e = m_offsets[system]; e < m_offsets[system + 1]; ++e) {
+        const int neighbour = m_neighbours[e];
+
+        if (otherStamp[neighbour] == m_stamp) {
+          const int distance = ownDepth[system] + 1 + otherDepth[neighbour];
+          if (best < 0 || distance < best) {
+            best = distance;
+          }
+        }
+
+        if (ownStamp[neighbour] != m_stamp) {
+          ownStamp[neighbour] = m_stamp;
+          ownDepth[neighbour] = ownDepth[system] + 1;
+          m_nextFrontier.append(neighbour);
+        }
+      }
+    }
+
+    // The whole level is checked, so the shortest meeting point is known
+    if (best >= 0) {
+      return best;
+    }
+
+    frontier.swap(m_nextFrontier);
+  }
+
+  return -1;
+}
+
+void StarMap::nextStamp() const {
+  if (++m_stamp == 0) {
+    m_forwardStamp.fill(0);
+    m_backwardStamp.fill(0);
+    m_stamp = 1;
+  }
+}
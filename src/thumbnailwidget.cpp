@@ -60,6 +60,10 @@ void ThumbnailWidget::setCharacterName(const QString &characterName) {
     QString displayName =
         m_customName.isEmpty() ? m_characterName : m_customName;
     m_overlayWidget->setCharacterName(displayName);
+    m_overlayWidget->setCharacterId(
+        m_characterName.isEmpty()
+            ? -1
+            : Config::instance().characterId(m_characterName));
   }
 }
 
@@ -116,8 +120,18 @@ void ThumbnailWidget::refreshSystemColor() {
   }
 }
 
+void ThumbnailWidget::setDamageText(const QString &text) {
+  if (m_damageText == text) {
+    return;
+  }
+
+  m_damageText = text;
+  updateOverlays();
+}
+
 void ThumbnailWidget::setCombatMessage(const QString &message,
-                                       const QString &eventType) {
+                                       const QString &eventType,
+                                       QTimer *sharedTimer) {
   if (message.isEmpty()) {
     return;
   }
@@ -129,19 +143,25 @@ void ThumbnailWidget::setCombatMessage(const QString &message,
     }
   }
 
-  // Create a new timer for this event
-  QTimer *timer = new QTimer(this);
-  timer->setSingleShot(true);
+  // Create a new timer for this event unless it shares one
+  QTimer *timer = sharedTimer;
+  if (!timer) {
+    timer = new QTimer(this);
+    timer->setSingleShot(true);
+  }
 
   // Add the event to the list
-  m_combatEvents.append(CombatEvent(message, eventType, timer));
+  m_combatEvents.append(
+      CombatEvent(message, eventType, timer, sharedTimer == nullptr));
 
   // Connect the timer to remove this specific event when it expires
   connect(timer, &QTimer::timeout, this, [this, timer]() {
     // Find and remove the event associated with this timer
     for (int i = 0; i < m_combatEvents.size(); ++i) {
       if (m_combatEvents[i].timer == timer) {
-        m_combatEvents[i].timer->deleteLater();
+        if (m_combatEvents[i].ownsTimer) {
+          m_combatEvents[i].timer->deleteLater();
+        }
         m_combatEvents.removeAt(i);
         break;
       }
@@ -156,9 +176,11 @@ void ThumbnailWidget::setCombatMessage(const QString &message,
   });
 
   // Start the timer with the event's configured duration
-  const Config &cfg = Config::instance();
-  int duration = cfg.combatEventDuration(eventType);
-  timer->start(duration);
+  if (!sharedTimer) {
+    const Config &cfg = Config::instance();
+    int duration = cfg.combatEventDuration(eventType);
+    timer->start(duration);
+  }
 
   updateOverlays();
 
@@ -188,9 +210,11 @@ void ThumbnailWidget::closeImmediately() {
 
   // Stop and clean up all combat event timers
   for (auto &event : m_combatEvents) {
-    if (event.timer) {
+    if (event.timer && event.ownsTimer) {
       event.timer->stop();
       event.timer->deleteLater();
+    } else if (event.timer) {
+      disconnect(event.timer, nullptr, this, nullptr);
     }
   }
   m_combatEvents.clear();
@@ -238,6 +262,13 @@ void ThumbnailWidget::updateOverlays() {
         static_cast<OverlayPosition>(cfg.combatMessagePosition());
     QFont combatFont = cfg.combatMessageFont();
 
+    if (!m_damageText.isEmpty() && cfg.combatDamageTracking()) {
+      OverlayElement damageElement(
+          m_damageText, cfg.combatEventColor("damage"), pos, true, combatFont,
+          cfg.combatMessageOffsetX(), cfg.combatMessageOffsetY());
+      m_overlays.append(damageElement);
+    }
+
     for (const auto &event : m_combatEvents) {
       QColor messageColor = cfg.combatEventColor(event.eventType);
       OverlayElement combatElement(event.message, messageColor, pos, true,
@@ -950,7 +981,7 @@ void OverlayWidget::setActiveState(bool active) {
     bool needsInactiveAnimation = false;
     if (showGlobalInactiveBorder) {
       QColor inactiveCharacterColor =
-          cfg.getCharacterInactiveBorderColor(m_characterName);
+          cfg.characterRecord(m_characterId).inactiveBorderColor;
       bool hasCustomInactiveColor = inactiveCharacterColor.isValid();
       BorderStyle inactiveStyle = cfg.inactiveBorderStyle();
       needsInactiveAnimation = (inactiveStyle == BorderStyle::Dashed ||
@@ -980,6 +1011,14 @@ void OverlayWidget::setCharacterName(const QString &characterName) {
   update();
 }
 
+void OverlayWidget::setCharacterId(int characterId) {
+  if (m_characterId == characterId) {
+    return;
+  }
+  m_characterId = characterId;
+  update();
+}
+
 void OverlayWidget::setSystemName(const QString &systemName) {
   if (m_systemName == systemName) {
     return;
@@ -1074,7 +1113,7 @@ void OverlayWidget::resumeAnimations() {
 
       if (showGlobalInactiveBorder) {
         QColor inactiveCharacterColor =
-            cfg.getCharacterInactiveBorderColor(m_characterName);
+            cfg.characterRecord(m_characterId).inactiveBorderColor;
         bool hasCustomInactiveColor = inactiveCharacterColor.isValid();
         BorderStyle inactiveStyle = cfg.inactiveBorderStyle();
         needsAnimation = (inactiveStyle == BorderStyle::Dashed ||
@@ -1099,15 +1138,18 @@ void OverlayWidget::paintEvent(QPaintEvent *) {
 
   drawOverlays(painter);
 
-  const Config &cfg = Config::instance();
+  // One snapshot for the whole frame, so a setting changed meanwhile
+  // cannot mix old and new values between the borders
+  const std::shared_ptr<const ConfigSnapshot> cfg =
+      Config::instance().snapshot();
+  const ConfigSnapshot::CharacterColors characterColors =
+      cfg->colorsOf(m_characterId);
 
-  bool highlightEnabled = cfg.highlightActiveWindow();
-  bool configDialogOpen = cfg.isConfigDialogOpen();
   bool shouldDrawActiveBorder =
-      (highlightEnabled && m_isActive) || configDialogOpen;
+      (cfg->highlightActive && m_isActive) || cfg->configDialogOpen;
 
-  qreal halfWidth = cfg.highlightBorderWidth() / 2.0;
-  int borderWidth = cfg.highlightBorderWidth();
+  qreal halfWidth = cfg->highlightBorderWidth / 2.0;
+  int borderWidth = cfg->highlightBorderWidth;
   qreal currentOffset = 0.0;
 
   // Draw active border on the outside (when active)
@@ -1116,25 +1158,20 @@ void OverlayWidget::paintEvent(QPaintEvent *) {
                       width() - 2 * (halfWidth + currentOffset),
                       height() - 2 * (halfWidth + currentOffset));
 
-    QColor borderColor = cfg.getCharacterBorderColor(m_characterName);
+    QColor borderColor = characterColors.border;
     if (!borderColor.isValid()) {
-      borderColor = cfg.highlightColor();
+      borderColor = cfg->highlightColor;
     }
 
-    BorderStyle style = cfg.activeBorderStyle();
-    drawBorderWithStyle(painter, borderRect, borderColor, borderWidth, style);
+    drawBorderWithStyle(painter, borderRect, borderColor, borderWidth,
+                        cfg->activeBorderStyle);
 
     // Move offset inward for next border
     currentOffset += borderWidth;
   } else if (!m_isActive) {
     // Draw inactive border (only when global setting is enabled)
-    bool showGlobalInactiveBorder = cfg.showInactiveBorders();
-
-    if (showGlobalInactiveBorder) {
-      QColor inactiveCharacterColor =
-          cfg.getCharacterInactiveBorderColor(m_characterName);
-      bool hasCustomInactiveColor = inactiveCharacterColor.isValid();
-      int inactiveBorderWidth = cfg.inactiveBorderWidth();
+    if (cfg->showInactiveBorders) {
+      int inactiveBorderWidth = cfg->inactiveBorderWidth;
       qreal inactiveHalfWidth = inactiveBorderWidth / 2.0;
 
       QRectF borderRect(inactiveHalfWidth + currentOffset,
@@ -1142,12 +1179,12 @@ void OverlayWidget::paintEvent(QPaintEvent *) {
                         width() - 2 * (inactiveHalfWidth + currentOffset),
                         height() - 2 * (inactiveHalfWidth + currentOffset));
 
-      QColor borderColor = hasCustomInactiveColor ? inactiveCharacterColor
-                                                  : cfg.inactiveBorderColor();
+      QColor borderColor = characterColors.inactiveBorder.isValid()
+                               ? characterColors.inactiveBorder
+                               : cfg->inactiveBorderColor;
 
-      BorderStyle style = cfg.inactiveBorderStyle();
       drawBorderWithStyle(painter, borderRect, borderColor, inactiveBorderWidth,
-                          style);
+                          cfg->inactiveBorderStyle);
 
       // Move offset inward for next border
       currentOffset += inactiveBorderWidth;
@@ -1158,15 +1195,14 @@ void OverlayWidget::paintEvent(QPaintEvent *) {
 
   // Draw all combat event borders nested inside
   for (const QString &eventType : m_combatEventTypes) {
-    if (cfg.combatEventBorderHighlight(eventType)) {
+    auto border = cfg->combatBorders.constFind(eventType);
+    if (border != cfg->combatBorders.constEnd()) {
       QRectF borderRect(halfWidth + currentOffset, halfWidth + currentOffset,
                         width() - 2 * (halfWidth + currentOffset),
                         height() - 2 * (halfWidth + currentOffset));
 
-      QColor borderColor = cfg.combatEventColor(eventType);
-      BorderStyle style = cfg.combatBorderStyle(eventType);
-
-      drawBorderWithStyle(painter, borderRect, borderColor, borderWidth, style);
+      drawBorderWithStyle(painter, borderRect, border->color, borderWidth,
+                          border->style);
 
       // Move offset inward for next border
       currentOffset += borderWidth;
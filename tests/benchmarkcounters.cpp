@@ -0,0 +1,217 @@
+// The wrappers below must not collide with the inline fortify wrappers or
+// the 64-bit redirects of the libc headers
+#undef _FORTIFY_SOURCE
+#undef _FILE_OFFSET_BITS
+
+#include "benchmarkcounters.h"
+#include <atomic>
+
+#ifdef Q_OS_LINUX
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <dlfcn.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef Q_OS_WIN
+#include <windows.h>
+#include <psapi.h>
+#endif
+
+namespace {
+
+std::atomic<qint64> allocationCount{0};
+std::atomic<qint64> fileSystemCallCount{0};
+
+} // namespace
+
+#ifdef __GLIBC__
+
+extern "C" {
+
+void *__libc_malloc(size_t size);
+void *__libc_calloc(size_t count, size_t size);
+void *__libc_realloc(void *pointer, size_t size);
+void __libc_free(void *pointer);
+
+void *malloc(size_t size) {
+  allocationCount.fetch_add(1, std::memory_order_relaxed);
+  return __libc_malloc(size);
+}
+
+void *calloc(size_t count, size_t size) {
+  allocationCount.fetch_add(1, std::memory_order_relaxed);
+  return __libc_calloc(count, size);
+}
+
+void *realloc(void *pointer, size_t size) {
+  allocationCount.fetch_add(1, std::memory_order_relaxed);
+  return __libc_realloc(pointer, size);
+}
+
+void free(void *pointer) { __libc_free(pointer); }
+
+} // extern "C"
+
+namespace {
+
+/// The libc function shadowed by the wrapper of the same name
+template <typename Function> Function next(const char *name) {
+  return reinterpret_cast<Function>(dlsym(RTLD_NEXT, name));
+}
+
+void countFileSystemCall() {
+  fileSystemCallCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+} // namespace
+
+// Each wrapper counts the call and forwards it to libc
+#define COUNTED_CALL(ret, name, params, args)                                  \
+  extern "C" ret name params {                                                 \
+    using Function = ret(*) params;                                            \
+    static const Function real = next<Function>(#name);                        \
+    countFileSystemCall();                                                     \
+    return real args;                                                          \
+  }
+
+// open() and openat() take a mode only when a file may be created
+#define COUNTED_OPEN(name, params, args)                                       \
+  extern "C" int name params {                                                 \
+    using Function = int (*)params;                                            \
+    static const Function real = next<Function>(#name);                        \
+    mode_t mode = 0;                                                           \
+    if (flags & (O_CREAT | O_TMPFILE)) {                                       \
+      va_list list;                                                            \
+      va_start(list, flags);                                                   \
+      mode = mode_t(va_arg(list, int));                                        \
+      va_end(list);                                                            \
+    }                                                                          \
+    countFileSystemCall();                                                     \
+    return real args;                                                          \
+  }
+
+COUNTED_OPEN(open, (const char *path, int flags, ...), (path, flags, mode))
+COUNTED_OPEN(open64, (const char *path, int flags, ...), (path, flags, mode))
+COUNTED_OPEN(openat, (int dirfd, const char *path, int flags, ...),
+             (dirfd, path, flags, mode))
+COUNTED_OPEN(openat64, (int dirfd, const char *path, int flags, ...),
+             (dirfd, path, flags, mode))
+COUNTED_CALL(int, close, (int fd), (fd))
+COUNTED_CALL(ssize_t, read, (int fd, void *buffer, size_t size),
+             (fd, buffer, size))
+COUNTED_CALL(ssize_t, pread, (int fd, void *buffer, size_t size, off_t offset),
+             (fd, buffer, size, offset))
+COUNTED_CALL(ssize_t, pread64,
+             (int fd, void *buffer, size_t size, off64_t offset),
+             (fd, buffer, size, offset))
+COUNTED_CALL(off_t, lseek, (int fd, off_t offset, int whence),
+             (fd, offset, whence))
+COUNTED_CALL(off64_t, lseek64, (int fd, off64_t offset, int whence),
+             (fd, offset, whence))
+COUNTED_CALL(int, fstat, (int fd, struct stat *buffer), (fd, buffer))
+COUNTED_CALL(int, fstat64, (int fd, struct stat64 *buffer), (fd, buffer))
+COUNTED_CALL(int, stat, (const char *path, struct stat *buffer),
+             (path, buffer))
+COUNTED_CALL(int, stat64, (const char *path, struct stat64 *buffer),
+             (path, buffer))
+COUNTED_CALL(int, lstat, (const char *path, struct stat *buffer),
+             (path, buffer))
+COUNTED_CALL(int, lstat64, (const char *path, struct stat64 *buffer),
+             (path, buffer))
+COUNTED_CALL(int, fstatat,
+             (int dirfd, const char *path, struct stat *buffer, int flags),
+             (dirfd, path, buffer, flags))
+COUNTED_CALL(int, fstatat64,
+             (int dirfd, const char *path, struct stat64 *buffer, int flags),
+             (dirfd, path, buffer, flags))
+COUNTED_CALL(int, statx,
+             (int dirfd, const char *path, int flags, unsigned int mask,
+              struct statx *buffer),
+             (dirfd, path, flags, mask, buffer))
+COUNTED_CALL(void *, mmap,
+             (void *address, size_t length, int protection, int flags, int fd,
+              off_t offset),
+             (address, length, protection, flags, fd, offset))
+COUNTED_CALL(void *, mmap64,
+             (void *address, size_t length, int protection, int flags, int fd,
+              off64_t offset),
+             (address, length, protection, flags, fd, offset))
+COUNTED_CALL(int, munmap, (void *address, size_t length), (address, length))
+
+#endif // __GLIBC__
+
+namespace BenchmarkCounters {
+
+qint64 allocations() {
+#ifdef __GLIBC__
+  return allocationCount.load(std::memory_order_relaxed);
+#else
+  return -1;
+#endif
+}
+
+qint64 fileSystemCalls() {
+#if defined(__GLIBC__)
+  return fileSystemCallCount.load(std::memory_order_relaxed);
+#elif defined(Q_OS_WIN)
+  IO_COUNTERS counters;
+  if (!GetProcessIoCounters(GetCurrentProcess(), &counters)) {
+    return -1;
+  }
+  return qint64(counters.ReadOperationCount + counters.WriteOperationCount +
+                counters.OtherOperationCount);
+#else
+  return -1;
+#endif
+}
+
+qint64 peakResidentBytes() {
+#if defined(Q_OS_LINUX)
+  FILE *status = std::fopen("/proc/self/status", "r");
+  if (!status) {
+    return -1;
+  }
+  qint64 peakKilobytes = -1;
+  char line[256];
+  while (std::fgets(line, sizeof(line), status)) {
+    long long kilobytes = 0;
+    if (std::strncmp(line, "VmHWM:", 6) == 0 &&
+        std::sscanf(line + 6, "%lld", &kilobytes) == 1) {
+      peakKilobytes = kilobytes;
+      break;
+    }
+  }
+  std::fclose(status);
+  return peakKilobytes < 0 ? -1 : peakKilobytes * 1024;
+#elif defined(Q_OS_WIN)
+  PROCESS_MEMORY_COUNTERS counters;
+  if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters,
+                            sizeof(counters))) {
+    return -1;
+  }
+  return qint64(counters.PeakWorkingSetSize);
+#else
+  return -1;
+#endif
+}
+
+bool resetPeakResident() {
+#ifdef Q_OS_LINUX
+  // Writing 5 to clear_refs resets the VmHWM of the process
+  FILE *clearRefs = std::fopen("/proc/self/clear_refs", "w");
+  if (!clearRefs) {
+    return false;
+  }
+  const bool written = std::fputs("5", clearRefs) >= 0;
+  return std::fclose(clearRefs) == 0 && written;
+#else
+  return false;
+#endif
+}
+
+} // namespace BenchmarkCounters
@@ -0,0 +1,32 @@
+#ifndef BENCHMARKCOUNTERS_H
+#define BENCHMARKCOUNTERS_H
+
+#include <QtGlobal>
+
+/// Process-wide counters for benchmarks that report more than time.
+/// benchmarkcounters.cpp must be linked into the test executable: on glibc
+/// it replaces malloc and the libc file system calls to count them.
+namespace BenchmarkCounters {
+
+/// Heap allocations (malloc, calloc, realloc, and operator new through
+/// them) so far, or -1 where they are not counted
+qint64 allocations();
+
+/// File system calls (open, read, stat, seek, map and close) made by Qt and
+/// the other libraries so far; libc's own stdio is not seen. On Windows the
+/// read, write and other I/O operations counted by the system, or -1 where
+/// neither is available.
+qint64 fileSystemCalls();
+
+/// Peak resident set (peak working set on Windows) of the process in
+/// bytes, or -1 where it is not available
+qint64 peakResidentBytes();
+
+/// Restarts the peak of peakResidentBytes() at the current resident set.
+/// Returns false where the peak cannot be reset, which is everywhere but
+/// Linux; run benchmark rows in their own process there.
+bool resetPeakResident();
+
+} // namespace BenchmarkCounters
+
+#endif
@@ -0,0 +1,587 @@
+#include "benchmarkcounters.h"
+#include "chatlogreader.h"
+#include <QDateTime>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QStringDecoder>
+#include <QStringEncoder>
+#include <QTemporaryDir>
+#include <QTest>
+#include <algorithm>
+
+namespace {
+
+constexpr int CHARACTER_COUNT = 100;
+constexpr int JUMP_ROUNDS = 5;
+constexpr int LATENCY_SAMPLES = 30;
+constexpr int DELIVERY_TIMEOUT_MS = 10000;
+constexpr int POLLED_LOG_COUNT = 40;
+constexpr int POLL_COUNT = 200;
+constexpr int FLEET_SIZE = 50;
+constexpr int LARGE_LOG_COUNT = 200;
+constexpr qsizetype LARGE_LOG_BYTES = 2 * 1024 * 1024;
+constexpr qsizetype SYSTEM_CHANGE_DISTANCE = 256 * 1024; // Bytes before EOF
+constexpr int STARTUP_TIMEOUT_MS = 120000;
+
+QString pilotName(int i) { return QString("Pilot %1").arg(i); }
+
+QString gameLogPath(const QDir &dir, int i) {
+  return dir.filePath(QString("20240115_123456_%1.txt").arg(90000000 + i));
+}
+
+bool writeGameLog(const QString &path, const QString &listener) {
+  QFile file(path);
+  if (!file.open(QIODevice::WriteOnly)) {
+    return false;
+  }
+  file.write("------------------------------------------------------------\n"
+             "  Gamelog\n");
+  file.write(QString("  Listener: %1\n").arg(listener).toUtf8());
+  file.write("  Session Started: 2024.01.15 12:34:56\n"
+             "------------------------------------------------------------\n"
+             "[ 2024.01.15 12:35:00 ] (None) Jumping from Jita to Perimeter\n");
+  return true;
+}
+
+bool appendJump(const QString &path, int round) {
+  QFile file(path);
+  if (!file.open(QIODevice::Append)) {
+    return false;
+  }
+  const QString timestamp = QDateTime::currentDateTimeUtc().toString(
+      "yyyy.MM.dd HH:mm:ss");
+  file.write(QString("[ %1 ] (None) Jumping from Round%2 to Round%3\n")
+                 .arg(timestamp)
+                 .arg(round)
+                 .arg(round + 1)
+                 .toUtf8());
+  return true;
+}
+
+QString largeLogPilotName(int i) { return QString("Local Pilot %1").arg(i); }
+
+QString chatLogPath(const QDir &dir, int i) {
+  return dir.filePath(
+      QString("Local_20240115_123456_%1.txt").arg(90000000 + i));
+}
+
+QByteArray utf16(const QString &text) {
+  QStringEncoder encoder(QStringEncoder::Utf16LE);
+  return encoder.encode(text);
+}
+
+/// Local chatter of at least the given size in bytes, as UTF-16LE
+QByteArray chatter(qsizetype bytes, int seed) {
+  QString text;
+  for (int i = seed; text.size() * 2 < bytes; ++i) {
+    text += QString("[ 2024.01.15 12:%1:%2 ] Pilot %3 > anyone selling %4 "
+                    "units of Tritanium in Jita?\r\n")
+                .arg((i / 60) % 60, 2, 10, QChar('0'))
+                .arg(i % 60, 2, 10, QChar('0'))
+                .arg(i % 300)
+                .arg(i);
+  }
+  return utf16(text);
+}
+
+/// A Local chatlog of a long session: the last system change lies
+/// SYSTEM_CHANGE_DISTANCE bytes before the end, far beyond a single tail
+/// read. The listener is on line 9, where discovery looks for it.
+bool writeLargeChatLog(const QString &path, const QString &listener,
+                       const QByteArray &body) {
+  QFile file(path);
+  if (!file.open(QIODevice::WriteOnly)) {
+    return false;
+  }
+  file.write("\xFF\xFE");
+  file.write(utf16(QString("\r\n\r\n\r\n"
+                           "        ----------------------------------------"
+                           "-----------------------\r\n"
+                           "\r\n"
+                           "          Channel ID:      local\r\n"
+                           "          Channel Name:    Local\r\n"
+                           "\r\n"
+                           "          Listener:        %1\r\n"
+                           "          Session started: 2024.01.15 12:00:00\r\n"
+                           "        ----------------------------------------"
+                           "-----------------------\r\n")
+                       .arg(listener)));
+  return file.write(body) == body.size();
+}
+
+qint64 percentile(QVector<qint64> samples, int percent) {
+  if (samples.isEmpty()) {
+    return -1;
+  }
+  std::sort(samples.begin(), samples.end());
+  const qsizetype index = (samples.size() - 1) * percent / 100;
+  return samples[index];
+}
+
+} // namespace
+
+class TestChatLogReader : public QObject {
+  Q_OBJECT
+
+private slots:
+  void initTestCase();
+  void eventLatency_data();
+  void eventLatency();
+  void shardedDeliveryLatency_data();
+  void shardedDeliveryLatency();
+  void pollCost_data();
+  void pollCost();
+  void massJumpWakeups_data();
+  void massJumpWakeups();
+  void startupTime_data();
+  void startupTime();
+  void catchUpMemory_data();
+  void catchUpMemory();
+
+private:
+  bool createLargeChatLogs();
+
+  QTemporaryDir m_dir;
+  QStringList m_characters;
+  QStringList m_largeLogCharacters; // Of the Local logs in m_dir/chatlogs
+};
+
+void TestChatLogReader::initTestCase() {
+  QVERIFY(m_dir.isValid());
+  QVERIFY(QDir(m_dir.path()).mkpath("gamelogs"));
+
+  for (int i = 0; i < CHARACTER_COUNT; ++i) {
+    m_characters.append(pilotName(i));
+  }
+}
+
+/// Writes the 200 Local chatlogs of 2 MB each for the startup benchmarks on
+/// first use, so that the other tests do not pay for them
+bool TestChatLogReader::createLargeChatLogs() {
+  if (!m_largeLogCharacters.isEmpty()) {
+    return true;
+  }
+
+  if (!QDir(m_dir.path()).mkpath("chatlogs")) {
+    return false;
+  }
+  const QDir chatLogDir(m_dir.filePath("chatlogs"));
+
+  const QByteArray tail = chatter(SYSTEM_CHANGE_DISTANCE, 0);
+  const QByteArray body =
+      chatter(LARGE_LOG_BYTES - SYSTEM_CHANGE_DISTANCE, 1000) +
+      utf16("[ 2024.01.15 12:00:01 ] EVE System > Channel changed to Local "
+            ": Jita\r\n") +
+      tail;
+
+  QStringList characters;
+  for (int i = 0; i < LARGE_LOG_COUNT; ++i) {
+    if (!writeLargeChatLog(chatLogPath(chatLogDir, i), largeLogPilotName(i),
+                           body)) {
+      return false;
+    }
+    characters.append(largeLogPilotName(i));
+  }
+
+  m_largeLogCharacters = characters;
+  return true;
+}
+
+void TestChatLogReader::eventLatency_data() {
+  QTest::addColumn<bool>("eventDriven");
+  QTest::newRow("polling") << false;
+  QTest::newRow("event-driven") << true;
+}
+
+void TestChatLogReader::eventLatency() {
+  // Time from appending a jump to a single live gamelog until
+  // systemChanged is emitted; appends are spread over the poll cycle
+  QFETCH(bool, eventDriven);
+
+  QTemporaryDir gameLogDir;
+  QVERIFY(gameLogDir.isValid());
+  const QString logPath = gameLogPath(QDir(gameLogDir.path()), 0);
+  QVERIFY(writeGameLog(logPath, pilotName(0)));
+
+  ChatLogReader reader;
+  reader.setGameLogDirectory(gameLogDir.path());
+  reader.setEnableChatLogMonitoring(false);
+  reader.setEventDrivenMonitoring(eventDriven);
+  reader.setBatchedDelivery(false);
+  reader.setCharacterNames({pilotName(0)});
+
+  QElapsedTimer clock;
+  clock.start();
+  qint64 writtenAt = -1;
+  QVector<qint64> latencies;
+  connect(&reader, &ChatLogReader::systemChanged, this,
+          [&](const QString &, const QString &systemName, qint64) {
+            if (writtenAt >= 0 && systemName.startsWith("Round")) {
+              latencies.append((clock.nsecsElapsed() - writtenAt) / 1000);
+              writtenAt = -1;
+            }
+          });
+
+  reader.start();
+  QTRY_COMPARE_WITH_TIMEOUT(reader.getSystemForCharacter(pilotName(0)),
+                            QString("Perimeter"), DELIVERY_TIMEOUT_MS);
+
+  for (int round = 0; round < LATENCY_SAMPLES; ++round) {
+    QTest::qWait(50 + (round * 37) % 250);
+    writtenAt = clock.nsecsElapsed();
+    QVERIFY(appendJump(logPath, round));
+    QTRY_VERIFY_WITH_TIMEOUT(writtenAt < 0, DELIVERY_TIMEOUT_MS);
+  }
+
+  reader.stop();
+
+  QCOMPARE(latencies.size(), LATENCY_SAMPLES);
+  qInfo().noquote() << QString("%1: p50 %2 us, p99 %3 us")
+                           .arg(eventDriven ? "event-driven" : "polling")
+                           .arg(percentile(latencies, 50))
+                           .arg(percentile(latencies, 99));
+}
+
+void TestChatLogReader::shardedDeliveryLatency_data() {
+  QTest::addColumn<int>("shards");
+  QTest::newRow("1 shard") << 1;
+  QTest::newRow("2 shards") << 2;
+  QTest::newRow("4 shards") << 4;
+}
+
+void TestChatLogReader::shardedDeliveryLatency() {
+  // Time from appending a jump to a character's gamelog until the system
+  // change reaches the reader's thread, with every character's log live
+  QFETCH(int, shards);
+
+  // Every row starts from logs that end in Perimeter, whatever earlier
+  // rows appended
+  const QDir gameLogDir(m_dir.filePath("gamelogs"));
+  for (int i = 0; i < CHARACTER_COUNT; ++i) {
+    QVERIFY(writeGameLog(gameLogPath(gameLogDir, i), pilotName(i)));
+  }
+
+  QTemporaryDir dataDir;
+  QVERIFY(dataDir.isValid());
+
+  ChatLogReader reader;
+  reader.setDataDirectory(dataDir.path());
+  reader.setGameLogDirectory(gameLogDir.path());
+  reader.setEnableChatLogMonitoring(false);
+  reader.setWorkerCount(shards);
+  reader.setCharacterNames(m_characters);
+
+  QElapsedTimer clock;
+  clock.start();
+  QHash<QString, qint64> writtenAt; // Character -> ns on clock
+  QVector<qint64> latencies;        // Microseconds
+  connect(&reader, &ChatLogReader::eventsBatched, this,
+          [&](const LogEventBatch &events) {
+            for (const LogEvent &event : events) {
+              if (event.live && event.type == LogEvent::SystemChange &&
+                  writtenAt.contains(event.characterName)) {
+                latencies.append(
+                    (clock.nsecsElapsed() -
+                     writtenAt.take(event.characterName)) /
+                    1000);
+              }
+            }
+          });
+
+  reader.start();
+
+  // Initial states of all logs, read when they are attached
+  QTRY_VERIFY_WITH_TIMEOUT(
+      std::all_of(m_characters.cbegin(), m_characters.cend(),
+                  [&](const QString &character) {
+                    return reader.getSystemForCharacter(character) ==
+                           "Perimeter";
+                  }),
+      DELIVERY_TIMEOUT_MS);
+
+  for (int round = 0; round < JUMP_ROUNDS; ++round) {
+    for (int i = 0; i < CHARACTER_COUNT; ++i) {
+      writtenAt.insert(pilotName(i), clock.nsecsElapsed());
+      QVERIFY(appendJump(gameLogPath(gameLogDir, i), round));
+    }
+    QTRY_VERIFY_WITH_TIMEOUT(writtenAt.isEmpty(), DELIVERY_TIMEOUT_MS);
+  }
+
+  reader.stop();
+
+  QCOMPARE(latencies.size(), CHARACTER_COUNT * JUMP_ROUNDS);
+  qInfo().noquote() << QString("%1 shard(s): p50 %2 us, p99 %3 us")
+                           .arg(shards)
+                           .arg(percentile(latencies, 50))
+                           .arg(percentile(latencies, 99));
+}
+
+void TestChatLogReader::pollCost_data() {
+  QTest::addColumn<bool>("appending");
+  QTest::newRow("idle") << false;
+  QTest::newRow("active") << true;
+}
+
+void TestChatLogReader::pollCost() {
+  // Heap allocations and file system calls of one poll tick over 40
+  // monitored gamelogs, idle or with a jump appended to every log before
+  // each tick. Only the poll itself is counted, not the appends.
+  QFETCH(bool, appending);
+
+  QTemporaryDir gameLogDir;
+  QVERIFY(gameLogDir.isValid());
+
+  QStringList characters;
+  LogFileAssignment files;
+  for (int i = 0; i < POLLED_LOG_COUNT; ++i) {
+    const QString path = gameLogPath(QDir(gameLogDir.path()), i);
+    QVERIFY(writeGameLog(path, pilotName(i)));
+    characters.append(pilotName(i));
+    files.gameLogs.insert(pilotName(i).toLower(), path);
+  }
+
+  // Polls are driven by hand: the worker's timer never fires while the
+  // test does not return to the event loop
+  LogPipelineStats stats;
+  ChatLogWorker worker(stats);
+  worker.setEnableChatLogMonitoring(false);
+  worker.setEventDrivenMonitoring(false);
+  worker.setBatchedDelivery(true);
+  worker.setCharacterNames(characters);
+  worker.assignLogFiles(files);
+  worker.startMonitoring();
+
+  qint64 allocations = 0;
+  qint64 fileSystemCalls = 0;
+  for (int poll = 0; poll < POLL_COUNT; ++poll) {
+    if (appending) {
+      for (const QString &path : std::as_const(files.gameLogs)) {
+        QVERIFY(appendJump(path, poll));
+      }
+    }
+
+    const qint64 allocationsBefore = BenchmarkCounters::allocations();
+    const qint64 callsBefore = BenchmarkCounters::fileSystemCalls();
+    worker.pollLogFiles();
+    allocations += BenchmarkCounters::allocations() - allocationsBefore;
+    fileSystemCalls += BenchmarkCounters::fileSystemCalls() - callsBefore;
+  }
+
+  worker.stopMonitoring();
+
+  QCOMPARE(stats.polls.load(), quint64(POLL_COUNT));
+
+  // Counters missing on this platform report -1
+  const auto perPoll = [](qint64 total, qint64 available) {
+    return available < 0 ? QString("n/a")
+                         : QString::number(double(total) / POLL_COUNT, 'f', 1);
+  };
+  qInfo().noquote()
+      << QString("%1: %2 allocations, %3 file system calls per poll")
+             .arg(appending ? "active" : "idle")
+             .arg(perPoll(allocations, BenchmarkCounters::allocations()))
+             .arg(perPoll(fileSystemCalls,
+                          BenchmarkCounters::fileSystemCalls()));
+}
+
+void TestChatLogReader::massJumpWakeups_data() {
+  QTest::addColumn<bool>("batched");
+  QTest::newRow("per event") << false;
+  QTest::newRow("batched") << true;
+}
+
+void TestChatLogReader::massJumpWakeups() {
+  // GUI thread wakeups while a fleet of 50 jumps together, once with every
+  // event delivered on its own and once in a batch per poll
+  QFETCH(bool, batched);
+
+  QTemporaryDir gameLogDir;
+  QVERIFY(gameLogDir.isValid());
+  QTemporaryDir dataDir;
+  QVERIFY(dataDir.isValid());
+
+  QStringList fleet;
+  for (int i = 0; i < FLEET_SIZE; ++i) {
+    fleet.append(pilotName(i));
+    QVERIFY(writeGameLog(gameLogPath(QDir(gameLogDir.path()), i),
+                         pilotName(i)));
+  }
+
+  ChatLogReader reader;
+  reader.setDataDirectory(dataDir.path());
+  reader.setGameLogDirectory(gameLogDir.path());
+  reader.setEnableChatLogMonitoring(false);
+  reader.setBatchedDelivery(batched);
+  reader.setCharacterNames(fleet);
+
+  // Every handler run on the reader's thread is one wakeup
+  int wakeups = 0;
+  connect(&reader, &ChatLogReader::systemChanged, this,
+          [&](const QString &, const QString &, qint64) { ++wakeups; });
+  connect(&reader, &ChatLogReader::eventsBatched, this,
+          [&](const LogEventBatch &) { ++wakeups; });
+
+  const auto allIn = [&](const QString &system) {
+    return std::all_of(fleet.cbegin(), fleet.cend(),
+                       [&](const QString &character) {
+                         return reader.getSystemForCharacter(character) ==
+                                system;
+                       });
+  };
+
+  reader.start();
+  QTRY_VERIFY_WITH_TIMEOUT(allIn("Perimeter"), DELIVERY_TIMEOUT_MS);
+  wakeups = 0;
+
+  for (int round = 0; round < JUMP_ROUNDS; ++round) {
+    for (int i = 0; i < FLEET_SIZE; ++i) {
+      QVERIFY(appendJump(gameLogPath(QDir(gameLogDir.path()), i), round));
+    }
+    QTRY_VERIFY_WITH_TIMEOUT(allIn(QString("Round%1").arg(round + 1)),
+                             DELIVERY_TIMEOUT_MS);
+  }
+
+  const int wakeupsPerSecond = reader.guiWakeupsPerSecond();
+  reader.stop();
+
+  // Per-event delivery wakes the GUI thread once per pilot and jump
+  if (!batched) {
+    QCOMPARE(wakeups, FLEET_SIZE * JUMP_ROUNDS);
+  }
+  qInfo().noquote() << QString("%1: %2 wakeups per mass jump of %3, last "
+                               "measured rate %4/s")
+                           .arg(batched ? "batched" : "per event")
+                           .arg(double(wakeups) / JUMP_ROUNDS, 0, 'f', 1)
+                           .arg(FLEET_SIZE)
+                           .arg(wakeupsPerSecond);
+}
+
+void TestChatLogReader::startupTime_data() {
+  QTest::addColumn<bool>("warmIndex");
+  QTest::newRow("cold index") << false;
+  QTest::newRow("warm index") << true;
+}
+
+void TestChatLogReader::startupTime() {
+  // Time from start() until the system of every character is known, over
+  // 200 Local chatlogs of 2 MB. The warm row reuses the listener index of
+  // an earlier run, as every start but the first does.
+  QFETCH(bool, warmIndex);
+  QVERIFY(createLargeChatLogs());
+
+  QTemporaryDir dataDir;
+  QVERIFY(dataDir.isValid());
+
+  const auto configure = [&](ChatLogReader &reader) {
+    reader.setDataDirectory(dataDir.path());
+    reader.setLogDirectory(m_dir.filePath("chatlogs"));
+    reader.setEnableGameLogMonitoring(false);
+    reader.setCharacterNames(m_largeLogCharacters);
+  };
+  const auto allLocated = [&](const ChatLogReader &reader) {
+    return std::all_of(m_largeLogCharacters.cbegin(),
+                       m_largeLogCharacters.cend(),
+                       [&](const QString &character) {
+                         return reader.getSystemForCharacter(character) ==
+                                "Jita";
+                       });
+  };
+
+  if (warmIndex) {
+    ChatLogReader reader;
+    configure(reader);
+    reader.start();
+    QTRY_VERIFY_WITH_TIMEOUT(allLocated(reader), STARTUP_TIMEOUT_MS);
+    reader.stop();
+  }
+
+  ChatLogReader reader;
+  configure(reader);
+
+  QElapsedTimer timer;
+  timer.start();
+  reader.start();
+  QTRY_VERIFY_WITH_TIMEOUT(allLocated(reader), STARTUP_TIMEOUT_MS);
+  const qint64 elapsedMs = timer.elapsed();
+
+  reader.stop();
+
+  qInfo().noquote() << QString("%1: %2 logs of %3 MB located in %4 ms")
+                           .arg(warmIndex ? "warm index" : "cold index")
+                           .arg(LARGE_LOG_COUNT)
+                           .arg(LARGE_LOG_BYTES / (1024 * 1024))
+                           .arg(elapsedMs);
+}
+
+void TestChatLogReader::catchUpMemory_data() {
+  QTest::addColumn<bool>("wholeFiles");
+  QTest::newRow("reader") << false;
+  QTest::newRow("whole-file reads") << true;
+}
+
+void TestChatLogReader::catchUpMemory() {
+  // Peak resident memory and wall time of catching up on 200 Local
+  // chatlogs of 2 MB with a cold listener index, against reading and
+  // decoding every log whole as the initial scan once did
+  QFETCH(bool, wholeFiles);
+  QVERIFY(createLargeChatLogs());
+
+  const bool peakReset = BenchmarkCounters::resetPeakResident();
+  const qint64 residentBefore = BenchmarkCounters::peakResidentBytes();
+
+  QElapsedTimer timer;
+  timer.start();
+
+  if (wholeFiles) {
+    const QDir chatLogDir(m_dir.filePath("chatlogs"));
+    for (int i = 0; i < LARGE_LOG_COUNT; ++i) {
+      QFile file(chatLogPath(chatLogDir, i));
+      QVERIFY(file.open(QIODevice::ReadOnly));
+      QStringDecoder decoder(QStringDecoder::Utf16LE);
+      const QString text = decoder.decode(file.readAll());
+      QVERIFY(text.lastIndexOf("Channel changed to Local") >= 0);
+    }
+  } else {
+    QTemporaryDir dataDir;
+    QVERIFY(dataDir.isValid());
+
+    ChatLogReader reader;
+    reader.setDataDirectory(dataDir.path());
+    reader.setLogDirectory(m_dir.filePath("chatlogs"));
+    reader.setEnableGameLogMonitoring(false);
+    reader.setCharacterNames(m_largeLogCharacters);
+    reader.start();
+    QTRY_VERIFY_WITH_TIMEOUT(
+        std::all_of(m_largeLogCharacters.cbegin(),
+                    m_largeLogCharacters.cend(),
+                    [&](const QString &character) {
+                      return reader.getSystemForCharacter(character) ==
+                             "Jita";
+                    }),
+        STARTUP_TIMEOUT_MS);
+    reader.stop();
+  }
+
+  const qint64 elapsedMs = timer.elapsed();
+  const qint64 peak = BenchmarkCounters::peakResidentBytes();
+
+  // Without a reset the peak is that of the whole process so far; run
+  // each row on its own to compare them
+  QString memory = "n/a";
+  if (peak >= 0) {
+    memory = peakReset
+                 ? QString("peak +%1 MB").arg((peak - residentBefore) /
+                                                  (1024.0 * 1024.0),
+                                              0, 'f', 1)
+                 : QString("process peak %1 MB")
+                       .arg(peak / (1024.0 * 1024.0), 0, 'f', 1);
+  }
+  qInfo().noquote() << QString("%1: %2 ms, %3")
+                           .arg(wholeFiles ? "whole-file reads" : "reader")
+                           .arg(elapsedMs)
+                           .arg(memory);
+}
+
+QTEST_GUILESS_MAIN(TestChatLogReader)
+#include "tst_chatlogreader.moc"
@@ -0,0 +1,196 @@
+#include "combatdamagetracker.h"
+#include <QTest>
+
+namespace {
+
+constexpr qint64 START_MS = 1705322096000; // 2024.01.15 12:34:56
+
+const QString OUTGOING_LINE =
+    "[ 2024.01.15 12:34:56 ] (combat) <color=0xff00ffff><b>523</b> "
+    "<color=0x77ffffff><font size=10>to</font> <b><color=0xffffffff>Pirate "
+    "Frigate</b><font size=10><color=0x77ffffff> - Small Focused Beam Laser "
+    "II - Hits";
+const QString INCOMING_LINE =
+    "[ 2024.01.15 12:34:56 ] (combat) <color=0xffcc0000><b>120</b> "
+    "<color=0x77ffffff><font size=10>from</font> <b><color=0xffffffff>Pirate "
+    "Frigate</b><font size=10><color=0x77ffffff> - Light Missile - Hits";
+
+CombatHit hit(int damage, bool outgoing) {
+  CombatHit result;
+  result.damage = damage;
+  result.outgoing = outgoing;
+  return result;
+}
+
+} // namespace
+
+class TestCombatDamageTracker : public QObject {
+  Q_OBJECT
+
+private slots:
+  void parseLine_data();
+  void parseLine();
+  void shortWindowRollsOver();
+  void longWindowRollsOver();
+  void lateHitsOutsideWindowAreIgnored();
+  void newestTimestampDrivesWindow();
+  void throughputBenchmark();
+};
+
+void TestCombatDamageTracker::parseLine_data() {
+  QTest::addColumn<QString>("line");
+  QTest::addColumn<bool>("parsed");
+  QTest::addColumn<int>("damage");
+  QTest::addColumn<bool>("outgoing");
+
+  const QString ts = "[ 2024.01.15 12:34:56 ] ";
+
+  QTest::newRow("dealt with markup") << OUTGOING_LINE << true << 523 << true;
+  QTest::newRow("received with markup")
+      << INCOMING_LINE << true << 120 << false;
+  QTest::newRow("dealt without markup")
+      << ts + "(combat) 75 to Pirate Frigate - Hits" << true << 75 << true;
+  QTest::newRow("received at end of line")
+      << ts + "(combat) 75 from" << true << 75 << false;
+  QTest::newRow("largest damage")
+      << ts + "(combat) 999999999 to Titan - Wrecks" << true << 999999999
+      << true;
+
+  QTest::newRow("own miss")
+      << ts + "(combat) Your group of Small Focused Beam Laser II misses "
+              "Pirate Frigate completely - Small Focused Beam Laser II"
+      << false << 0 << false;
+  QTest::newRow("incoming miss")
+      << ts + "(combat) Pirate Frigate misses you completely - Light Missile"
+      << false << 0 << false;
+  QTest::newRow("overflow")
+      << ts + "(combat) 1234567890 to Titan - Wrecks" << false << 0 << false;
+  QTest::newRow("unterminated markup")
+      << ts + "(combat) <color=0xff00ffff" << false << 0 << false;
+  QTest::newRow("word starting with to")
+      << ts + "(combat) 75 tomatoes" << false << 0 << false;
+  QTest::newRow("no direction") << ts + "(combat) 75" << false << 0 << false;
+  QTest::newRow("not a combat line")
+      << ts + "(notify) 75 from the cargo" << false << 0 << false;
+}
+
+void TestCombatDamageTracker::parseLine() {
+  QFETCH(QString, line);
+  QFETCH(bool, parsed);
+  QFETCH(int, damage);
+  QFETCH(bool, outgoing);
+
+  CombatHit result;
+  QCOMPARE(CombatDamageTracker::parseLine(line, result), parsed);
+  if (parsed) {
+    QCOMPARE(result.damage, damage);
+    QCOMPARE(result.outgoing, outgoing);
+  }
+}
+
+void TestCombatDamageTracker::shortWindowRollsOver() {
+  CombatDamageTracker tracker;
+  tracker.record("Pilot", START_MS, hit(100, true));
+  tracker.record("Pilot", START_MS + 500, hit(50, false));
+
+  CombatDamageStatsList stats = tracker.takeStats(START_MS + 900);
+  QCOMPARE(stats.size(), 1);
+  QCOMPARE(stats[0].characterName, QString("Pilot"));
+  QCOMPARE(stats[0].dpsOutShort, 100.0 / 5);
+  QCOMPARE(stats[0].dpsInShort, 50.0 / 5);
+  QCOMPARE(stats[0].dpsOutLong, 100.0 / 60);
+  QCOMPARE(stats[0].dpsInLong, 50.0 / 60);
+
+  // Still inside the 5 s window four seconds later
+  stats = tracker.takeStats(START_MS + 4000);
+  QCOMPARE(stats[0].dpsOutShort, 100.0 / 5);
+
+  // Out of it after five, but not out of the 60 s window
+  stats = tracker.takeStats(START_MS + 5000);
+  QCOMPARE(stats[0].dpsOutShort, 0.0);
+  QCOMPARE(stats[0].dpsInShort, 0.0);
+  QCOMPARE(stats[0].dpsOutLong, 100.0 / 60);
+  QVERIFY(!stats[0].isIdle());
+}
+
+void TestCombatDamageTracker::longWindowRollsOver() {
+  CombatDamageTracker tracker;
+  tracker.record("Pilot", START_MS, hit(600, true));
+  tracker.record("Pilot", START_MS + 30000, hit(60, true));
+
+  CombatDamageStatsList stats = tracker.takeStats(START_MS + 59000);
+  QCOMPARE(stats[0].dpsOutLong, 660.0 / 60);
+
+  stats = tracker.takeStats(START_MS + 60000);
+  QCOMPARE(stats[0].dpsOutLong, 60.0 / 60);
+
+  // Reported idle once, then forgotten
+  stats = tracker.takeStats(START_MS + 90000);
+  QCOMPARE(stats.size(), 1);
+  QVERIFY(stats[0].isIdle());
+  QVERIFY(tracker.isEmpty());
+  QVERIFY(tracker.takeStats(START_MS + 91000).isEmpty());
+}
+
+void TestCombatDamageTracker::lateHitsOutsideWindowAreIgnored() {
+  CombatDamageTracker tracker;
+  tracker.record("Pilot", START_MS + 60000, hit(10, true));
+  tracker.record("Pilot", START_MS, hit(1000, true));
+  tracker.record("Pilot", START_MS + 1000, hit(50, true));
+
+  const CombatDamageStatsList stats = tracker.takeStats(START_MS + 60000);
+  QCOMPARE(stats[0].dpsOutLong, 60.0 / 60);
+}
+
+void TestCombatDamageTracker::newestTimestampDrivesWindow() {
+  // Log lines from a client whose clock is far from the local one still
+  // land in the window when it is moved from the newest log time
+  CombatDamageTracker tracker;
+  QCOMPARE(tracker.newestTimestamp(), qint64(0));
+  tracker.record("Pilot A", START_MS + 2000, hit(100, true));
+  tracker.record("Pilot B", START_MS, hit(50, true));
+  QCOMPARE(tracker.newestTimestamp(), START_MS + 2000);
+
+  CombatDamageStatsList stats = tracker.takeStats(tracker.newestTimestamp());
+  QCOMPARE(stats.size(), 2);
+  for (const CombatDamageStats &entry : std::as_const(stats)) {
+    QVERIFY(entry.dpsOutShort > 0.0);
+  }
+
+  tracker.clear();
+  QCOMPARE(tracker.newestTimestamp(), qint64(0));
+}
+
+void TestCombatDamageTracker::throughputBenchmark() {
+  // A busy fight: mostly hits in both directions, some misses, spread over
+  // a few pilots and one minute of log time
+  const QStringList pilots = {"Pilot A", "Pilot B", "Pilot C", "Pilot D"};
+  QStringList lines;
+  for (int i = 0; i < 10000; ++i) {
+    if (i % 10 == 0) {
+      lines.append("[ 2024.01.15 12:34:56 ] (combat) Pirate Frigate misses "
+                   "you completely - Light Missile");
+    } else {
+      lines.append(i % 2 ? OUTGOING_LINE : INCOMING_LINE);
+    }
+  }
+
+  // Each iteration parses and records 10000 lines
+  int hits = 0;
+  QBENCHMARK {
+    CombatDamageTracker tracker;
+    hits = 0;
+    for (int i = 0; i < lines.size(); ++i) {
+      CombatHit parsed;
+      if (CombatDamageTracker::parseLine(lines[i], parsed)) {
+        tracker.record(pilots[i % pilots.size()], START_MS + i * 6, parsed);
+        ++hits;
+      }
+    }
+    tracker.takeStats(START_MS + lines.size() * 6);
+  }
+  QCOMPARE(hits, 9000);
+}
+
+QTEST_APPLESS_MAIN(TestCombatDamageTracker)
+#include "tst_combatdamagetracker.moc"
@@ -0,0 +1,95 @@
+#include "config.h"
+#include <QTest>
+
+namespace {
+
+constexpr int CHARACTER_COUNT = 100;
+
+QString pilotName(int i) { return QString("Pilot %1").arg(i); }
+
+/// Every third character has its own colours, as in a typical profile
+QColor borderColor(int i) {
+  return i % 3 == 0 ? QColor::fromHsv((i * 7) % 360, 200, 255) : QColor();
+}
+
+QColor inactiveBorderColor(int i) {
+  return i % 3 == 0 ? QColor::fromHsv((i * 7) % 360, 120, 160) : QColor();
+}
+
+} // namespace
+
+class TestConfigSnapshot : public QObject {
+  Q_OBJECT
+
+private slots:
+  void colorsOfUnknownIdAreInvalid();
+  void perFrameLookups_data();
+  void perFrameLookups();
+};
+
+void TestConfigSnapshot::colorsOfUnknownIdAreInvalid() {
+  ConfigSnapshot snapshot;
+  snapshot.characterColors.append(
+      ConfigSnapshot::CharacterColors{QColor(Qt::red), QColor(Qt::blue)});
+
+  QCOMPARE(snapshot.colorsOf(0).border, QColor(Qt::red));
+  QCOMPARE(snapshot.colorsOf(0).inactiveBorder, QColor(Qt::blue));
+  QVERIFY(!snapshot.colorsOf(-1).border.isValid());
+  QVERIFY(!snapshot.colorsOf(1).inactiveBorder.isValid());
+}
+
+void TestConfigSnapshot::perFrameLookups_data() {
+  QTest::addColumn<bool>("denseIds");
+  QTest::newRow("dense ids") << true;
+  QTest::newRow("name hashes") << false;
+}
+
+void TestConfigSnapshot::perFrameLookups() {
+  // The per-character settings one frame of 100 thumbnails reads while
+  // painting: a snapshot and its colours by id, against a hash lookup by
+  // name for each colour as before the character table
+  QFETCH(bool, denseIds);
+
+  auto snapshot = std::make_shared<ConfigSnapshot>();
+  QHash<QString, QColor> borderColors;
+  QHash<QString, QColor> inactiveBorderColors;
+  QStringList names;
+  for (int i = 0; i < CHARACTER_COUNT; ++i) {
+    names.append(pilotName(i));
+    snapshot->characterColors.append(ConfigSnapshot::CharacterColors{
+        borderColor(i), inactiveBorderColor(i)});
+    if (borderColor(i).isValid()) {
+      borderColors.insert(pilotName(i), borderColor(i));
+      inactiveBorderColors.insert(pilotName(i), inactiveBorderColor(i));
+    }
+  }
+  std::atomic<std::shared_ptr<const ConfigSnapshot>> published(
+      std::move(snapshot));
+
+  int customColors = 0;
+  QBENCHMARK {
+    customColors = 0;
+    for (int id = 0; id < CHARACTER_COUNT; ++id) {
+      QColor border;
+      QColor inactiveBorder;
+      if (denseIds) {
+        const std::shared_ptr<const ConfigSnapshot> cfg =
+            published.load(std::memory_order_acquire);
+        const ConfigSnapshot::CharacterColors colors = cfg->colorsOf(id);
+        border = colors.border;
+        inactiveBorder = colors.inactiveBorder;
+      } else {
+        border = borderColors.value(names[id]);
+        inactiveBorder = inactiveBorderColors.value(names[id]);
+      }
+      if (border.isValid() && inactiveBorder.isValid()) {
+        ++customColors;
+      }
+    }
+  }
+
+  QCOMPARE(customColors, (CHARACTER_COUNT + 2) / 3);
+}
+
+QTEST_APPLESS_MAIN(TestConfigSnapshot)
+#include "tst_configsnapshot.moc"
@@ -0,0 +1,109 @@
+#include "evetimestamp.h"
+#include <QDateTime>
+#include <QTest>
+#include <QTimeZone>
+
+namespace {
+
+qint64 utcMSecs(int year, int month, int day, int hour, int minute,
+                int second) {
+  return QDateTime(QDate(year, month, day), QTime(hour, minute, second),
+                   QTimeZone::utc())
+      .toMSecsSinceEpoch();
+}
+
+} // namespace
+
+class TestEveTimestamp : public QObject {
+  Q_OBJECT
+
+private slots:
+  void parse_data();
+  void parse();
+  void parseLine_data();
+  void parseLine();
+  void benchmark();
+};
+
+void TestEveTimestamp::parse_data() {
+  QTest::addColumn<QString>("text");
+  QTest::addColumn<qint64>("expected");
+
+  QTest::newRow("regular") << "2024.01.15 12:34:56"
+                           << utcMSecs(2024, 1, 15, 12, 34, 56);
+  QTest::newRow("leap day") << "2024.02.29 00:00:00"
+                            << utcMSecs(2024, 2, 29, 0, 0, 0);
+  QTest::newRow("end of year") << "2023.12.31 23:59:59"
+                               << utcMSecs(2023, 12, 31, 23, 59, 59);
+  QTest::newRow("first year") << "2000.01.01 00:00:00"
+                              << utcMSecs(2000, 1, 1, 0, 0, 0);
+
+  QTest::newRow("no leap day") << "2023.02.29 00:00:00" << qint64(-1);
+  QTest::newRow("month 13") << "2024.13.01 00:00:00" << qint64(-1);
+  QTest::newRow("hour 24") << "2024.01.15 24:00:00" << qint64(-1);
+  QTest::newRow("second 60") << "2024.01.15 12:34:60" << qint64(-1);
+  QTest::newRow("year too early") << "1999.12.31 23:59:59" << qint64(-1);
+  QTest::newRow("dashes") << "2024-01-15 12:34:56" << qint64(-1);
+  QTest::newRow("letter") << "2024.01.15 12:3x:56" << qint64(-1);
+  QTest::newRow("sign") << "2024.01.15 12:+4:56" << qint64(-1);
+  QTest::newRow("too short") << "2024.01.15 12:34:5" << qint64(-1);
+  QTest::newRow("too long") << "2024.01.15 12:34:567" << qint64(-1);
+  QTest::newRow("empty") << "" << qint64(-1);
+}
+
+void TestEveTimestamp::parse() {
+  QFETCH(QString, text);
+  QFETCH(qint64, expected);
+
+  QCOMPARE(EveTimestamp::parse(text), expected);
+}
+
+void TestEveTimestamp::parseLine_data() {
+  QTest::addColumn<QString>("line");
+  QTest::addColumn<qint64>("expected");
+
+  const qint64 time = utcMSecs(2024, 1, 15, 12, 34, 56);
+  QTest::newRow("game log")
+      << "[ 2024.01.15 12:34:56 ] (notify) Following Fleet Boss in warp"
+      << time;
+  QTest::newRow("chat log with byte order mark")
+      << QString(QChar(0xFEFF)) +
+             "[ 2024.01.15 12:34:56 ] EVE System > Channel changed to Local "
+             ": Jita"
+      << time;
+  QTest::newRow("no space after bracket")
+      << "[2024.01.15 12:34:56] (None) Jumping from Jita to Perimeter"
+      << time;
+  QTest::newRow("timestamp only") << "[ 2024.01.15 12:34:56" << time;
+
+  QTest::newRow("header line") << "  Listener: Some Pilot" << qint64(-1);
+  QTest::newRow("leading space")
+      << " [ 2024.01.15 12:34:56 ] (notify) Following" << qint64(-1);
+  QTest::newRow("bracket only") << "[" << qint64(-1);
+  QTest::newRow("empty") << "" << qint64(-1);
+}
+
+void TestEveTimestamp::parseLine() {
+  QFETCH(QString, line);
+  QFETCH(qint64, expected);
+
+  QCOMPARE(EveTimestamp::parseLine(line), expected);
+}
+
+void TestEveTimestamp::benchmark() {
+  const QString line =
+      "[ 2024.01.15 12:34:56 ] (notify) Following Fleet Boss in warp";
+
+  // Each iteration parses 1000 lines
+  qint64 sum = 0;
+  QBENCHMARK {
+    sum = 0;
+    for (int i = 0; i < 1000; ++i) {
+      sum += EveTimestamp::parseLine(line);
+    }
+  }
+  QCOMPARE(sum, 1000 * utcMSecs(2024, 1, 15, 12, 34, 56));
+}
+
+QTEST_APPLESS_MAIN(TestEveTimestamp)
+#include "tst_evetimestamp.moc"
@@ -0,0 +1,139 @@
+#include "logalertmatcher.h"
+#include <QTest>
+#include <algorithm>
+
+namespace {
+
+LogAlertRule rule(const QString &name, const QString &pattern,
+                  bool isRegex = false,
+                  LogAlertRule::Channel channel = LogAlertRule::AnyLog) {
+  LogAlertRule result;
+  result.name = name;
+  result.pattern = pattern;
+  result.isRegex = isRegex;
+  result.channel = channel;
+  return result;
+}
+
+/// Rules as users write them: mostly literals, every fourth a regex with a
+/// literal run and every tenth one without
+QVector<LogAlertRule> rules(int count) {
+  QVector<LogAlertRule> result;
+  for (int i = 0; i < count; ++i) {
+    if (i % 10 == 9) {
+      result.append(rule(QString("rule%1").arg(i),
+                         QString("\\b%1\\d{5}\\b").arg(i % 7), true));
+    } else if (i % 4 == 3) {
+      result.append(rule(QString("rule%1").arg(i),
+                         QString("scrambled by \\w+ %1").arg(i), true));
+    } else {
+      result.append(rule(QString("rule%1").arg(i),
+                         QString("Keyword%1").arg(i)));
+    }
+  }
+  return result;
+}
+
+QVector<int> matches(const LogAlertMatcher &matcher, const QString &line,
+                     bool isChatLog = false) {
+  QVector<int> matched;
+  matcher.match(line, isChatLog, matched);
+  std::sort(matched.begin(), matched.end());
+  return matched;
+}
+
+} // namespace
+
+class TestLogAlertMatcher : public QObject {
+  Q_OBJECT
+
+private slots:
+  void literalIgnoresCase();
+  void regexWithRequiredLiteral();
+  void channelFilter();
+  void disabledAndInvalidRulesDropped();
+  void matchBenchmark_data();
+  void matchBenchmark();
+};
+
+void TestLogAlertMatcher::literalIgnoresCase() {
+  LogAlertMatcher matcher;
+  matcher.compile({rule("points", "warp scramble")});
+
+  QCOMPARE(matches(matcher, "[ 2024.01.15 12:34:56 ] (notify) WARP SCRAMBLE "
+                            "attempt"),
+           QVector<int>{0});
+  QCOMPARE(matches(matcher, "(notify) warp disrupt"), QVector<int>());
+}
+
+void TestLogAlertMatcher::regexWithRequiredLiteral() {
+  LogAlertMatcher matcher;
+  matcher.compile({rule("neut", "energy neutraliz\\w+ by (\\w+)", true),
+                   rule("big hit", "\\b[5-9]\\d{2}\\b from", true)});
+
+  QCOMPARE(matches(matcher, "(combat) Energy neutralized by Pirate"),
+           QVector<int>());
+  QCOMPARE(matches(matcher, "(combat) energy neutralized by Pirate"),
+           QVector<int>{0});
+  QCOMPARE(matches(matcher, "(combat) 640 from Pirate - Hits"),
+           QVector<int>{1});
+  QCOMPARE(matches(matcher, "(combat) 64 from Pirate - Hits"), QVector<int>());
+}
+
+void TestLogAlertMatcher::channelFilter() {
+  LogAlertMatcher matcher;
+  matcher.compile({rule("chat", "cyno", false, LogAlertRule::ChatLog),
+                   rule("game", "cyno", false, LogAlertRule::GameLog)});
+
+  QCOMPARE(matches(matcher, "cyno up", true), QVector<int>{0});
+  QCOMPARE(matches(matcher, "cyno up", false), QVector<int>{1});
+  QVERIFY(matcher.hasRulesFor(true));
+}
+
+void TestLogAlertMatcher::disabledAndInvalidRulesDropped() {
+  LogAlertRule disabled = rule("off", "anything");
+  disabled.enabled = false;
+
+  LogAlertMatcher matcher;
+  matcher.compile({disabled, rule("broken", "(unclosed", true)});
+  QVERIFY(matcher.isEmpty());
+}
+
+void TestLogAlertMatcher::matchBenchmark_data() {
+  QTest::addColumn<int>("ruleCount");
+  QTest::newRow("1 rule") << 1;
+  QTest::newRow("10 rules") << 10;
+  QTest::newRow("100 rules") << 100;
+}
+
+void TestLogAlertMatcher::matchBenchmark() {
+  // A busy gamelog: combat lines, most of which match no rule
+  QFETCH(int, ruleCount);
+
+  LogAlertMatcher matcher;
+  matcher.compile(rules(ruleCount));
+  QCOMPARE(matcher.rules().size(), ruleCount);
+
+  QStringList lines;
+  for (int i = 0; i < 1000; ++i) {
+    lines.append(QString("[ 2024.01.15 12:34:%1 ] (combat) %2 from Pirate "
+                         "Frigate %3 - Heavy Missile - Hits%4")
+                     .arg(i % 60, 2, 10, QChar('0'))
+                     .arg(i % 900)
+                     .arg(i)
+                     .arg(i % 50 == 0 ? " Keyword0" : ""));
+  }
+
+  // Each iteration matches 1000 lines against every rule
+  QVector<int> matched;
+  QBENCHMARK {
+    matched.clear();
+    for (const QString &line : std::as_const(lines)) {
+      matcher.match(line, false, matched);
+    }
+  }
+  QCOMPARE(matched.count(0), qsizetype(20));
+}
+
+QTEST_APPLESS_MAIN(TestLogAlertMatcher)
+#include "tst_logalertmatcher.moc"
@@ -0,0 +1,104 @@
+#include "logdirectorydiff.h"
+#include <QElapsedTimer>
+#include <QFile>
+#include <QFileSystemWatcher>
+#include <QSignalSpy>
+#include <QTemporaryDir>
+#include <QTest>
+
+namespace {
+
+const QStringList FILTERS = {"Local_*.txt"};
+
+// New logs must be attached within one directory event; the rescan this
+// replaced ran every five minutes
+constexpr int MAX_DETECTION_MS = 2000;
+
+bool createFile(const QString &path) {
+  QFile file(path);
+  return file.open(QIODevice::WriteOnly) && file.write("log\n") == 4;
+}
+
+} // namespace
+
+class TestLogDirectoryDiff : public QObject {
+  Q_OBJECT
+
+private slots:
+  void firstListingOnlySeeds();
+  void reportsAddedAndRemoved();
+  void detectsNewFileWithinOneEvent();
+};
+
+void TestLogDirectoryDiff::firstListingOnlySeeds() {
+  QTemporaryDir dir;
+  QVERIFY(dir.isValid());
+  QVERIFY(createFile(dir.filePath("Local_20240115_120000_1.txt")));
+
+  LogDirectoryDiff diff;
+  QVERIFY(!diff.isSeeded());
+  QVERIFY(diff.update(QDir(dir.path()), FILTERS).isEmpty());
+  QVERIFY(diff.isSeeded());
+
+  diff.reset();
+  QVERIFY(!diff.isSeeded());
+  QVERIFY(diff.update(QDir(dir.path()), FILTERS).isEmpty());
+}
+
+void TestLogDirectoryDiff::reportsAddedAndRemoved() {
+  QTemporaryDir dir;
+  QVERIFY(dir.isValid());
+  const QString kept = dir.filePath("Local_20240115_120000_1.txt");
+  const QString removed = dir.filePath("Local_20240115_120000_2.txt");
+  QVERIFY(createFile(kept));
+  QVERIFY(createFile(removed));
+
+  LogDirectoryDiff diff;
+  diff.update(QDir(dir.path()), FILTERS);
+
+  const QString added = dir.filePath("Local_20240115_130000_3.txt");
+  QVERIFY(createFile(added));
+  QVERIFY(createFile(dir.filePath("Fleet_20240115_130000_3.txt")));
+  QVERIFY(QFile::remove(removed));
+
+  const LogDirectoryDiff::Changes changes =
+      diff.update(QDir(dir.path()), FILTERS);
+  QCOMPARE(changes.added, QStringList{QDir(dir.path()).absoluteFilePath(
+                              "Local_20240115_130000_3.txt")});
+  QCOMPARE(changes.removed, QStringList{QDir(dir.path()).absoluteFilePath(
+                                "Local_20240115_120000_2.txt")});
+
+  QVERIFY(diff.update(QDir(dir.path()), FILTERS).isEmpty());
+}
+
+void TestLogDirectoryDiff::detectsNewFileWithinOneEvent() {
+  QTemporaryDir dir;
+  QVERIFY(dir.isValid());
+
+  LogDirectoryDiff diff;
+  diff.update(QDir(dir.path()), FILTERS);
+
+  // As in ChatLogWorker: the directory event triggers the diff
+  QFileSystemWatcher watcher(QStringList{dir.path()});
+  QStringList added;
+  connect(&watcher, &QFileSystemWatcher::directoryChanged, this,
+          [&diff, &added](const QString &path) {
+            added += diff.update(QDir(path), FILTERS).added;
+          });
+  QSignalSpy spy(&watcher, &QFileSystemWatcher::directoryChanged);
+
+  QElapsedTimer timer;
+  timer.start();
+  QVERIFY(createFile(dir.filePath("Local_20240115_120000_1.txt")));
+
+  QTRY_VERIFY_WITH_TIMEOUT(!added.isEmpty(), MAX_DETECTION_MS);
+  const qint64 latencyMs = timer.elapsed();
+  qDebug() << "New log detected after" << latencyMs << "ms and"
+           << spy.count() << "directory events";
+
+  QCOMPARE(added.size(), 1);
+  QVERIFY(latencyMs < MAX_DETECTION_MS);
+}
+
+QTEST_GUILESS_MAIN(TestLogDirectoryDiff)
+#include "tst_logdirectorydiff.moc"
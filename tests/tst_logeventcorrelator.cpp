@@ -0,0 +1,55 @@
+#include "logeventcorrelator.h"
+#include <QTest>
+
+class TestLogEventCorrelator : public QObject {
+  Q_OBJECT
+
+private slots:
+  void groupsWithinWindow();
+  void keysOnTypeAndNormalizedText();
+  void windowIsLogTime();
+};
+
+void TestLogEventCorrelator::groupsWithinWindow() {
+  LogEventCorrelator correlator(1500);
+
+  const LogEventCorrelator::Result first =
+      correlator.add("follow_warp", "Warping to fleet member", 10000);
+  QVERIFY(first.opened);
+
+  const LogEventCorrelator::Result second =
+      correlator.add("follow_warp", "Warping to fleet member", 11000);
+  QVERIFY(!second.opened);
+  QCOMPARE(second.groupId, first.groupId);
+
+  // The window starts with the first event of the group
+  const LogEventCorrelator::Result third =
+      correlator.add("follow_warp", "Warping to fleet member", 11500);
+  QVERIFY(third.opened);
+  QVERIFY(third.groupId != first.groupId);
+}
+
+void TestLogEventCorrelator::keysOnTypeAndNormalizedText() {
+  LogEventCorrelator correlator;
+
+  const quint64 warp =
+      correlator.add("follow_warp", "Warping to  Fleet member", 0).groupId;
+  QCOMPARE(correlator.add("follow_warp", "warping to fleet MEMBER", 0).groupId,
+           warp);
+  QVERIFY(correlator.add("regroup", "Warping to fleet member", 0).groupId !=
+          warp);
+}
+
+void TestLogEventCorrelator::windowIsLogTime() {
+  // Lines of a fleet warp logged in the same second match however late
+  // their log was read, and a line read early does not hold a later warp
+  LogEventCorrelator correlator(1500);
+
+  const quint64 warp = correlator.add("regroup", "Regroup", 60000).groupId;
+  QCOMPARE(correlator.add("regroup", "Regroup", 60000).groupId, warp);
+  QCOMPARE(correlator.add("regroup", "Regroup", 59000).groupId, warp);
+  QVERIFY(correlator.add("regroup", "Regroup", 90000).opened);
+}
+
+QTEST_APPLESS_MAIN(TestLogEventCorrelator)
+#include "tst_logeventcorrelator.moc"
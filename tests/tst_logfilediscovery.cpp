@@ -0,0 +1,134 @@
+#include "logfilediscovery.h"
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QTemporaryDir>
+#include <QTest>
+#include <QtConcurrent>
+#include <algorithm>
+
+namespace {
+
+constexpr int PILOT_COUNT = 250;
+constexpr int LOGS_PER_PILOT = 8;
+constexpr int SCAN_TIMEOUT_MS = 10000;
+
+QString pilotName(int i) { return QString("Pilot %1").arg(i); }
+
+/// Writes a gamelog of the pilot, last modified minutesAgo minutes ago
+bool writeGameLog(const QString &path, const QString &listener,
+                  int minutesAgo) {
+  QFile file(path);
+  if (!file.open(QIODevice::WriteOnly)) {
+    return false;
+  }
+  file.write("------------------------------------------------------------\n"
+             "  Gamelog\n");
+  file.write(QString("  Listener: %1\n").arg(listener).toUtf8());
+  file.write("  Session Started: 2024.01.15 12:34:56\n"
+             "------------------------------------------------------------\n");
+  return file.setFileTime(
+      QDateTime::currentDateTime().addSecs(-60 * minutesAgo),
+      QFileDevice::FileModificationTime);
+}
+
+/// Path of the pilot's session-th log; the session 0 log is the newest
+QString gameLogPath(const QDir &dir, int pilot, int session) {
+  return dir.filePath(QString("20240115_%1_%2.txt")
+                          .arg(100000 + session)
+                          .arg(90000000 + pilot));
+}
+
+} // namespace
+
+class TestLogFileDiscovery : public QObject {
+  Q_OBJECT
+
+private slots:
+  void initTestCase();
+  void newestLogPerListenerWins();
+  void headerScanScaling_data();
+  void headerScanScaling();
+
+private:
+  QTemporaryDir m_dir;
+  QStringList m_paths;
+};
+
+void TestLogFileDiscovery::initTestCase() {
+  QVERIFY(m_dir.isValid());
+
+  // Sessions of every pilot, interleaved so that neither file names nor
+  // creation order give away the newest one
+  const QDir dir(m_dir.path());
+  for (int session = LOGS_PER_PILOT - 1; session >= 0; --session) {
+    for (int pilot = 0; pilot < PILOT_COUNT; ++pilot) {
+      const QString path =
+          gameLogPath(dir, pilot, (session * 3) % LOGS_PER_PILOT);
+      QVERIFY(writeGameLog(path, pilotName(pilot), 10 + session));
+      m_paths.append(path);
+    }
+  }
+}
+
+void TestLogFileDiscovery::newestLogPerListenerWins() {
+  QTemporaryDir dataDir;
+  QVERIFY(dataDir.isValid());
+
+  LogFileDiscovery discovery;
+  discovery.setDataDirectory(dataDir.path());
+  discovery.setGameLogDirectory(m_dir.path());
+  discovery.setEnableChatLogMonitoring(false);
+
+  LogFileAssignment files;
+  files.complete = false;
+  connect(&discovery, &LogFileDiscovery::logFilesChanged, this,
+          [&](const LogFileAssignment &assignment) { files = assignment; });
+
+  // Headers are read on the pool, then the listing is resolved again
+  discovery.startMonitoring();
+  QTRY_VERIFY_WITH_TIMEOUT(files.complete, SCAN_TIMEOUT_MS);
+  discovery.stopMonitoring();
+
+  // Session 0 was written with the newest modification time
+  const QDir dir(m_dir.path());
+  QCOMPARE(files.gameLogs.size(), PILOT_COUNT);
+  for (int pilot = 0; pilot < PILOT_COUNT; ++pilot) {
+    QCOMPARE(files.gameLogs.value(pilotName(pilot).toLower()),
+             QFileInfo(gameLogPath(dir, pilot, 0)).absoluteFilePath());
+  }
+}
+
+void TestLogFileDiscovery::headerScanScaling_data() {
+  QTest::addColumn<int>("threads");
+  QTest::newRow("1 thread") << 1;
+  QTest::newRow("2 threads") << 2;
+  QTest::newRow("4 threads") << 4;
+  QTest::newRow("8 threads") << 8;
+}
+
+void TestLogFileDiscovery::headerScanScaling() {
+  // Headers of a cold index read as LogFileDiscovery does, on a pool of the
+  // given size
+  QFETCH(int, threads);
+
+  QThreadPool pool;
+  pool.setMaxThreadCount(threads);
+
+  QList<QPair<QString, QString>> results;
+  QBENCHMARK {
+    results = QtConcurrent::mapped(&pool, m_paths, [](const QString &path) {
+                return qMakePair(
+                    path, LogFileDiscovery::readListenerFromLogFile(path));
+              }).results();
+  }
+
+  QCOMPARE(results.size(), m_paths.size());
+  QVERIFY(std::all_of(results.cbegin(), results.cend(),
+                      [](const QPair<QString, QString> &result) {
+                        return result.second.startsWith("Pilot ");
+                      }));
+}
+
+QTEST_GUILESS_MAIN(TestLogFileDiscovery)
+#include "tst_logfilediscovery.moc"
@@ -0,0 +1,202 @@
+#include "logfileindex.h"
+#include <QDir>
+#include <QFile>
+#include <QTemporaryDir>
+#include <QTest>
+
+namespace {
+
+constexpr int SCAN_FILE_COUNT = 10000;
+
+bool writeLog(const QString &path, const QString &listener,
+              QIODevice::OpenMode mode = QIODevice::WriteOnly) {
+  QFile file(path);
+  if (!file.open(mode)) {
+    return false;
+  }
+  file.write("------------------------------------------------------------\n"
+             "  Gamelog\n");
+  file.write(QString("  Listener: %1\n").arg(listener).toUtf8());
+  return true;
+}
+
+bool appendLine(const QString &path) {
+  QFile file(path);
+  if (!file.open(QIODevice::Append)) {
+    return false;
+  }
+  file.write("[ 2024.01.15 12:34:56 ] (combat) 120 from Pirate - Hits\n");
+  return true;
+}
+
+/// Stand-in for LogFileDiscovery::readListenerFromLogFile on a cold index
+QString readListener(const QString &path) {
+  QFile file(path);
+  if (!file.open(QIODevice::ReadOnly)) {
+    return QString();
+  }
+  for (int i = 0; i < 3 && !file.atEnd(); ++i) {
+    const QString line = QString::fromUtf8(file.readLine());
+    if (line.contains("Listener:")) {
+      return line.section(':', 1).trimmed();
+    }
+  }
+  return QString();
+}
+
+/// Resolves every log in dir through the index, as a directory scan does;
+/// returns the number of files whose header had to be read
+int scan(const QDir &dir, LogFileIndex &index) {
+  int headersRead = 0;
+  const QFileInfoList files =
+      dir.entryInfoList(QStringList() << "*.txt", QDir::Files);
+  for (const QFileInfo &fileInfo : files) {
+    QString listener;
+    if (!index.lookup(fileInfo, listener)) {
+      index.insert(fileInfo, readListener(fileInfo.absoluteFilePath()));
+      ++headersRead;
+    }
+  }
+  return headersRead;
+}
+
+} // namespace
+
+class TestLogFileIndex : public QObject {
+  Q_OBJECT
+
+private slots:
+  void initTestCase();
+  void roundTrip();
+  void growthKeepsIndexFile();
+  void replacedFileIsReread();
+  void headerlessFileIsRetried();
+  void coldScanBenchmark();
+  void warmScanBenchmark();
+
+private:
+  QTemporaryDir m_dir;
+  QTemporaryDir m_scanDir; // SCAN_FILE_COUNT logs for the benchmarks
+};
+
+void TestLogFileIndex::initTestCase() {
+  QVERIFY(m_dir.isValid());
+  QVERIFY(m_scanDir.isValid());
+
+  for (int i = 0; i < SCAN_FILE_COUNT; ++i) {
+    QVERIFY(writeLog(m_scanDir.filePath(QString("%1_20240115_123456.txt")
+                                            .arg(90000000 + i)),
+                     QString("Pilot %1").arg(i % 40)));
+  }
+}
+
+void TestLogFileIndex::roundTrip() {
+  const QString logPath = m_dir.filePath("roundtrip.txt");
+  QVERIFY(writeLog(logPath, "Some Pilot"));
+  const QString indexPath = m_dir.filePath("roundtrip.dat");
+
+  LogFileIndex index;
+  index.load(indexPath);
+  index.insert(QFileInfo(logPath), "Some Pilot");
+  index.save();
+
+  LogFileIndex reloaded;
+  reloaded.load(indexPath);
+  QString listener;
+  QVERIFY(reloaded.lookup(QFileInfo(logPath), listener));
+  QCOMPARE(listener, QString("Some Pilot"));
+}
+
+void TestLogFileIndex::growthKeepsIndexFile() {
+  const QString logPath = m_dir.filePath("growing.txt");
+  QVERIFY(writeLog(logPath, "Some Pilot"));
+  const QString indexPath = m_dir.filePath("growing.dat");
+
+  LogFileIndex index;
+  index.load(indexPath);
+  index.insert(QFileInfo(logPath), "Some Pilot");
+  index.save();
+  QVERIFY(QFile::remove(indexPath));
+
+  // A live log grows between scans; that alone must not rewrite the index
+  QVERIFY(appendLine(logPath));
+  QString listener;
+  QVERIFY(index.lookup(QFileInfo(logPath), listener));
+  QCOMPARE(listener, QString("Some Pilot"));
+  index.save();
+  QVERIFY(!QFile::exists(indexPath));
+}
+
+void TestLogFileIndex::replacedFileIsReread() {
+  const QString logPath = m_dir.filePath("replaced.txt");
+  QVERIFY(writeLog(logPath, "Some Pilot"));
+  QVERIFY(appendLine(logPath));
+
+  LogFileIndex index;
+  index.load(m_dir.filePath("replaced.dat"));
+  index.insert(QFileInfo(logPath), "Some Pilot");
+
+  // Shorter than when it was indexed, so it cannot be the same log
+  QVERIFY(writeLog(logPath, "Other Pilot",
+                   QIODevice::WriteOnly | QIODevice::Truncate));
+  QString listener;
+  QVERIFY(!index.lookup(QFileInfo(logPath), listener));
+}
+
+void TestLogFileIndex::headerlessFileIsRetried() {
+  const QString logPath = m_dir.filePath("headerless.txt");
+  QFile file(logPath);
+  QVERIFY(file.open(QIODevice::WriteOnly));
+  file.close();
+
+  LogFileIndex index;
+  index.load(m_dir.filePath("headerless.dat"));
+  index.insert(QFileInfo(logPath), QString());
+
+  QString listener;
+  QVERIFY(index.lookup(QFileInfo(logPath), listener));
+  QVERIFY(listener.isEmpty());
+
+  QVERIFY(writeLog(logPath, "Some Pilot", QIODevice::Append));
+  QVERIFY(!index.lookup(QFileInfo(logPath), listener));
+}
+
+void TestLogFileIndex::coldScanBenchmark() {
+  // No index yet: every header is read, then the index is written once
+  const QDir dir(m_scanDir.path());
+  const QString indexPath = m_dir.filePath("cold.dat");
+
+  int headersRead = 0;
+  QBENCHMARK {
+    QFile::remove(indexPath);
+    LogFileIndex index;
+    index.load(indexPath);
+    headersRead = scan(dir, index);
+    index.save();
+  }
+  QCOMPARE(headersRead, SCAN_FILE_COUNT);
+}
+
+void TestLogFileIndex::warmScanBenchmark() {
+  // Index from an earlier session: no header is read and nothing is saved
+  const QDir dir(m_scanDir.path());
+  const QString indexPath = m_dir.filePath("warm.dat");
+  {
+    LogFileIndex index;
+    index.load(indexPath);
+    scan(dir, index);
+    index.save();
+  }
+
+  int headersRead = -1;
+  QBENCHMARK {
+    LogFileIndex index;
+    index.load(indexPath);
+    headersRead = scan(dir, index);
+    index.save();
+  }
+  QCOMPARE(headersRead, 0);
+}
+
+QTEST_APPLESS_MAIN(TestLogFileIndex)
+#include "tst_logfileindex.moc"
@@ -0,0 +1,246 @@
+#include "loglineclassifier.h"
+#include <QTest>
+
+namespace {
+
+constexpr int SEARCH_START = 20; // As in ChatLogWorker::parseLogLine
+
+bool matches(const QString &line, LogLineKind kind) {
+  return LogLineClassifier::patternFor(kind).match(line).hasMatch();
+}
+
+/// Kind the old chain of case-insensitive indexOf() checks and regexes
+/// reported for a line. Conduit jumps are treated as reachable, which the
+/// old chain meant but never did.
+LogLineKind referenceKind(const QString &line) {
+  auto find = [&line](const char *literal, int from) {
+    return line.indexOf(QLatin1String(literal), from, Qt::CaseInsensitive);
+  };
+
+  const int notifyPos = find("(notify)", SEARCH_START);
+  const int questionPos = find("(question)", SEARCH_START);
+  const int miningPos = find("(mining)", SEARCH_START);
+  const int nonePos = find("(None)", SEARCH_START);
+  const int eveSystemPos = find("EVE System", SEARCH_START);
+
+  struct Keyword {
+    const char *text;
+    LogLineKind kind;
+  };
+
+  if (eveSystemPos != -1) {
+    return matches(line, LogLineKind::SystemChange)
+               ? LogLineKind::SystemChange
+               : LogLineKind::Unrecognized;
+  }
+
+  if (questionPos != -1) {
+    return matches(line, LogLineKind::FleetInvite) ? LogLineKind::FleetInvite
+                                                   : LogLineKind::Unrecognized;
+  }
+
+  if (notifyPos != -1) {
+    static const Keyword notifyKeywords[] = {
+        {"Following", LogLineKind::FollowWarp},
+        {"Regrouping", LogLineKind::Regroup},
+        {"compressed", LogLineKind::Compression},
+        {"cloak deactivates", LogLineKind::Decloak},
+        {"deactivates due to the destruction", LogLineKind::CrystalBroke},
+        {"pale shadow of its former glory", LogLineKind::AsteroidDepleted},
+        {"Conduit Field", LogLineKind::ConduitJump},
+    };
+    for (const Keyword &keyword : notifyKeywords) {
+      if (find(keyword.text, notifyPos) != -1 && matches(line, keyword.kind)) {
+        return keyword.kind;
+      }
+    }
+    return LogLineKind::Unrecognized;
+  }
+
+  if (miningPos != -1) {
+    return matches(line, LogLineKind::Mining) ? LogLineKind::Mining
+                                              : LogLineKind::Unrecognized;
+  }
+
+  if (nonePos != -1) {
+    static const Keyword noneKeywords[] = {
+        {"Jumping", LogLineKind::Jump},
+        {"conversation", LogLineKind::ConvoRequest},
+    };
+    for (const Keyword &keyword : noneKeywords) {
+      if (find(keyword.text, nonePos) != -1 && matches(line, keyword.kind)) {
+        return keyword.kind;
+      }
+    }
+  }
+
+  return LogLineKind::Unrecognized;
+}
+
+/// What ChatLogWorker::parseLogLine extracts from a line now
+LogLineClassifier::Extraction extracted(const LogLineClassifier &classifier,
+                                        const QString &line) {
+  return LogLineClassifier::extract(classifier.classify(line, SEARCH_START),
+                                    line);
+}
+
+} // namespace
+
+class TestLogLineClassifier : public QObject {
+  Q_OBJECT
+
+private slots:
+  void parity_data();
+  void parity();
+  void keywordsFollowMarker();
+  void benchmark();
+
+private:
+  LogLineClassifier m_classifier;
+};
+
+void TestLogLineClassifier::parity_data() {
+  QTest::addColumn<QString>("line");
+  QTest::addColumn<int>("expected");
+  QTest::addColumn<QString>("capture");
+
+  // capture is the first group of the extractor regex, as the handler in
+  // ChatLogWorker reads it
+  const QString ts = "[ 2024.01.15 12:34:56 ] ";
+  auto row = [&ts](const char *name, const QString &text, LogLineKind kind,
+                   const QString &capture = QString()) {
+    QTest::newRow(name) << ts + text << static_cast<int>(kind) << capture;
+  };
+
+  row("system change", "EVE System > Channel changed to Local : Jita",
+      LogLineKind::SystemChange, "2024.01.15 12:34:56");
+  row("fleet invite",
+      "(question) <a href=\"showinfo:1375//90000001\">Fleet Boss</a> wants "
+      "you to join their fleet, do you accept?",
+      LogLineKind::FleetInvite, "Fleet Boss");
+  row("follow warp", "(notify) Following Fleet Boss in warp",
+      LogLineKind::FollowWarp, "Fleet Boss");
+  row("regroup", "(notify) Regrouping to Fleet Boss.", LogLineKind::Regroup,
+      "Fleet Boss");
+  row("compression",
+      "(notify) Successfully compressed Veldspar into 100 Compressed "
+      "Veldspar.",
+      LogLineKind::Compression, "Veldspar");
+  row("decloak",
+      "(notify) Your cloak deactivates due to proximity to a nearby "
+      "Stargate.",
+      LogLineKind::Decloak, "Stargate");
+  row("crystal broke",
+      "(notify) Modulated Strip Miner II deactivates due to the destruction "
+      "of the Veldspar Mining Crystal I it was fitted with.",
+      LogLineKind::CrystalBroke, "Modulated Strip Miner II");
+  row("asteroid depleted",
+      "(notify) Miner II deactivates as it finds the resource it was "
+      "harvesting a pale shadow of its former glory.",
+      LogLineKind::AsteroidDepleted, "Miner II");
+  row("conduit jump",
+      "(notify) A Conduit Field activated by Fleet Boss jumps you to Amarr",
+      LogLineKind::ConduitJump, "2024.01.15 12:34:56");
+  row("mining", "(mining) You mined 1,234 units of Veldspar",
+      LogLineKind::Mining);
+  row("jump", "(None) Jumping from Jita to Perimeter", LogLineKind::Jump,
+      "2024.01.15 12:34:56");
+  row("convo request",
+      "(None) <a href=showinfo:1375//90000001>Some Pilot</a> is inviting you "
+      "to a conversation.",
+      LogLineKind::ConvoRequest, "2024.01.15 12:34:56");
+
+  row("combat", "(combat) 120 from Pirate - Hits", LogLineKind::Unrecognized);
+  row("other notify", "(notify) Your shields are recharging.",
+      LogLineKind::Unrecognized);
+  row("undock", "(None) Undocking from Jita IV - Moon 4 to Jita solar system.",
+      LogLineKind::Unrecognized);
+  row("chat text", "Some Pilot > o7, following in warp",
+      LogLineKind::Unrecognized);
+  row("marker in chat text", "Some Pilot > (notify) Regrouping to nowhere",
+      LogLineKind::Unrecognized);
+
+  // A candidate whose regex fails hands the line on to the next one
+  row("follow warp falls through to regroup",
+      "(notify) Regrouping to Following Squad.", LogLineKind::Regroup,
+      "Following Squad");
+  row("jump falls through to convo request",
+      "(None) <a href=showinfo:1375//90000001>Jumping Jack</a> is inviting "
+      "you to a conversation.",
+      LogLineKind::ConvoRequest, "2024.01.15 12:34:56");
+
+  // Keywords only count after the marker, not anywhere past SEARCH_START;
+  // keywordsFollowMarker checks the candidates themselves
+  row("keyword before marker", "Following > (notify) Regrouping to Boss.",
+      LogLineKind::Unrecognized);
+  row("keyword only before marker", "Jumping Jack > (None) Undocking",
+      LogLineKind::Unrecognized);
+  row("upper case marker", "(NOTIFY) following fleet boss in warp",
+      LogLineKind::Unrecognized);
+  QTest::newRow("marker before search start")
+      << QString("(notify) Following Fleet Boss in warp")
+      << static_cast<int>(LogLineKind::Unrecognized) << QString();
+}
+
+void TestLogLineClassifier::parity() {
+  QFETCH(QString, line);
+  QFETCH(int, expected);
+  QFETCH(QString, capture);
+
+  QCOMPARE(static_cast<int>(referenceKind(line)), expected);
+
+  const LogLineClassifier::Extraction extraction =
+      extracted(m_classifier, line);
+  QCOMPARE(static_cast<int>(extraction.kind), expected);
+  QCOMPARE(extraction.match.captured(1).trimmed(), capture);
+}
+
+void TestLogLineClassifier::keywordsFollowMarker() {
+  const QString ts = "[ 2024.01.15 12:34:56 ] ";
+
+  LogLineClassifier::Kinds kinds = m_classifier.classify(
+      ts + "Following > (notify) Regrouping to Boss.", SEARCH_START);
+  QCOMPARE(kinds.size(), 1);
+  QCOMPARE(static_cast<int>(kinds[0]), static_cast<int>(LogLineKind::Regroup));
+
+  kinds = m_classifier.classify(ts + "(notify) Regrouping to Following Squad.",
+                                SEARCH_START);
+  QCOMPARE(kinds.size(), 2);
+  QCOMPARE(static_cast<int>(kinds[0]),
+           static_cast<int>(LogLineKind::FollowWarp));
+  QCOMPARE(static_cast<int>(kinds[1]), static_cast<int>(LogLineKind::Regroup));
+
+  QVERIFY(m_classifier.classify(ts + "Jumping Jack > (None) Undocking",
+                                SEARCH_START)
+              .isEmpty());
+}
+
+void TestLogLineClassifier::benchmark() {
+  // Mostly lines without an event, as in a busy game log
+  QStringList lines;
+  const QString ts = "[ 2024.01.15 12:34:56 ] ";
+  for (int i = 0; i < 1000; ++i) {
+    if (i % 100 == 0) {
+      lines.append(ts + "(notify) Following Fleet Boss in warp");
+    } else if (i % 10 == 0) {
+      lines.append(ts + "(mining) You mined 1,234 units of Veldspar");
+    } else {
+      lines.append(ts + QString("(combat) %1 from Pirate - Hits").arg(i));
+    }
+  }
+
+  // Each iteration classifies 1000 lines
+  int recognized = 0;
+  QBENCHMARK {
+    recognized = 0;
+    for (const QString &line : std::as_const(lines)) {
+      if (!m_classifier.classify(line, SEARCH_START).isEmpty()) {
+        ++recognized;
+      }
+    }
+  }
+  QCOMPARE(recognized, 100);
+}
+
+QTEST_APPLESS_MAIN(TestLogLineClassifier)
+#include "tst_loglineclassifier.moc"
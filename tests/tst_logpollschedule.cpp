@@ -0,0 +1,122 @@
+#include "logpollschedule.h"
+#include <QTest>
+
+namespace {
+
+constexpr int FILE_COUNT = 80;
+constexpr int ACTIVE_FILE_COUNT = 5;
+constexpr int TICKS_PER_MINUTE = 60000 / LogPollSchedule::TICK_MS;
+
+// The worker this replaced polled every file every 500 ms while any file
+// had activity
+constexpr int OLD_STAT_CALLS_PER_MINUTE = FILE_COUNT * TICKS_PER_MINUTE;
+
+/// Size queries in one minute of ChatLogWorker's poll loop: every check of
+/// a due file is one stat call, active files grow on every check
+int statCallsPerMinute(bool idleFilesLive) {
+  struct File {
+    int nextTick = 1;
+    int idlePolls = 0;
+    bool active = false;
+  };
+
+  QVector<File> files(FILE_COUNT);
+  for (int i = 0; i < ACTIVE_FILE_COUNT; ++i) {
+    files[i].active = true;
+  }
+
+  int statCalls = 0;
+  for (int tick = 1; tick <= TICKS_PER_MINUTE; ++tick) {
+    for (File &file : files) {
+      if (file.nextTick != tick) {
+        continue;
+      }
+
+      ++statCalls;
+      file.idlePolls = file.active ? 0 : file.idlePolls + 1;
+      const int intervalMs = LogPollSchedule::intervalMs(
+          file.idlePolls, file.active || idleFilesLive, false);
+      file.nextTick = tick + qMax(1, intervalMs / LogPollSchedule::TICK_MS);
+    }
+  }
+  return statCalls;
+}
+
+} // namespace
+
+class TestLogPollSchedule : public QObject {
+  Q_OBJECT
+
+private slots:
+  void activeFileStaysOnEveryTick();
+  void liveFileBacksOffToOneSecond();
+  void dormantFileDecays();
+  void notifiedFileFallsBack();
+  void recentWriteIsLive();
+  void statCallsPerMinute_data();
+  void statCallsPerMinute();
+};
+
+void TestLogPollSchedule::activeFileStaysOnEveryTick() {
+  QCOMPARE(LogPollSchedule::intervalMs(0, true, false), 500);
+  QCOMPARE(LogPollSchedule::intervalMs(0, false, false), 500);
+}
+
+void TestLogPollSchedule::liveFileBacksOffToOneSecond() {
+  QCOMPARE(LogPollSchedule::intervalMs(3, true, false), 500);
+  QCOMPARE(LogPollSchedule::intervalMs(4, true, false), 1000);
+  QCOMPARE(LogPollSchedule::intervalMs(1000, true, false), 1000);
+}
+
+void TestLogPollSchedule::dormantFileDecays() {
+  QCOMPARE(LogPollSchedule::intervalMs(4, false, false), 1000);
+  QCOMPARE(LogPollSchedule::intervalMs(8, false, false), 2000);
+  QCOMPARE(LogPollSchedule::intervalMs(12, false, false), 4000);
+  QCOMPARE(LogPollSchedule::intervalMs(16, false, false), 8000);
+  QCOMPARE(LogPollSchedule::intervalMs(1000, false, false), 8000);
+}
+
+void TestLogPollSchedule::notifiedFileFallsBack() {
+  QCOMPARE(LogPollSchedule::intervalMs(0, true, true),
+           LogPollSchedule::NOTIFIED_FALLBACK_MS);
+  QCOMPARE(LogPollSchedule::intervalMs(1000, false, true), 8000);
+}
+
+void TestLogPollSchedule::recentWriteIsLive() {
+  const qint64 now = 1000000000;
+  QVERIFY(LogPollSchedule::isLive(true, 0, now));
+  QVERIFY(LogPollSchedule::isLive(false, now - 1000, now));
+  QVERIFY(!LogPollSchedule::isLive(
+      false, now - LogPollSchedule::RECENT_WRITE_MS, now));
+}
+
+void TestLogPollSchedule::statCallsPerMinute_data() {
+  QTest::addColumn<bool>("idleFilesLive");
+  QTest::addColumn<int>("maxStatCalls");
+
+  // Idle logs of running clients are still checked once a second, after
+  // a few checks on every tick
+  QTest::newRow("75 quiet logged-in characters")
+      << true
+      << ACTIVE_FILE_COUNT * TICKS_PER_MINUTE +
+             (FILE_COUNT - ACTIVE_FILE_COUNT) *
+                 (LogPollSchedule::IDLE_POLLS_PER_LEVEL + 60);
+  QTest::newRow("75 logged-out characters")
+      << false << OLD_STAT_CALLS_PER_MINUTE / 4;
+}
+
+void TestLogPollSchedule::statCallsPerMinute() {
+  QFETCH(bool, idleFilesLive);
+  QFETCH(int, maxStatCalls);
+
+  const int statCalls = ::statCallsPerMinute(idleFilesLive);
+  qDebug() << FILE_COUNT << "files," << ACTIVE_FILE_COUNT
+           << "active:" << statCalls << "stat calls per minute, was"
+           << OLD_STAT_CALLS_PER_MINUTE;
+
+  QVERIFY(statCalls <= maxStatCalls);
+  QTest::setBenchmarkResult(statCalls, QTest::Events);
+}
+
+QTEST_APPLESS_MAIN(TestLogPollSchedule)
+#include "tst_logpollschedule.moc"
@@ -0,0 +1,259 @@
+#include "benchmarkcounters.h"
+#include "logprefilter.h"
+#include <QElapsedTimer>
+#include <QStringDecoder>
+#include <QStringEncoder>
+#include <QTest>
+
+namespace {
+
+// Non-ASCII text on purpose: U+010A and U+0A05 hold a 0x0A byte in UTF-16,
+// and U+1F680 is a surrogate pair
+const char16_t *const GAME_LOG_LINES[] = {
+    u"------------------------------------------------------------",
+    u"  Gamelog",
+    u"  Listener: Some Pilot",
+    u"[ 2024.01.15 12:34:56 ] (notify) Following Fleet Boss in warp",
+    u"[ 2024.01.15 12:34:57 ] (combat) 120 from Pirate \u2013 Hits",
+    u"[ 2024.01.15 12:34:58 ] (None) Jumping from Jita to \u03A9mega",
+    u"[ 2024.01.15 12:34:59 ] (mining) You mined 1234 units \U0001F680",
+    u"[ 2024.01.15 12:35:00 ] (notify) \u010A \u0A05 Regrouping to Boss.",
+};
+constexpr int GAME_LOG_CANDIDATES = 4;
+
+const char16_t *const CHAT_LOG_LINES[] = {
+    u"---------------------------------------------------------------",
+    u"  Channel Name:    Local",
+    u"  Listener:        Some Pilot",
+    u"[ 2024.01.15 12:34:56 ] EVE System > Channel changed to Local : Jita",
+    u"[ 2024.01.15 12:34:57 ] Some Pilot > \u010A \u0A05 o7 \U0001F680",
+    u"[ 2024.01.15 12:34:58 ] EVE System > Channel changed to Local : "
+    u"\u03A9mega",
+};
+constexpr int CHAT_LOG_CANDIDATES = 2;
+
+QStringList sourceLines(bool isChatLog) {
+  QStringList lines;
+  if (isChatLog) {
+    for (const char16_t *line : CHAT_LOG_LINES) {
+      lines.append(QString::fromUtf16(line));
+    }
+  } else {
+    for (const char16_t *line : GAME_LOG_LINES) {
+      lines.append(QString::fromUtf16(line));
+    }
+  }
+  return lines;
+}
+
+/// File contents as EVE writes them: UTF-16LE chat logs, UTF-8 game logs
+QByteArray encode(const QStringList &lines, bool isChatLog) {
+  const QString text = lines.join("\r\n") + "\r\n";
+  if (isChatLog) {
+    QStringEncoder encoder(QStringEncoder::Utf16LE);
+    return encoder.encode(text);
+  }
+  return text.toUtf8();
+}
+
+/// Appends data in chunks of chunkSize bytes and returns the lines handed
+/// out, following ChatLogWorker::readNewLines: undecoded bytes stay in the
+/// buffer, the searched part of the tail is not searched again and chat
+/// log lines are decoded with one decoder per file.
+QStringList feed(const QByteArray &data, bool isChatLog, qsizetype chunkSize,
+                 bool allLines) {
+  QByteArray buffer;
+  qsizetype searchedBytes = 0;
+  QStringDecoder decoder(QStringDecoder::Utf16LE);
+  QVector<LogPrefilter::LineRange> ranges;
+  QStringList lines;
+
+  for (qsizetype pos = 0; pos < data.size(); pos += chunkSize) {
+    buffer.append(data.mid(pos, chunkSize));
+
+    ranges.clear();
+    const LogPrefilter::ScanResult result =
+        allLines ? LogPrefilter::splitLines(buffer, isChatLog, ranges,
+                                            searchedBytes)
+                 : LogPrefilter::scan(buffer, isChatLog, ranges, searchedBytes);
+
+    for (const LogPrefilter::LineRange &range : std::as_const(ranges)) {
+      QByteArrayView lineData(buffer.constData() + range.start, range.length);
+      QString line;
+      if (isChatLog) {
+        line = decoder.decode(lineData);
+      } else {
+        line = QString::fromUtf8(lineData);
+      }
+      if (line.endsWith('\r')) {
+        line.chop(1);
+      }
+      lines.append(line);
+    }
+
+    buffer.remove(0, result.consumed);
+    searchedBytes = LogPrefilter::searchedTail(buffer.size(), isChatLog);
+  }
+
+  return lines;
+}
+
+/// The reading before the prefilter: every chunk is decoded, split into
+/// lines and only then filtered for the chat log marker
+QStringList feedDecodingAll(const QByteArray &data, qsizetype chunkSize) {
+  QStringDecoder decoder(QStringDecoder::Utf16LE);
+  QString pending;
+  QStringList lines;
+
+  for (qsizetype pos = 0; pos < data.size(); pos += chunkSize) {
+    pending += decoder.decode(data.mid(pos, chunkSize));
+
+    QStringList chunkLines = pending.split('\n');
+    pending = chunkLines.takeLast();
+    for (QString &line : chunkLines) {
+      if (line.contains("EVE System", Qt::CaseInsensitive)) {
+        if (line.endsWith('\r')) {
+          line.chop(1);
+        }
+        lines.append(line);
+      }
+    }
+  }
+
+  return lines;
+}
+
+} // namespace
+
+class TestLogPrefilter : public QObject {
+  Q_OBJECT
+
+private slots:
+  void partialReads_data();
+  void partialReads();
+  void incompleteLineIsKept();
+  void appendBenchmark();
+  void localChatBenchmark_data();
+  void localChatBenchmark();
+};
+
+void TestLogPrefilter::partialReads_data() {
+  QTest::addColumn<bool>("isChatLog");
+  QTest::addColumn<int>("chunkSize");
+
+  for (int chunkSize : {1, 2, 3, 7, 64, 4096}) {
+    QTest::addRow("game log, %d byte reads", chunkSize) << false << chunkSize;
+    QTest::addRow("chat log, %d byte reads", chunkSize) << true << chunkSize;
+  }
+}
+
+void TestLogPrefilter::partialReads() {
+  QFETCH(bool, isChatLog);
+  QFETCH(int, chunkSize);
+
+  const QStringList lines = sourceLines(isChatLog);
+  const QByteArray data = encode(lines, isChatLog);
+
+  QCOMPARE(feed(data, isChatLog, chunkSize, true), lines);
+
+  // The same candidates as one scan over the whole file
+  const QStringList candidates = feed(data, isChatLog, chunkSize, false);
+  QCOMPARE(candidates, feed(data, isChatLog, data.size(), false));
+  QCOMPARE(candidates.size(),
+           isChatLog ? CHAT_LOG_CANDIDATES : GAME_LOG_CANDIDATES);
+}
+
+void TestLogPrefilter::incompleteLineIsKept() {
+  QVector<LogPrefilter::LineRange> ranges;
+  const QByteArray data = "[ 2024.01.15 12:34:56 ] (notify) Following\n"
+                          "[ 2024.01.15 12:34:57 ] (notify) Regrou";
+
+  const LogPrefilter::ScanResult result =
+      LogPrefilter::scan(data, false, ranges);
+
+  QCOMPARE(result.linesScanned, 1);
+  QCOMPARE(result.consumed, data.indexOf('\n') + 1);
+  QCOMPARE(ranges.size(), 1);
+}
+
+void TestLogPrefilter::appendBenchmark() {
+  // A busy game log: many short appends, few lines with an event
+  QStringList lines;
+  for (int i = 0; i < 2000; ++i) {
+    lines.append(i % 50 == 0
+                     ? QString("[ 2024.01.15 12:34:56 ] (notify) Following "
+                               "Fleet Boss in warp")
+                     : QString("[ 2024.01.15 12:34:56 ] (combat) %1 from "
+                               "Pirate - Hits")
+                           .arg(i));
+  }
+  const QByteArray data = encode(lines, false);
+
+  int candidates = 0;
+  QBENCHMARK {
+    candidates = feed(data, false, 100, false).size();
+  }
+  QCOMPARE(candidates, 40);
+}
+
+void TestLogPrefilter::localChatBenchmark_data() {
+  QTest::addColumn<bool>("prefiltered");
+  QTest::newRow("prefilter") << true;
+  QTest::newRow("decode all") << false;
+}
+
+void TestLogPrefilter::localChatBenchmark() {
+  // A busy Local channel of several MB, read in 64 KB chunks: chatter in
+  // many scripts, a system change every 200 lines
+  QFETCH(bool, prefiltered);
+
+  constexpr int LINE_COUNT = 40000;
+  constexpr qsizetype CHUNK_SIZE = 64 * 1024;
+
+  QStringList lines;
+  for (int i = 0; i < LINE_COUNT; ++i) {
+    lines.append(i % 200 == 0
+                     ? QString("[ 2024.01.15 12:34:56 ] EVE System > Channel "
+                               "changed to Local : System%1")
+                           .arg(i)
+                     : QString::fromUtf16(
+                           u"[ 2024.01.15 12:34:56 ] Pilot %1 > o7 "
+                           u"\u041F\u0440\u0438\u0432\u0435\u0442 anyone "
+                           u"selling %2 units of Tritanium?")
+                           .arg(i % 300)
+                           .arg(i));
+  }
+  const QByteArray data = encode(lines, true);
+  const auto read = [&] {
+    return prefiltered ? feed(data, true, CHUNK_SIZE, false)
+                       : feedDecodingAll(data, CHUNK_SIZE);
+  };
+
+  int candidates = 0;
+  QBENCHMARK {
+    candidates = read().size();
+  }
+  QCOMPARE(candidates, LINE_COUNT / 200);
+
+  // One more read for throughput and allocations
+  QElapsedTimer timer;
+  const qint64 allocationsBefore = BenchmarkCounters::allocations();
+  timer.start();
+  QCOMPARE(read().size(), candidates);
+  const qint64 elapsedNs = qMax<qint64>(1, timer.nsecsElapsed());
+  const qint64 allocations =
+      BenchmarkCounters::allocations() - allocationsBefore;
+
+  qInfo().noquote()
+      << QString("%1: %2 MB in %3 ms, %4 MB/s, %5 allocations")
+             .arg(prefiltered ? "prefilter" : "decode all")
+             .arg(data.size() / (1024.0 * 1024.0), 0, 'f', 1)
+             .arg(elapsedNs / 1e6, 0, 'f', 1)
+             .arg(data.size() * 1e9 / elapsedNs / (1024.0 * 1024.0), 0, 'f',
+                  0)
+             .arg(allocationsBefore < 0 ? QString("n/a")
+                                        : QString::number(allocations));
+}
+
+QTEST_APPLESS_MAIN(TestLogPrefilter)
+#include "tst_logprefilter.moc"
@@ -0,0 +1,223 @@
+#include "settingsmap.h"
+#include <QPoint>
+#include <QRect>
+#include <QSettings>
+#include <QSize>
+#include <QTemporaryDir>
+#include <QTest>
+#include <iterator>
+
+namespace {
+
+constexpr int GLOBAL_SETTING_COUNT = 300;
+constexpr int CHARACTER_COUNT = 100;
+
+const char *const CHARACTER_GROUPS[] = {
+    "thumbnailPositions",
+    "clientWindowRects",
+    "characterBorderColors",
+    "characterInactiveBorderColors",
+    "thumbnailSizes",
+    "customNames",
+};
+
+QString globalKey(int i) {
+  static const char *const groups[] = {"ui", "thumbnail", "hotkeys",
+                                       "combatMessages", "logMonitoring"};
+  return QString("%1/setting%2").arg(groups[i % 5]).arg(i);
+}
+
+/// A profile with about as many settings as Config has, and every
+/// per-character group filled in
+void writeProfile(const QString &fileName) {
+  QSettings settings(fileName, QSettings::IniFormat);
+  for (int i = 0; i < GLOBAL_SETTING_COUNT; ++i) {
+    switch (i % 3) {
+    case 0:
+      settings.setValue(globalKey(i), i % 2 == 0);
+      break;
+    case 1:
+      settings.setValue(globalKey(i), i * 3);
+      break;
+    default:
+      settings.setValue(globalKey(i),
+                        QString("#%1").arg(i * 4000, 6, 16, QChar('0')));
+      break;
+    }
+  }
+  for (int i = 0; i < CHARACTER_COUNT; ++i) {
+    const QString name = QString("Pilot %1").arg(i);
+    settings.setValue("thumbnailPositions/" + name, QPoint(i * 10, i * 5));
+    settings.setValue("clientWindowRects/" + name, QRect(0, 0, 1920, 1080));
+    settings.setValue("characterBorderColors/" + name, "#ff8800");
+    settings.setValue("characterInactiveBorderColors/" + name, "#884400");
+    settings.setValue("thumbnailSizes/" + name, QSize(280, 180));
+    settings.setValue("customNames/" + name, QString("Alt %1").arg(i));
+  }
+  settings.sync();
+}
+
+/// Reads what a profile load reads and returns how many values were found
+template <typename Settings> int loadProfile(Settings &settings) {
+  int found = 0;
+  for (int i = 0; i < GLOBAL_SETTING_COUNT; ++i) {
+    if (settings.value(globalKey(i), QVariant()).isValid()) {
+      ++found;
+    }
+  }
+  for (const char *group : CHARACTER_GROUPS) {
+    for (const QString &name : settings.childKeys(group)) {
+      if (settings.value(QString(group) + '/' + name, QVariant()).isValid()) {
+        ++found;
+      }
+    }
+  }
+  return found;
+}
+
+/// QSettings as the loader used it before: one lookup per key
+class PerKeySettings {
+public:
+  explicit PerKeySettings(const QString &fileName)
+      : m_settings(fileName, QSettings::IniFormat) {}
+
+  QVariant value(const QString &key, const QVariant &defaultValue) {
+    return m_settings.value(key, defaultValue);
+  }
+
+  QStringList childKeys(const QString &group) {
+    m_settings.beginGroup(group);
+    const QStringList keys = m_settings.childKeys();
+    m_settings.endGroup();
+    return keys;
+  }
+
+private:
+  QSettings m_settings;
+};
+
+} // namespace
+
+class TestSettingsMap : public QObject {
+  Q_OBJECT
+
+private slots:
+  void initTestCase();
+  void valuesMatchQSettings();
+  void childKeysAreDirectChildren();
+  void changedKeys();
+  void changedKeysAgainstFile();
+  void profileLoad_data();
+  void profileLoad();
+
+private:
+  QTemporaryDir m_dir;
+  QString m_profile;
+};
+
+void TestSettingsMap::initTestCase() {
+  QVERIFY(m_dir.isValid());
+  m_profile = m_dir.filePath("profile.ini");
+  writeProfile(m_profile);
+}
+
+void TestSettingsMap::valuesMatchQSettings() {
+  const SettingsMap map = SettingsMap::read(m_profile);
+  QSettings settings(m_profile, QSettings::IniFormat);
+
+  for (const QString &key : settings.allKeys()) {
+    QCOMPARE(map.value(key), settings.value(key));
+  }
+  QCOMPARE(map.value("ui/missing", 42).toInt(), 42);
+  QVERIFY(!map.contains("ui/missing"));
+}
+
+void TestSettingsMap::childKeysAreDirectChildren() {
+  SettingsMap map;
+  map.setValue("group/a", 1);
+  map.setValue("group/b", 2);
+  map.setValue("group/sub/c", 3);
+  map.setValue("other/d", 4);
+
+  QStringList children = map.childKeys("group");
+  children.sort();
+  QCOMPARE(children, QStringList({"a", "b"}));
+
+  map.remove("group");
+  QVERIFY(map.childKeys("group").isEmpty());
+  QVERIFY(!map.contains("group/sub/c"));
+  QCOMPARE(map.value("other/d").toInt(), 4);
+}
+
+void TestSettingsMap::changedKeys() {
+  SettingsMap from;
+  from.setValue("ui/a", 1);
+  from.setValue("ui/b", 2);
+  SettingsMap to = from;
+  to.setValue("ui/b", 3);
+  to.setValue("ui/c", 4);
+  to.remove("ui/a");
+
+  QStringList changed = SettingsMap::changedKeys(from, to);
+  changed.sort();
+  QCOMPARE(changed, QStringList({"ui/a", "ui/b", "ui/c"}));
+}
+
+void TestSettingsMap::changedKeysAgainstFile() {
+  // Values set in memory against the same values read back from the file,
+  // as when comparing the current profile with its own file
+  SettingsMap memory;
+  memory.setValue("ui/flag", true);
+  memory.setValue("ui/count", 7);
+  memory.setValue("ui/list", QStringList({"a", "b"}));
+  memory.setValue("hotkeys/group", QString("Pilot 1,Pilot 2|F1|F2|0|0"));
+  memory.setValue("ui/position", QPoint(3, 4));
+
+  const QString fileName = m_dir.filePath("memory.ini");
+  {
+    QSettings settings(fileName, QSettings::IniFormat);
+    settings.setValue("ui/flag", true);
+    settings.setValue("ui/count", 7);
+    settings.setValue("ui/list", QStringList({"a", "b"}));
+    settings.setValue("hotkeys/group", "Pilot 1,Pilot 2|F1|F2|0|0");
+    settings.setValue("ui/position", QPoint(3, 4));
+  }
+  SettingsMap file = SettingsMap::read(fileName);
+  QVERIFY(SettingsMap::changedKeys(memory, file).isEmpty());
+
+  file.setValue("ui/count", "8");
+  file.setValue("ui/position", QString("3,4"));
+  QStringList changed = SettingsMap::changedKeys(memory, file);
+  changed.sort();
+  QCOMPARE(changed, QStringList({"ui/count", "ui/position"}));
+}
+
+void TestSettingsMap::profileLoad_data() {
+  QTest::addColumn<bool>("bulk");
+  QTest::newRow("SettingsMap") << true;
+  QTest::newRow("QSettings per key") << false;
+}
+
+void TestSettingsMap::profileLoad() {
+  // Loading a fully populated profile: 300 settings and six groups of 100
+  // characters, read in one pass into a SettingsMap or key by key from
+  // QSettings
+  QFETCH(bool, bulk);
+
+  int found = 0;
+  QBENCHMARK {
+    if (bulk) {
+      const SettingsMap map = SettingsMap::read(m_profile);
+      found = loadProfile(map);
+    } else {
+      PerKeySettings settings(m_profile);
+      found = loadProfile(settings);
+    }
+  }
+
+  QCOMPARE(found, GLOBAL_SETTING_COUNT +
+                      CHARACTER_COUNT * int(std::size(CHARACTER_GROUPS)));
+}
+
+QTEST_APPLESS_MAIN(TestSettingsMap)
+#include "tst_settingsmap.moc"
@@ -0,0 +1,167 @@
+#include "settingswriter.h"
+#include <QPoint>
+#include <QRect>
+#include <QSettings>
+#include <QSize>
+#include <QTemporaryDir>
+#include <QTest>
+
+namespace {
+
+constexpr int GROUP_SIZE = 40;
+constexpr int DRAG_STEPS = 60; // Mouse moves of one drag
+
+QString positionKey(int i) {
+  return QString("thumbnailPositions/Pilot %1").arg(i);
+}
+
+/// A profile as Config writes it, so that rewriting it has a real cost
+void populateProfile(const QString &fileName) {
+  QSettings settings(fileName, QSettings::IniFormat);
+  for (int i = 0; i < GROUP_SIZE; ++i) {
+    const QString name = QString("Pilot %1").arg(i);
+    settings.setValue(positionKey(i), QPoint(i * 10, i * 5));
+    settings.setValue(QString("clientWindowRects/%1").arg(name),
+                      QRect(0, 0, 1920, 1080));
+    settings.setValue(QString("characterBorderColors/%1").arg(name),
+                      QString("#%1").arg(i * 4000, 6, 16, QChar('0')));
+    settings.setValue(QString("thumbnailSizes/%1").arg(name), QSize(280, 180));
+    settings.setValue(QString("customNames/%1").arg(name),
+                      QString("Alt %1").arg(i));
+  }
+  for (int i = 0; i < 200; ++i) {
+    settings.setValue(QString("general/option%1").arg(i), i);
+  }
+  settings.sync();
+}
+
+} // namespace
+
+class TestSettingsWriter : public QObject {
+  Q_OBJECT
+
+private slots:
+  void coalescesToLastValue();
+  void removeDropsPendingValuesBelow();
+  void setFileNameKeepsPendingChanges();
+  void groupDragBurst_data();
+  void groupDragBurst();
+};
+
+void TestSettingsWriter::coalescesToLastValue() {
+  QTemporaryDir dir;
+  QVERIFY(dir.isValid());
+  const QString fileName = dir.filePath("profile.ini");
+
+  {
+    SettingsWriter writer(fileName);
+    for (int x = 0; x < 100; ++x) {
+      writer.setValue(positionKey(0), QPoint(x, 0));
+    }
+    QVERIFY(writer.hasPendingChanges());
+    writer.flushAndWait();
+    QVERIFY(!writer.hasPendingChanges());
+  }
+
+  QSettings settings(fileName, QSettings::IniFormat);
+  QCOMPARE(settings.value(positionKey(0)).toPoint(), QPoint(99, 0));
+}
+
+void TestSettingsWriter::removeDropsPendingValuesBelow() {
+  QTemporaryDir dir;
+  QVERIFY(dir.isValid());
+  const QString fileName = dir.filePath("profile.ini");
+  populateProfile(fileName);
+
+  {
+    SettingsWriter writer(fileName);
+    writer.setValue(positionKey(1), QPoint(1, 1));
+    writer.remove("thumbnailPositions");
+    writer.setValue(positionKey(2), QPoint(2, 2));
+  }
+
+  QSettings settings(fileName, QSettings::IniFormat);
+  settings.beginGroup("thumbnailPositions");
+  QCOMPARE(settings.childKeys(), QStringList{"Pilot 2"});
+  settings.endGroup();
+  QCOMPARE(settings.value("customNames/Pilot 1").toString(), QString("Alt 1"));
+}
+
+void TestSettingsWriter::setFileNameKeepsPendingChanges() {
+  QTemporaryDir dir;
+  QVERIFY(dir.isValid());
+  const QString first = dir.filePath("first.ini");
+  const QString second = dir.filePath("second.ini");
+
+  bool ranAfterWrites = false;
+  {
+    SettingsWriter writer(first);
+    writer.setValue(positionKey(0), QPoint(1, 1));
+    writer.setFileName(second);
+    QVERIFY(!writer.hasPendingChanges());
+    writer.setValue(positionKey(0), QPoint(2, 2));
+    writer.flush();
+
+    // Runs after both writes, so it sees both files complete
+    writer.afterWrites([&]() {
+      const QSettings firstSettings(first, QSettings::IniFormat);
+      const QSettings secondSettings(second, QSettings::IniFormat);
+      ranAfterWrites =
+          firstSettings.value(positionKey(0)).toPoint() == QPoint(1, 1) &&
+          secondSettings.value(positionKey(0)).toPoint() == QPoint(2, 2);
+    });
+  }
+
+  QVERIFY(ranAfterWrites);
+}
+
+void TestSettingsWriter::groupDragBurst_data() {
+  QTest::addColumn<bool>("writeBehind");
+  QTest::newRow("write-behind") << true;
+  QTest::newRow("QSettings") << false;
+}
+
+void TestSettingsWriter::groupDragBurst() {
+  // GUI thread time of dragging a group of 40 thumbnails: every mouse move
+  // stores the position of every thumbnail and the drop saves the profile.
+  // The write-behind row only hands the changes to its writer thread.
+  QFETCH(bool, writeBehind);
+
+  QTemporaryDir dir;
+  QVERIFY(dir.isValid());
+  const QString fileName = dir.filePath("profile.ini");
+  populateProfile(fileName);
+
+  SettingsWriter writer(fileName);
+  QSettings settings(fileName, QSettings::IniFormat);
+
+  int drag = 0;
+  QBENCHMARK {
+    for (int step = 0; step < DRAG_STEPS; ++step) {
+      for (int i = 0; i < GROUP_SIZE; ++i) {
+        const QPoint position(drag * 7 + step, i * 5);
+        if (writeBehind) {
+          writer.setValue(positionKey(i), position);
+        } else {
+          settings.setValue(positionKey(i), position);
+        }
+      }
+    }
+    if (writeBehind) {
+      writer.flush();
+    } else {
+      settings.sync();
+    }
+    ++drag;
+  }
+
+  writer.flushAndWait();
+  settings.sync();
+
+  QSettings reread(fileName, QSettings::IniFormat);
+  QCOMPARE(reread.value(positionKey(GROUP_SIZE - 1)).toPoint(),
+           QPoint((drag - 1) * 7 + DRAG_STEPS - 1, (GROUP_SIZE - 1) * 5));
+}
+
+QTEST_GUILESS_MAIN(TestSettingsWriter)
+#include "tst_settingswriter.moc"
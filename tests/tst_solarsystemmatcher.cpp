@@ -0,0 +1,93 @@
+#include "solarsystemmatcher.h"
+#include <QTest>
+
+namespace {
+
+/// About as many names as the static data export has, in the shapes EVE
+/// uses: plain words, null-sec codes such as "1DQ1-A" and J-space numbers
+QStringList dictionary() {
+  QStringList names = {"Jita", "Perimeter", "Hek", "Amarr", "Tama"};
+  for (int i = 0; i < 3000; ++i) {
+    names.append(QString("System%1").arg(i));
+  }
+  for (int i = 0; i < 2500; ++i) {
+    names.append(QString("%1Q%2-%3")
+                     .arg(i % 10)
+                     .arg(i, 2, 36, QChar('0'))
+                     .arg(QChar('A' + i % 26)));
+  }
+  for (int i = 0; i < 2500; ++i) {
+    names.append(QString("J%1").arg(100000 + i));
+  }
+  return names;
+}
+
+QStringList found(const SolarSystemMatcher &matcher, const QString &text) {
+  QVector<SolarSystemMatcher::Match> matches;
+  matcher.findAll(text, matches);
+
+  QStringList names;
+  for (const SolarSystemMatcher::Match &match : std::as_const(matches)) {
+    names.append(matcher.systemNames()[match.systemIndex]);
+  }
+  return names;
+}
+
+} // namespace
+
+class TestSolarSystemMatcher : public QObject {
+  Q_OBJECT
+
+private slots:
+  void initTestCase();
+  void wholeWordsOnly();
+  void caseInsensitive();
+  void throughputBenchmark();
+
+private:
+  SolarSystemMatcher m_matcher;
+};
+
+void TestSolarSystemMatcher::initTestCase() {
+  m_matcher.build(dictionary());
+  QCOMPARE(m_matcher.systemNames().size(), 8005);
+}
+
+void TestSolarSystemMatcher::wholeWordsOnly() {
+  QCOMPARE(found(m_matcher, "Hekaton in Hek gate"), QStringList{"Hek"});
+  QCOMPARE(found(m_matcher, "J100001 and J1000012"), QStringList{"J100001"});
+  QCOMPARE(found(m_matcher, "Jita-Perimeter"), QStringList());
+}
+
+void TestSolarSystemMatcher::caseInsensitive() {
+  QCOMPARE(found(m_matcher, "jita nv, tama clr"),
+           (QStringList{"Jita", "Tama"}));
+}
+
+void TestSolarSystemMatcher::throughputBenchmark() {
+  // An intel channel: mostly pilot names and shorthand, about one system
+  // per line
+  QStringList lines;
+  for (int i = 0; i < 1000; ++i) {
+    lines.append(QString("[ 2024.01.15 12:34:%1 ] Scout %2 > System%3  "
+                         "Hostile Pilot %4 Hostile Pilot %5 nv gate")
+                     .arg(i % 60, 2, 10, QChar('0'))
+                     .arg(i)
+                     .arg(i % 3000)
+                     .arg(i * 7)
+                     .arg(i * 11));
+  }
+
+  // Each iteration matches 1000 lines against the full dictionary
+  QVector<SolarSystemMatcher::Match> matches;
+  QBENCHMARK {
+    matches.clear();
+    for (const QString &line : std::as_const(lines)) {
+      m_matcher.findAll(line, matches);
+    }
+  }
+  QCOMPARE(matches.size(), 1000);
+}
+
+QTEST_APPLESS_MAIN(TestSolarSystemMatcher)
+#include "tst_solarsystemmatcher.moc"
@@ -0,0 +1,141 @@
+#include "starmap.h"
+#include <QFile>
+#include <QTemporaryDir>
+#include <QTest>
+
+namespace {
+
+// A square grid of stargates: about as many systems as known space
+constexpr int GRID_SIZE = 75;
+constexpr int CHARACTER_COUNT = 50;
+
+QString systemName(int x, int y) { return QString("S%1-%2").arg(x).arg(y); }
+
+/// Systems of the characters, spread over the grid
+QStringList characterSystems() {
+  QStringList systems;
+  for (int i = 0; i < CHARACTER_COUNT; ++i) {
+    systems.append(systemName((i * 37) % GRID_SIZE, (i * 53) % GRID_SIZE));
+  }
+  return systems;
+}
+
+} // namespace
+
+class TestStarMap : public QObject {
+  Q_OBJECT
+
+private slots:
+  void initTestCase();
+  void gridDistances();
+  void unknownAndUnreachable();
+  void distancesToTargetHonourMaxJumps();
+  void allCharactersToTarget_data();
+  void allCharactersToTarget();
+
+private:
+  QTemporaryDir m_dir;
+  StarMap m_map;
+};
+
+void TestStarMap::initTestCase() {
+  QVERIFY(m_dir.isValid());
+
+  QFile file(m_dir.filePath("stargates.csv"));
+  QVERIFY(file.open(QIODevice::WriteOnly | QIODevice::Text));
+  file.write("# Synthetic grid\n");
+  for (int x = 0; x < GRID_SIZE; ++x) {
+    for (int y = 0; y < GRID_SIZE; ++y) {
+      if (x + 1 < GRID_SIZE) {
+        file.write(QString("%1,%2\n")
+                       .arg(systemName(x, y), systemName(x + 1, y))
+                       .toUtf8());
+      }
+      if (y + 1 < GRID_SIZE) {
+        file.write(QString("%1,%2\n")
+                       .arg(systemName(x, y), systemName(x, y + 1))
+                       .toUtf8());
+      }
+    }
+  }
+  // An island out of reach of the grid
+  file.write("Island A,Island B\n");
+  file.close();
+
+  QVERIFY(m_map.load(file.fileName()));
+  QCOMPARE(m_map.systemCount(), GRID_SIZE * GRID_SIZE + 2);
+}
+
+void TestStarMap::gridDistances() {
+  // Grid distances are Manhattan distances
+  QCOMPARE(m_map.jumpDistance(systemName(0, 0), systemName(0, 0)), 0);
+  QCOMPARE(m_map.jumpDistance(systemName(0, 0), systemName(1, 0)), 1);
+  QCOMPARE(m_map.jumpDistance(systemName(3, 4), systemName(10, 2)), 9);
+  QCOMPARE(m_map.jumpDistance(systemName(0, 0),
+                              systemName(GRID_SIZE - 1, GRID_SIZE - 1)),
+           2 * (GRID_SIZE - 1));
+
+  // Names are case-insensitive and cached pairs are unordered
+  QCOMPARE(m_map.jumpDistance(systemName(10, 2).toLower(), systemName(3, 4)),
+           9);
+}
+
+void TestStarMap::unknownAndUnreachable() {
+  QCOMPARE(m_map.systemIndex("Nowhere"), -1);
+  QCOMPARE(m_map.jumpDistance("Nowhere", systemName(0, 0)), -1);
+  QCOMPARE(m_map.jumpDistance("Island A", systemName(0, 0)), -1);
+  QCOMPARE(m_map.jumpDistance("Island A", "Island B"), 1);
+}
+
+void TestStarMap::distancesToTargetHonourMaxJumps() {
+  const QStringList systems = {systemName(0, 0), systemName(2, 3),
+                               systemName(20, 20), "Nowhere"};
+  QCOMPARE(m_map.jumpDistancesTo(systemName(0, 0), systems, 10),
+           QVector<int>({0, 5, -1, -1}));
+  QCOMPARE(m_map.jumpDistancesTo(systemName(0, 0), systems, 40),
+           QVector<int>({0, 5, 40, -1}));
+}
+
+void TestStarMap::allCharactersToTarget_data() {
+  QTest::addColumn<QString>("mode");
+  QTest::newRow("cached pairs") << "cached";
+  QTest::newRow("uncached pairs") << "uncached";
+  QTest::newRow("one target search") << "target";
+}
+
+void TestStarMap::allCharactersToTarget() {
+  // Distances of 50 characters to a target system, as an overlay needs
+  // them on every system change. Uncached pairs move the target on each
+  // iteration, through more pairs than the cache holds.
+  QFETCH(QString, mode);
+
+  const QStringList systems = characterSystems();
+  int iteration = 0;
+  int total = 0;
+
+  QBENCHMARK {
+    const QString target =
+        mode == "uncached"
+            ? systemName(iteration % GRID_SIZE, (iteration / GRID_SIZE) %
+                                                    GRID_SIZE)
+            : systemName(GRID_SIZE / 2, GRID_SIZE / 2);
+    ++iteration;
+
+    total = 0;
+    if (mode == "target") {
+      for (int distance : m_map.jumpDistancesTo(target, systems, 200)) {
+        total += distance;
+      }
+    } else {
+      for (const QString &system : systems) {
+        total += m_map.jumpDistance(system, target);
+      }
+    }
+  }
+
+  // Every character is reachable
+  QVERIFY(total > 0);
+}
+
+QTEST_APPLESS_MAIN(TestStarMap)
+#include "tst_starmap.moc"